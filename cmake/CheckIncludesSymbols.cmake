@@ -21,6 +21,7 @@
 
 include( CheckIncludeFiles )
 check_include_files( "inttypes.h" HAVE_INTTYPES_H )
+check_include_files( "linux/perf_event.h" HAVE_LINUX_PERF_EVENT_H )
 check_include_files( "mach-o/dyld.h" HAVE_MACH_O_DYLD_H )
 check_include_files( "mach/mach.h" HAVE_MACH_MACH_H )
 check_include_files( "memory.h" HAVE_MEMORY_H )
@@ -65,6 +66,18 @@ check_cxx_symbol_exists( M_PI "cmath" HAVE_M_PI )
 # Check functions exist
 include( CheckFunctionExists )
 check_function_exists( expm1 "math.h" HAVE_EXPM1 )
+check_function_exists( sched_getcpu HAVE_SCHED_GETCPU )
+
+# shm_open() is in librt for glibc < 2.34
+check_function_exists( shm_open HAVE_SHM_OPEN )
+if ( NOT HAVE_SHM_OPEN )
+  include( CheckLibraryExists )
+  check_library_exists( rt shm_open "" HAVE_SHM_OPEN_IN_RT )
+  if ( HAVE_SHM_OPEN_IN_RT )
+    set( HAVE_SHM_OPEN ON )
+    set( RT_LIBRARIES rt )
+  endif ()
+endif ()
 
 # given a list, filter all header files
 function( FILTER_HEADERS in_list out_list )
@@ -46,6 +46,7 @@
 // Includes from sli:
 #include "booldatum.h"
 #include "integerdatum.h"
+#include "interpret.h"
 #include "sliexceptions.h"
 #include "tokenarray.h"
 
@@ -76,6 +77,8 @@ mynest::MyModule mymodule_LTX_mod;
 #endif
 // -- DynModule functions ------------------------------------------------------
 
+mynest::SpikeCountSubscriber mynest::MyModule::spike_counter;
+
 mynest::MyModule::MyModule()
 {
 #ifdef LINKED_MODULE
@@ -103,6 +106,26 @@ mynest::MyModule::commandstring( void ) const
   return std::string( "(mymodule-init) run" );
 }
 
+/* BeginDocumentation
+   Name: GetStreamedSpikeCount - Number of spikes in the network
+
+   Synopsis:
+   GetStreamedSpikeCount -> int
+
+   Description:
+   Returns the number of spikes emitted by all nodes since the module was
+   installed, as counted by an example spike stream subscriber.
+
+   SeeAlso: GetKernelStatus
+*/
+void
+mynest::MyModule::GetStreamedSpikeCountFunction::execute(
+  SLIInterpreter* i ) const
+{
+  i->OStack.push( spike_counter.get_count() );
+  i->EStack.pop();
+}
+
 //-------------------------------------------------------------------------------------
 
 void
@@ -133,4 +156,10 @@ mynest::MyModule::init( SLIInterpreter* i )
   nest::kernel().connection_manager.register_conn_builder< StepPatternBuilder >(
     "step_pattern" );
 
+  // Subscribe to the spikes of the whole network, delivered once per slice.
+  nest::kernel().event_delivery_manager.register_spike_stream_subscriber(
+    spike_counter );
+  i->createcommand(
+    "GetStreamedSpikeCount", &getstreamedspikecountfunction );
+
 } // MyModule::init()
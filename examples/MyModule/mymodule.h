@@ -27,6 +27,9 @@
 #include "slifunction.h"
 #include "slimodule.h"
 
+// include headers with your own stuff
+#include "spike_count_subscriber.h"
+
 // Put your stuff into your own namespace.
 namespace mynest
 {
@@ -68,6 +71,22 @@ public:
    * module, in particular, set up type tries for functions you have defined.
    */
   const std::string commandstring( void ) const;
+
+  /**
+   * SLI function returning the number of spikes counted by the spike
+   * stream subscriber.
+   */
+  class GetStreamedSpikeCountFunction : public SLIFunction
+  {
+  public:
+    void execute( SLIInterpreter* ) const;
+  } getstreamedspikecountfunction;
+
+  /**
+   * Spike stream subscriber registered in init(). It lives as long as
+   * the module, which is never unloaded.
+   */
+  static SpikeCountSubscriber spike_counter;
 };
 } // namespace mynest
 
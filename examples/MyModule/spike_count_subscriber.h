@@ -0,0 +1,88 @@
+/*
+ *  spike_count_subscriber.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef SPIKE_COUNT_SUBSCRIBER_H
+#define SPIKE_COUNT_SUBSCRIBER_H
+
+// C++ includes:
+#include <string>
+
+// Includes from nestkernel:
+#include "spike_stream.h"
+
+namespace mynest
+{
+
+/**
+ * Example of a spike stream subscriber, which counts all spikes of the
+ * network and the time of the last one, without any recording device.
+ * Online decoders would process the batch in the same way.
+ */
+class SpikeCountSubscriber : public nest::SpikeStreamSubscriber
+{
+public:
+  SpikeCountSubscriber()
+    : count_( 0 )
+    , last_spike_( 0.0 )
+  {
+  }
+
+  std::string
+  get_name() const
+  {
+    return "spike_count";
+  }
+
+  void
+  handle_spikes( const nest::SpikeBatch& batch )
+  {
+    count_ += batch.size;
+    for ( size_t i = 0; i < batch.size; ++i )
+    {
+      const double t = batch.get_stamp( i ).get_ms() - batch.offsets[ i ];
+      if ( t > last_spike_ )
+      {
+        last_spike_ = t;
+      }
+    }
+  }
+
+  long
+  get_count() const
+  {
+    return count_;
+  }
+
+  double
+  get_last_spike() const
+  {
+    return last_spike_;
+  }
+
+private:
+  long count_;
+  double last_spike_; //!< time of last spike in ms
+};
+
+} // namespace mynest
+
+#endif
@@ -0,0 +1,307 @@
+/*
+ *  nest_shm_stream.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/*
+ * Header-only C reader and writer for the shared memory rings of NEST, for
+ * programs that exchange data with a running simulation without linking
+ * against NEST. See nestkernel/shm_ring_buffer.h for the layout.
+ *
+ * Recorders with /to_shm true create their rings in Prepare, so that a
+ * reader attaches to them after the first call to Simulate:
+ *
+ *   nest_shm_ring r;
+ *   nest_shm_attach( &r, "/spikes-3-0" );
+ *   uint32_t type;
+ *   char buf[ 256 ];
+ *   long n;
+ *   while ( ( n = nest_shm_read( &r, 0, &type, buf, sizeof( buf ) ) ) >= 0 )
+ *   {
+ *     ...
+ *   }
+ *
+ * The shm_spike_generator and shm_current_generator attach to existing
+ * rings, so that a writer creates its ring before the simulation starts:
+ *
+ *   nest_shm_create( &r, "/input", 1 << 20, 1 );
+ *   double spikes[] = { 10.0, 12.5 };
+ *   nest_shm_write( &r, NEST_SHM_SPIKES, spikes, sizeof( spikes ) );
+ *   nest_shm_publish( &r );
+ *
+ * Requires GCC or Clang for the atomic builtins. Link with -lrt on older
+ * versions of glibc.
+ */
+
+#ifndef NEST_SHM_STREAM_H
+#define NEST_SHM_STREAM_H
+
+#include <fcntl.h>
+#include <stdint.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#define NEST_SHM_PAD 0
+#define NEST_SHM_EVENT 1
+#define NEST_SHM_CURRENT 2
+#define NEST_SHM_SPIKES 3
+
+#define NEST_SHM_HEADER_SIZE 128
+#define NEST_SHM_LINE_SIZE 64
+
+typedef struct
+{
+  char* base;
+  size_t size;
+  uint64_t capacity;
+  uint64_t num_readers;
+  uint64_t staged;
+} nest_shm_ring;
+
+static inline volatile uint64_t*
+nest_shm_head_( nest_shm_ring* r )
+{
+  return ( volatile uint64_t* ) ( r->base + NEST_SHM_LINE_SIZE );
+}
+
+static inline volatile uint64_t*
+nest_shm_tail_( nest_shm_ring* r, size_t reader )
+{
+  return ( volatile uint64_t* ) ( r->base + NEST_SHM_HEADER_SIZE
+    + NEST_SHM_LINE_SIZE * reader );
+}
+
+static inline char*
+nest_shm_data_( nest_shm_ring* r )
+{
+  return r->base + NEST_SHM_HEADER_SIZE + NEST_SHM_LINE_SIZE * r->num_readers;
+}
+
+/* Map existing ring. Returns 0 on success, -1 otherwise. */
+static inline int
+nest_shm_attach( nest_shm_ring* r, const char* name )
+{
+  struct stat st;
+  const uint64_t* header;
+  int fd = shm_open( name, O_RDWR, 0 );
+  if ( fd < 0 )
+  {
+    return -1;
+  }
+  if ( fstat( fd, &st ) != 0 || st.st_size < NEST_SHM_HEADER_SIZE )
+  {
+    close( fd );
+    return -1;
+  }
+  r->base = ( char* ) mmap(
+    0, st.st_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0 );
+  close( fd );
+  if ( r->base == MAP_FAILED )
+  {
+    r->base = 0;
+    return -1;
+  }
+  r->size = st.st_size;
+
+  __atomic_thread_fence( __ATOMIC_ACQUIRE );
+  header = ( const uint64_t* ) r->base;
+  if ( memcmp( r->base, "NESTSHM1", 8 ) != 0
+    || NEST_SHM_HEADER_SIZE + NEST_SHM_LINE_SIZE * header[ 2 ] + header[ 1 ]
+      != r->size )
+  {
+    munmap( r->base, r->size );
+    r->base = 0;
+    return -1;
+  }
+  r->capacity = header[ 1 ];
+  r->num_readers = header[ 2 ];
+  r->staged = __atomic_load_n( nest_shm_head_( r ), __ATOMIC_ACQUIRE );
+  return 0;
+}
+
+/* Create ring, replacing any existing one. Returns 0 on success. */
+static inline int
+nest_shm_create( nest_shm_ring* r,
+  const char* name,
+  uint64_t capacity,
+  uint64_t num_readers )
+{
+  uint64_t* header;
+  int fd;
+  capacity = ( capacity + 7 ) & ~( uint64_t ) 7;
+  r->size = NEST_SHM_HEADER_SIZE + NEST_SHM_LINE_SIZE * num_readers + capacity;
+
+  shm_unlink( name );
+  fd = shm_open( name, O_RDWR | O_CREAT | O_EXCL, 0600 );
+  if ( fd < 0 )
+  {
+    return -1;
+  }
+  if ( ftruncate( fd, r->size ) != 0 )
+  {
+    close( fd );
+    shm_unlink( name );
+    return -1;
+  }
+  r->base =
+    ( char* ) mmap( 0, r->size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0 );
+  close( fd );
+  if ( r->base == MAP_FAILED )
+  {
+    r->base = 0;
+    shm_unlink( name );
+    return -1;
+  }
+
+  header = ( uint64_t* ) r->base;
+  header[ 1 ] = capacity;
+  header[ 2 ] = num_readers;
+  r->capacity = capacity;
+  r->num_readers = num_readers;
+  r->staged = 0;
+  __atomic_thread_fence( __ATOMIC_RELEASE );
+  memcpy( r->base, "NESTSHM1", 8 );
+  return 0;
+}
+
+/* Unmap ring. The creator removes it with shm_unlink(). */
+static inline void
+nest_shm_close( nest_shm_ring* r )
+{
+  if ( r->base )
+  {
+    munmap( r->base, r->size );
+    r->base = 0;
+  }
+}
+
+/* Number of records dropped by the writer because the ring was full. */
+static inline uint64_t
+nest_shm_dropped( nest_shm_ring* r )
+{
+  return __atomic_load_n(
+    ( volatile uint64_t* ) r->base + 3, __ATOMIC_ACQUIRE );
+}
+
+/*
+ * Append record, visible to readers after nest_shm_publish(). Returns 0 on
+ * success, -1 if the ring is full and the record was dropped.
+ */
+static inline int
+nest_shm_write( nest_shm_ring* r,
+  uint32_t type,
+  const void* payload,
+  size_t size )
+{
+  const uint64_t record_size = 8 + ( ( size + 7 ) & ~( uint64_t ) 7 );
+  uint64_t pad = r->capacity - r->staged % r->capacity;
+  uint64_t min_tail = r->staged;
+  uint32_t* h;
+  size_t i;
+
+  if ( pad >= record_size )
+  {
+    pad = 0;
+  }
+  for ( i = 0; i < r->num_readers; ++i )
+  {
+    const uint64_t t =
+      __atomic_load_n( nest_shm_tail_( r, i ), __ATOMIC_ACQUIRE );
+    min_tail = t < min_tail ? t : min_tail;
+  }
+  if ( r->staged + pad + record_size - min_tail > r->capacity )
+  {
+    __atomic_add_fetch(
+      ( volatile uint64_t* ) r->base + 3, 1, __ATOMIC_RELAXED );
+    return -1;
+  }
+
+  if ( pad > 0 )
+  {
+    h = ( uint32_t* ) ( nest_shm_data_( r ) + r->staged % r->capacity );
+    h[ 0 ] = ( uint32_t ) pad;
+    h[ 1 ] = NEST_SHM_PAD;
+    r->staged += pad;
+  }
+  h = ( uint32_t* ) ( nest_shm_data_( r ) + r->staged % r->capacity );
+  h[ 0 ] = ( uint32_t ) record_size;
+  h[ 1 ] = type;
+  memcpy( h + 2, payload, size );
+  memset( ( char* ) ( h + 2 ) + size, 0, record_size - 8 - size );
+  r->staged += record_size;
+  return 0;
+}
+
+static inline void
+nest_shm_publish( nest_shm_ring* r )
+{
+  __atomic_store_n( nest_shm_head_( r ), r->staged, __ATOMIC_RELEASE );
+}
+
+/*
+ * Read next record as given reader into buf. Returns the size of the payload
+ * including padding, -1 if there is no record, -2 if buf is too small, in
+ * which case the record is left in the ring, or -3 if the ring holds a
+ * record of invalid size, i.e., was corrupted by a writer.
+ */
+static inline long
+nest_shm_read( nest_shm_ring* r,
+  size_t reader,
+  uint32_t* type,
+  void* buf,
+  size_t buf_size )
+{
+  uint64_t tail =
+    __atomic_load_n( nest_shm_tail_( r, reader ), __ATOMIC_ACQUIRE );
+  const uint64_t head =
+    __atomic_load_n( nest_shm_head_( r ), __ATOMIC_ACQUIRE );
+  while ( tail != head )
+  {
+    const uint32_t* h =
+      ( const uint32_t* ) ( nest_shm_data_( r ) + tail % r->capacity );
+    const uint32_t record_size = h[ 0 ];
+    if ( record_size < 8 || record_size % 8 != 0
+      || record_size > r->capacity - tail % r->capacity
+      || record_size > head - tail )
+    {
+      return -3;
+    }
+    *type = h[ 1 ];
+    if ( *type != NEST_SHM_PAD )
+    {
+      if ( record_size - 8 > buf_size )
+      {
+        return -2;
+      }
+      memcpy( buf, h + 2, record_size - 8 );
+    }
+    tail += record_size;
+    __atomic_store_n( nest_shm_tail_( r, reader ), tail, __ATOMIC_RELEASE );
+    if ( *type != NEST_SHM_PAD )
+    {
+      return record_size - 8;
+    }
+  }
+  return -1;
+}
+
+#endif /* NEST_SHM_STREAM_H */
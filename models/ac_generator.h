@@ -84,6 +84,12 @@ public:
     return false;
   }
 
+  bool
+  independent_of_delivery() const
+  {
+    return true;
+  }
+
   port send_test_event( Node&, rport, synindex, bool );
 
   using Node::handle;
@@ -107,6 +113,11 @@ private:
   void init_state_( const Node& );
   void init_buffers_();
   void calibrate();
+  bool
+  is_run_dependent() const
+  {
+    return true;
+  }
 
   void update( Time const&, const long, const long );
 
@@ -27,6 +27,9 @@
 #include <functional> // for bind2nd
 #include <numeric>
 
+// Includes from nestkernel:
+#include "kernel_manager.h"
+
 // Includes from sli:
 #include "arraydatum.h"
 #include "dict.h"
@@ -42,6 +45,7 @@ nest::correlation_detector::Parameters_::Parameters_()
   , tau_max_( 10 * delta_tau_ )
   , Tstart_( Time::ms( 0.0 ) )
   , Tstop_( Time::pos_inf() )
+  , binned_( false )
 {
 }
 
@@ -50,6 +54,7 @@ nest::correlation_detector::Parameters_::Parameters_( const Parameters_& p )
   , tau_max_( p.tau_max_ )
   , Tstart_( p.Tstart_ )
   , Tstop_( p.Tstop_ )
+  , binned_( p.binned_ )
 {
   // Check for proper properties is not done here but in the
   // correlation_detector() copy c'tor. The check cannot be
@@ -66,6 +71,7 @@ nest::correlation_detector::Parameters_::Parameters_( const Parameters_& p )
 nest::correlation_detector::State_::State_()
   : n_events_( 2, 0 )
   , incoming_( 2 )
+  , bins_()
   , histogram_()
   , histogram_correction_()
   , count_histogram_()
@@ -84,6 +90,7 @@ nest::correlation_detector::Parameters_::get( DictionaryDatum& d ) const
   ( *d )[ names::tau_max ] = tau_max_.get_ms();
   ( *d )[ names::Tstart ] = Tstart_.get_ms();
   ( *d )[ names::Tstop ] = Tstop_.get_ms();
+  ( *d )[ names::binned ] = binned_;
 }
 
 void
@@ -105,6 +112,11 @@ nest::correlation_detector::Parameters_::set( const DictionaryDatum& d,
 {
   bool reset = false;
   double t;
+  if ( updateValue< bool >( d, names::binned, binned_ ) )
+  {
+    reset = true;
+  }
+
   if ( updateValue< double >( d, names::delta_tau, t ) )
   {
     delta_tau_ = Time::ms( t );
@@ -174,6 +186,7 @@ nest::correlation_detector::State_::reset( const Parameters_& p )
 
   incoming_.clear();
   incoming_.resize( 2 );
+  bins_.clear();
 
   assert( p.tau_max_.is_multiple_of( p.delta_tau_ ) );
   histogram_.clear();
@@ -253,8 +266,89 @@ nest::correlation_detector::calibrate()
  * ---------------------------------------------------------------- */
 
 void
-nest::correlation_detector::update( Time const&, const long, const long )
+nest::correlation_detector::update( Time const& origin,
+  const long,
+  const long )
+{
+  if ( not P_.binned_ or not S_.bins_.has_pending() )
+  {
+    return;
+  }
+
+  // largest time difference that falls into a bin
+  const long max_lag =
+    P_.tau_max_.get_steps() + P_.delta_tau_.get_steps() / 2;
+
+  const std::vector< BinnedSpikeHistory::Bin >& block = S_.bins_.collect();
+  for ( size_t a = 0; a < block.size(); ++a )
+  {
+    const BinnedSpikeHistory::Bin& b = block[ a ];
+
+    // only count events in histogram, if the current event is within the time
+    // window [Tstart, Tstop]
+    const Time stamp = Time::step( b.step );
+    if ( not( P_.Tstart_ <= stamp && stamp <= P_.Tstop_ ) )
+    {
+      continue;
+    }
+
+    // pairs with spikes of earlier slices
+    for ( BinnedSpikeHistory::const_iterator h =
+            S_.bins_.lower_bound( b.step - max_lag );
+          h != S_.bins_.end() && h->step <= b.step + max_lag;
+          ++h )
+    {
+      if ( h->channel != b.channel )
+      {
+        add_pairs_( b, *h );
+      }
+    }
+
+    // pairs with earlier spikes of this slice, which is sorted by step
+    for ( size_t c = a; c > 0 && block[ c - 1 ].step >= b.step - max_lag;
+          --c )
+    {
+      if ( block[ c - 1 ].channel != b.channel )
+      {
+        add_pairs_( b, block[ c - 1 ] );
+      }
+    }
+  }
+
+  // spikes delivered later are not older than the current slice
+  const delay min_delay = kernel().connection_manager.get_min_delay();
+  S_.bins_.commit( origin.get_steps() - min_delay - max_lag );
+}
+
+void
+nest::correlation_detector::add_pairs_(
+  const BinnedSpikeHistory::Bin& arriving,
+  const BinnedSpikeHistory::Bin& other )
 {
+  // time difference of the spikes of source 1 and source 0
+  const long dt = arriving.channel == 1 ? arriving.step - other.step
+                                        : other.step - arriving.step;
+
+  // bins as computed in handle(), scaled by two to use integers
+  const long tau_max = P_.tau_max_.get_steps();
+  const long delta = P_.delta_tau_.get_steps();
+  const long pos = 2 * tau_max + delta + 2 * dt;
+  if ( pos < 0 || pos >= 2 * ( 2 * tau_max + delta ) )
+  {
+    return;
+  }
+  const size_t bin = pos / ( 2 * delta );
+  assert( bin < S_.histogram_.size() );
+
+  // weighted histogram with kahan summation algorithm
+  const double y = arriving.weight * other.weight
+    - S_.histogram_correction_[ bin ];
+  const double t = S_.histogram_[ bin ] + y;
+  S_.histogram_correction_[ bin ] = ( t - S_.histogram_[ bin ] ) - y;
+  S_.histogram_[ bin ] = t;
+
+  // pure (unweighted) count histogram
+  S_.count_histogram_[ bin ] += arriving.multiplicity * other.n_spikes;
 }
 
 void
@@ -271,7 +365,19 @@ nest::correlation_detector::handle( SpikeEvent& e )
   // accept spikes only if detector was active when spike was emitted
   Time const stamp = e.get_stamp();
 
-  if ( device_.is_active( stamp ) )
+  if ( device_.is_active( stamp ) && P_.binned_ )
+  {
+    // correlations are computed in update()
+    S_.bins_.add( stamp.get_steps(),
+      sender,
+      e.get_multiplicity() * e.get_weight(),
+      e.get_multiplicity() );
+    if ( P_.Tstart_ <= stamp && stamp <= P_.Tstop_ )
+    {
+      S_.n_events_[ sender ]++;
+    }
+  }
+  else if ( device_.is_active( stamp ) )
   {
 
     const long spike_i = stamp.get_steps();
@@ -29,6 +29,7 @@
 #include <vector>
 
 // Includes from nestkernel:
+#include "binned_spike_history.h"
 #include "event.h"
 #include "nest_types.h"
 #include "node.h"
@@ -93,6 +94,16 @@
                                                     0 and 1. By setting n_events
                                                     to [0 0], the histogram is
                                                     cleared.
+   binned               bool                      - If true, incoming spikes
+                                                    are aggregated per time step
+                                                    and source and correlated
+                                                    once per time slice. Pairs
+                                                    of spikes delivered in the
+                                                    same time slice are counted
+                                                    as if they arrived in
+                                                    temporal order. Default is
+                                                    false. Setting binned clears
+                                                    the histograms.
 
    Remarks: This recorder does not record to file, screen or memory in the usual
             sense.
@@ -133,15 +144,9 @@ namespace nest
  *       follows: the internal buffers for storing spikes are part
  *       of State_, but are initialized by init_buffers_().
  *
- * @todo The correlation detector could be made more efficient as follows
- *       (HEP 2008-07-01):
- *       - incoming_ is vector of two deques
- *       - let handle() push_back() entries in incoming_ and do nothing else
- *       - keep index to last "old spike" in each incoming_; cannot
- *         be iterator since that may change
- *       - update() deletes all entries before now-tau_max, sorts the new
- *entries,
- *         then registers new entries in histogram
+ * @note In binned mode, handle() only stores incoming spikes in a
+ *       BinnedSpikeHistory, and update() correlates the bins of all spikes
+ *       delivered since the last update with the bins of the other source.
  */
 
 class correlation_detector : public Node
@@ -183,6 +188,14 @@ private:
 
   void update( Time const&, const long, const long );
 
+  /**
+   * Add all pairs of spikes of two bins of different sources to the
+   * histograms.
+   * @param arriving bin whose spikes are counted as arriving later
+   */
+  void add_pairs_( const BinnedSpikeHistory::Bin& arriving,
+    const BinnedSpikeHistory::Bin& other );
+
   // ------------------------------------------------------------
 
   /**
@@ -222,6 +235,7 @@ private:
     Time tau_max_;   //!< maximum time difference of events to detect
     Time Tstart_;    //!< start of recording
     Time Tstop_;     //!< end of recording
+    bool binned_;    //!< correlate spikes aggregated per step in update()
 
     Parameters_();                     //!< Sets default parameter values
     Parameters_( const Parameters_& ); //!< Recalibrate all times
@@ -251,6 +265,7 @@ private:
   {
     std::vector< long > n_events_;          //!< spike counters
     std::vector< SpikelistType > incoming_; //!< incoming spikes, sorted
+    BinnedSpikeHistory bins_; //!< incoming spikes in binned mode
 
     /** Weighted histogram.
      * @note Data type is double to accommodate weights.
@@ -23,6 +23,7 @@
 #include "correlomatrix_detector.h"
 
 // C++ includes:
+#include <algorithm>
 #include <cmath>      // for less
 #include <functional> // for bind2nd
 #include <numeric>
@@ -45,6 +46,7 @@ nest::correlomatrix_detector::Parameters_::Parameters_()
   , Tstart_( Time::ms( 0.0 ) )
   , Tstop_( Time::pos_inf() )
   , N_channels_( 1 )
+  , binned_( false )
 {
 }
 
@@ -54,6 +56,7 @@ nest::correlomatrix_detector::Parameters_::Parameters_( const Parameters_& p )
   , Tstart_( p.Tstart_ )
   , Tstop_( p.Tstop_ )
   , N_channels_( p.N_channels_ )
+  , binned_( p.binned_ )
 {
   // Check for proper properties is not done here but in the
   // correlomatrix_detector() copy c'tor. The check cannot be
@@ -70,10 +73,11 @@ nest::correlomatrix_detector::Parameters_::Parameters_( const Parameters_& p )
 nest::correlomatrix_detector::State_::State_()
   : n_events_( 1, 0 )
   , incoming_()
-  , covariance_( 1,
-      std::vector< std::vector< double > >( 1, std::vector< double >() ) )
-  , count_covariance_( 1,
-      std::vector< std::vector< long > >( 1, std::vector< long >() ) )
+  , bins_()
+  , N_channels_( 1 )
+  , n_bins_( 0 )
+  , covariance_()
+  , count_covariance_()
 {
 }
 
@@ -90,6 +94,7 @@ nest::correlomatrix_detector::Parameters_::get( DictionaryDatum& d ) const
   ( *d )[ names::Tstart ] = Tstart_.get_ms();
   ( *d )[ names::Tstop ] = Tstop_.get_ms();
   ( *d )[ names::N_channels ] = N_channels_;
+  ( *d )[ names::binned ] = binned_;
 }
 
 void
@@ -100,16 +105,19 @@ nest::correlomatrix_detector::State_::get( DictionaryDatum& d ) const
 
   ArrayDatum* C = new ArrayDatum;
   ArrayDatum* CountC = new ArrayDatum;
-  for ( size_t i = 0; i < covariance_.size(); ++i )
+  for ( long i = 0; i < N_channels_; ++i )
   {
     ArrayDatum* C_i = new ArrayDatum;
     ArrayDatum* CountC_i = new ArrayDatum;
-    for ( size_t j = 0; j < covariance_[ i ].size(); ++j )
+    for ( long j = 0; j < N_channels_; ++j )
     {
+      const size_t first = index( i, j, 0 );
       C_i->push_back( new DoubleVectorDatum(
-        new std::vector< double >( covariance_[ i ][ j ] ) ) );
+        new std::vector< double >( covariance_.begin() + first,
+          covariance_.begin() + first + n_bins_ ) ) );
       CountC_i->push_back( new IntVectorDatum(
-        new std::vector< long >( count_covariance_[ i ][ j ] ) ) );
+        new std::vector< long >( count_covariance_.begin() + first,
+          count_covariance_.begin() + first + n_bins_ ) ) );
     }
     C->push_back( *C_i );
     CountC->push_back( *CountC_i );
@@ -139,6 +147,11 @@ nest::correlomatrix_detector::Parameters_::set( const DictionaryDatum& d,
     }
   }
 
+  if ( updateValue< bool >( d, names::binned, binned_ ) )
+  {
+    reset = true;
+  }
+
   if ( updateValue< double >( d, names::delta_tau, t ) )
   {
     delta_tau_ = Time::ms( t );
@@ -196,27 +209,15 @@ nest::correlomatrix_detector::State_::reset( const Parameters_& p )
   n_events_.resize( p.N_channels_, 0 );
 
   incoming_.clear();
+  bins_.clear();
 
   assert( p.tau_max_.is_multiple_of( p.delta_tau_ ) );
 
-  covariance_.clear();
-  covariance_.resize( p.N_channels_ );
-
-  count_covariance_.clear();
-  count_covariance_.resize( p.N_channels_ );
+  N_channels_ = p.N_channels_;
+  n_bins_ = 1 + p.tau_max_.get_steps() / p.delta_tau_.get_steps();
 
-  for ( long i = 0; i < p.N_channels_; ++i )
-  {
-    covariance_[ i ].resize( p.N_channels_ );
-    count_covariance_[ i ].resize( p.N_channels_ );
-    for ( long j = 0; j < p.N_channels_; ++j )
-    {
-      covariance_[ i ][ j ].resize(
-        1 + p.tau_max_.get_steps() / p.delta_tau_.get_steps(), 0 );
-      count_covariance_[ i ][ j ].resize(
-        1 + p.tau_max_.get_steps() / p.delta_tau_.get_steps(), 0 );
-    }
-  }
+  covariance_.assign( N_channels_ * N_channels_ * n_bins_, 0.0 );
+  count_covariance_.assign( N_channels_ * N_channels_ * n_bins_, 0 );
 }
 
 /* ----------------------------------------------------------------
@@ -284,8 +285,93 @@ nest::correlomatrix_detector::calibrate()
  * ---------------------------------------------------------------- */
 
 void
-nest::correlomatrix_detector::update( Time const&, const long, const long )
+nest::correlomatrix_detector::update( Time const& origin,
+  const long,
+  const long )
 {
+  if ( not P_.binned_ or not S_.bins_.has_pending() )
+  {
+    return;
+  }
+
+  // largest time difference that falls into a bin
+  const long max_lag =
+    P_.tau_max_.get_steps() + ( P_.delta_tau_.get_steps() - 1 ) / 2;
+
+  const std::vector< BinnedSpikeHistory::Bin >& block = S_.bins_.collect();
+  for ( size_t a = 0; a < block.size(); ++a )
+  {
+    const BinnedSpikeHistory::Bin& b = block[ a ];
+
+    // only count events in histogram, if the current event is within the time
+    // window [Tstart, Tstop]
+    const Time stamp = Time::step( b.step );
+    if ( not( P_.Tstart_ <= stamp && stamp <= P_.Tstop_ ) )
+    {
+      continue;
+    }
+
+    // pairs with spikes of earlier slices
+    for ( BinnedSpikeHistory::const_iterator h =
+            S_.bins_.lower_bound( b.step - max_lag );
+          h != S_.bins_.end() && h->step <= b.step + max_lag;
+          ++h )
+    {
+      add_pairs_( b, *h );
+    }
+
+    // pairs with earlier spikes of this slice, which is sorted by step
+    for ( size_t c = a; c > 0 && block[ c - 1 ].step >= b.step - max_lag;
+          --c )
+    {
+      add_pairs_( b, block[ c - 1 ] );
+    }
+
+    // pairs within the bin, including each spike with itself
+    const size_t i = S_.index( b.channel, b.channel, 0 );
+    S_.covariance_[ i ] += b.self_weight;
+    S_.count_covariance_[ i ] += b.self_multiplicity;
+  }
+
+  // spikes delivered later are not older than the current slice
+  const delay min_delay = kernel().connection_manager.get_min_delay();
+  S_.bins_.commit( origin.get_steps() - min_delay - max_lag );
+}
+
+void
+nest::correlomatrix_detector::add_pairs_(
+  const BinnedSpikeHistory::Bin& arriving,
+  const BinnedSpikeHistory::Bin& other )
+{
+  long dt = arriving.step - other.step;
+  long sender_ind = arriving.channel;
+  long other_ind = other.channel;
+  if ( dt < 0 )
+  {
+    dt = -dt;
+    std::swap( sender_ind, other_ind );
+  }
+
+  // equivalent to the bins computed in handle(), since delta_tau is an odd
+  // number of steps
+  const long delta = P_.delta_tau_.get_steps();
+  const size_t bin = ( 2 * dt + delta ) / ( 2 * delta );
+  if ( bin >= S_.n_bins_ )
+  {
+    return;
+  }
+
+  const double weight = arriving.weight * other.weight;
+  const long count = arriving.multiplicity * other.n_spikes;
+  const size_t i = S_.index( sender_ind, other_ind, bin );
+  S_.covariance_[ i ] += weight;
+  S_.count_covariance_[ i ] += count;
+  if ( bin == 0 && ( dt != 0 || arriving.channel != other.channel ) )
+  {
+    const size_t j = S_.index( other_ind, sender_ind, bin );
+    S_.covariance_[ j ] += weight;
+    S_.count_covariance_[ j ] += count;
+  }
 }
 
 void
@@ -302,7 +388,19 @@ nest::correlomatrix_detector::handle( SpikeEvent& e )
   // accept spikes only if detector was active when spike was emitted
   Time const stamp = e.get_stamp();
 
-  if ( device_.is_active( stamp ) )
+  if ( device_.is_active( stamp ) && P_.binned_ )
+  {
+    // correlations are computed in update()
+    S_.bins_.add( stamp.get_steps(),
+      sender,
+      e.get_multiplicity() * e.get_weight(),
+      e.get_multiplicity() );
+    if ( P_.Tstart_ <= stamp && stamp <= P_.Tstop_ )
+    {
+      S_.n_events_[ sender ]++;
+    }
+  }
+  else if ( device_.is_active( stamp ) )
   {
     const long spike_i = stamp.get_steps();
 
@@ -375,25 +473,25 @@ nest::correlomatrix_detector::handle( SpikeEvent& e )
             / P_.delta_tau_.get_steps() );
         }
 
-        if ( bin < S_.covariance_[ sender_ind ][ other_ind ].size() )
+        if ( bin < S_.n_bins_ )
         {
+          const size_t i = S_.index( sender_ind, other_ind, bin );
+          const size_t j = S_.index( other_ind, sender_ind, bin );
           // weighted histogram
-          S_.covariance_[ sender_ind ][ other_ind ][ bin ] +=
+          S_.covariance_[ i ] +=
             e.get_multiplicity() * e.get_weight() * spike_j->weight_;
           if ( bin == 0
             && ( spike_i - spike_j->timestep_ != 0 || other != sender ) )
           {
-            S_.covariance_[ other_ind ][ sender_ind ][ bin ] +=
+            S_.covariance_[ j ] +=
               e.get_multiplicity() * e.get_weight() * spike_j->weight_;
           }
           // pure (unweighted) count histogram
-          S_.count_covariance_[ sender_ind ][ other_ind ][ bin ] +=
-            e.get_multiplicity();
+          S_.count_covariance_[ i ] += e.get_multiplicity();
           if ( bin == 0
             && ( spike_i - spike_j->timestep_ != 0 || other != sender ) )
           {
-            S_.count_covariance_[ other_ind ][ sender_ind ][ bin ] +=
-              e.get_multiplicity();
+            S_.count_covariance_[ j ] += e.get_multiplicity();
           }
         }
       }
@@ -29,6 +29,7 @@
 #include <vector>
 
 // Includes from nestkernel:
+#include "binned_spike_history.h"
 #include "event.h"
 #include "nest_types.h"
 #include "node.h"
@@ -87,6 +88,17 @@
                           receptor_type. Default is 1.
                           Setting N_channels clears count_covariance, covariance
                           and n_events.
+   binned     bool      - If true, incoming spikes are aggregated per time
+                          step and channel and correlated once per time slice
+                          in update(), instead of correlating each spike with
+                          all stored spikes on arrival. This is much faster for
+                          many channels or high rates. Pairs of spikes that are
+                          delivered in the same time slice are counted as if
+                          they arrived in temporal order, which only matters
+                          for pairs across Tstart or Tstop and for spikes with
+                          multiplicity. Weighted counts may differ by rounding
+                          errors. Default is false. Setting binned clears
+                          count_covariance, covariance and n_events.
 
    covariance        matrix of double vectors, read-only - raw, weighted
                                                            auto/cross
@@ -137,14 +149,10 @@ namespace nest
  *       follows: the internal buffers for storing spikes are part
  *       of State_, but are initialized by init_buffers_().
  *
- * @todo The correlation detector could be made more efficient as follows
- *       (HEP 2008-07-01):
- *       - incoming_ is vector of two deques
- *       - let handle() push_back() entries in incoming_ and do nothing else
- *       - keep index to last "old spike" in each incoming_; cannot
- *         be iterator since that may change
- *       - update() deletes all entries before now-tau_max, sorts the new
- *         entries, then registers new entries in histogram
+ * @note In binned mode, handle() only stores incoming spikes in a
+ *       BinnedSpikeHistory, and update() correlates the bins of all spikes
+ *       delivered since the last update with each other and with the
+ *       bins of earlier slices.
  */
 
 class correlomatrix_detector : public Node
@@ -186,6 +194,13 @@ private:
 
   void update( Time const&, const long, const long );
 
+  /**
+   * Add all pairs of spikes of two bins to the histograms.
+   * @param arriving bin whose spikes are counted as arriving later
+   */
+  void add_pairs_( const BinnedSpikeHistory::Bin& arriving,
+    const BinnedSpikeHistory::Bin& other );
+
   // ------------------------------------------------------------
 
   /**
@@ -228,6 +243,7 @@ private:
     Time Tstart_;     //!< start of recording
     Time Tstop_;      //!< end of recording
     long N_channels_; //!< number of channels
+    bool binned_;     //!< correlate spikes aggregated per step in update()
 
     Parameters_();                     //!< Sets default parameter values
     Parameters_( const Parameters_& ); //!< Recalibrate all times
@@ -258,14 +274,26 @@ private:
 
     std::vector< long > n_events_; //!< spike counters
     SpikelistType incoming_;       //!< incoming spikes, sorted
-                                   /** Weighted covariance matrix.
-                                    *  @note Data type is double to accomodate weights.
-                                    */
-    std::vector< std::vector< std::vector< double > > > covariance_;
+    BinnedSpikeHistory bins_;      //!< incoming spikes in binned mode
 
-    /** Unweighted covariance matrix.
+    long N_channels_; //!< number of channels of the histograms
+    size_t n_bins_;   //!< number of bins per pair of channels
+
+    /** Weighted covariance matrix.
+     *  Entry [i][j][k] is stored at ( i * N_channels_ + j ) * n_bins_ + k.
+     *  @note Data type is double to accomodate weights.
      */
-    std::vector< std::vector< std::vector< long > > > count_covariance_;
+    std::vector< double > covariance_;
+
+    /** Unweighted covariance matrix, stored as covariance_.
+     */
+    std::vector< long > count_covariance_;
+
+    size_t
+    index( const long i, const long j, const size_t bin ) const
+    {
+      return ( i * N_channels_ + j ) * n_bins_ + bin;
+    }
 
     State_(); //!< initialize default state
 
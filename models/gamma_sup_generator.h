@@ -93,6 +93,11 @@ public:
     return false;
   }
   bool
+  independent_of_delivery() const
+  {
+    return true;
+  }
+  bool
   is_off_grid() const
   {
     return false;
@@ -23,13 +23,18 @@
 #ifndef PP_POP_PSC_BETA_H
 #define PP_POP_PSC_BETA_H
 
+#include "config.h"
 #include "nest.h"
 #include "event.h"
 #include "node.h"
 #include "ring_buffer.h"
 #include "connection.h"
 #include "poisson_randomdev.h"
+#ifdef HAVE_GSL
 #include "gsl_binomial_randomdev.h"
+#else
+#include "binomial_randomdev.h"
+#endif
 #include "universal_data_logger.h"
 
 
@@ -312,8 +317,13 @@ private:
     librandom::RngPtr rng_; // random number generator of own thread
 
     librandom::PoissonRandomDev poisson_dev_; // Poisson random number generator
+#ifdef HAVE_GSL
     librandom::GSL_BinomialRandomDev
       bino_dev_; // Binomial random number generator
+#else
+    librandom::BinomialRandomDev
+      bino_dev_; // Binomial random number generator
+#endif
 
     double x_;                     // internal variable of population dynamics
     double z_;                     // internal variable of population dynamics
@@ -23,6 +23,7 @@
 #include "iaf_psc_alpha.h"
 
 // C++ includes:
+#include <algorithm>
 #include <limits>
 
 // Includes from libnestutil:
@@ -77,6 +78,7 @@ iaf_psc_alpha::Parameters_::Parameters_()
   , LowerBound_( -std::numeric_limits< double >::infinity() )
   , tau_ex_( 2.0 ) // ms
   , tau_in_( 2.0 ) // ms
+  , fast_forward_( false )
 {
 }
 
@@ -108,6 +110,7 @@ iaf_psc_alpha::Parameters_::get( DictionaryDatum& d ) const
   def< double >( d, names::t_ref, TauR_ );
   def< double >( d, names::tau_syn_ex, tau_ex_ );
   def< double >( d, names::tau_syn_in, tau_in_ );
+  def< bool >( d, names::fast_forward, fast_forward_ );
 }
 
 double
@@ -152,6 +155,7 @@ iaf_psc_alpha::Parameters_::set( const DictionaryDatum& d )
   updateValue< double >( d, names::tau_syn_ex, tau_ex_ );
   updateValue< double >( d, names::tau_syn_in, tau_in_ );
   updateValue< double >( d, names::t_ref, TauR_ );
+  updateValue< bool >( d, names::fast_forward, fast_forward_ );
 
   if ( C_ <= 0.0 )
   {
@@ -286,6 +290,38 @@ iaf_psc_alpha::calibrate()
   V_.EPSCInitialValue_ = 1.0 * numerics::e / P_.tau_ex_;
   V_.IPSCInitialValue_ = 1.0 * numerics::e / P_.tau_in_;
 
+  // propagators across one time slice for try_fast_forward_(), obtained by
+  // applying the single-step propagators ff_steps_ times so that the result
+  // agrees with step-wise integration up to rounding
+  V_.ff_steps_ = kernel().connection_manager.get_min_delay();
+  V_.ff_P11_ex_ = V_.ff_P22_ex_ = 1.0;
+  V_.ff_P11_in_ = V_.ff_P22_in_ = 1.0;
+  V_.ff_P21_ex_ = V_.ff_P31_ex_ = V_.ff_P32_ex_ = 0.0;
+  V_.ff_P21_in_ = V_.ff_P31_in_ = V_.ff_P32_in_ = 0.0;
+  V_.ff_P33_ = 1.0;
+  V_.ff_P30_ = 0.0;
+  for ( long k = 0; k < V_.ff_steps_; ++k )
+  {
+    // the membrane potential is propagated with the currents of the previous
+    // step, so update the coefficients in the same order as update()
+    V_.ff_P31_ex_ = V_.P33_ * V_.ff_P31_ex_ + V_.P31_ex_ * V_.ff_P11_ex_
+      + V_.P32_ex_ * V_.ff_P21_ex_;
+    V_.ff_P32_ex_ = V_.P33_ * V_.ff_P32_ex_ + V_.P32_ex_ * V_.ff_P22_ex_;
+    V_.ff_P21_ex_ = V_.P22_ex_ * V_.ff_P21_ex_ + V_.P21_ex_ * V_.ff_P11_ex_;
+    V_.ff_P22_ex_ *= V_.P22_ex_;
+    V_.ff_P11_ex_ *= V_.P11_ex_;
+
+    V_.ff_P31_in_ = V_.P33_ * V_.ff_P31_in_ + V_.P31_in_ * V_.ff_P11_in_
+      + V_.P32_in_ * V_.ff_P21_in_;
+    V_.ff_P32_in_ = V_.P33_ * V_.ff_P32_in_ + V_.P32_in_ * V_.ff_P22_in_;
+    V_.ff_P21_in_ = V_.P22_in_ * V_.ff_P21_in_ + V_.P21_in_ * V_.ff_P11_in_;
+    V_.ff_P22_in_ *= V_.P22_in_;
+    V_.ff_P11_in_ *= V_.P11_in_;
+
+    V_.ff_P30_ = V_.P33_ * V_.ff_P30_ + V_.P30_;
+    V_.ff_P33_ *= V_.P33_;
+  }
+
   // TauR specifies the length of the absolute refractory period as
   // a double in ms. The grid based iaf_psc_alpha can only handle refractory
   // periods that are integer multiples of the computation step size (h).
@@ -322,6 +358,11 @@ iaf_psc_alpha::update( Time const& origin, const long from, const long to )
     to >= 0 && ( delay ) from < kernel().connection_manager.get_min_delay() );
   assert( from < to );
 
+  if ( P_.fast_forward_ && try_fast_forward_( from, to ) )
+  {
+    return;
+  }
+
   for ( long lag = from; lag < to; ++lag )
   {
     if ( S_.r_ == 0 )
@@ -381,6 +422,57 @@ iaf_psc_alpha::update( Time const& origin, const long from, const long to )
   }
 }
 
+bool
+iaf_psc_alpha::try_fast_forward_( const long from, const long to )
+{
+  if ( from != 0 || to != V_.ff_steps_ || S_.r_ != 0 || S_.y0_ != 0.0
+    || B_.logger_.has_loggers() )
+  {
+    return false;
+  }
+
+  if ( not( B_.ex_spikes_.is_zero( from, to )
+         && B_.in_spikes_.is_zero( from, to )
+         && B_.currents_.is_zero( from, to ) ) )
+  {
+    return false;
+  }
+
+  // Without input, each synaptic current evolves as (I + dI t) exp(-t/tau),
+  // and t exp(-t/tau) never exceeds tau/e. This bounds the total current
+  // from above and below over the slice, and the membrane potential stays
+  // between its initial value and the steady state potentials for these
+  // bounds.
+  const double I_max = P_.I_e_ + std::max( S_.I_ex_, 0.0 )
+    + std::max( S_.dI_ex_, 0.0 ) * P_.tau_ex_ / numerics::e
+    + std::max( S_.I_in_, 0.0 )
+    + std::max( S_.dI_in_, 0.0 ) * P_.tau_in_ / numerics::e;
+  const double I_min = P_.I_e_ + std::min( S_.I_ex_, 0.0 )
+    + std::min( S_.dI_ex_, 0.0 ) * P_.tau_ex_ / numerics::e
+    + std::min( S_.I_in_, 0.0 )
+    + std::min( S_.dI_in_, 0.0 ) * P_.tau_in_ / numerics::e;
+  const double R = P_.Tau_ / P_.C_;
+  if ( std::max( S_.y3_, R * I_max ) >= P_.Theta_
+    || std::min( S_.y3_, R * I_min ) < P_.LowerBound_ )
+  {
+    return false;
+  }
+
+  S_.y3_ = V_.ff_P30_ * P_.I_e_ + V_.ff_P31_ex_ * S_.dI_ex_
+    + V_.ff_P32_ex_ * S_.I_ex_ + V_.ff_P31_in_ * S_.dI_in_
+    + V_.ff_P32_in_ * S_.I_in_ + V_.ff_P33_ * S_.y3_;
+
+  S_.I_ex_ = V_.ff_P21_ex_ * S_.dI_ex_ + V_.ff_P22_ex_ * S_.I_ex_;
+  S_.dI_ex_ *= V_.ff_P11_ex_;
+  S_.I_in_ = V_.ff_P21_in_ * S_.dI_in_ + V_.ff_P22_in_ * S_.I_in_;
+  S_.dI_in_ *= V_.ff_P11_in_;
+
+  V_.weighted_spikes_ex_ = 0.0;
+  V_.weighted_spikes_in_ = 0.0;
+
+  return true;
+}
+
 void
 iaf_psc_alpha::handle( SpikeEvent& e )
 {
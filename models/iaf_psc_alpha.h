@@ -96,6 +96,8 @@ Parameters:
   tau_syn_in double - Rise time of the inhibitory synaptic alpha function in ms.
   I_e        double - Constant external input current in pA.
   V_min      double - Absolute lower value for the membrane potential.
+  fast_forward bool - If true, advance the neuron analytically across
+                      input-free time slices (default: false).
 
 Remarks:
 
@@ -105,6 +107,15 @@ Remarks:
   For details, please see IAF_neurons_singularity.ipynb in
   the NEST source code (docs/model_details).
 
+  If fast_forward is set, the neuron checks at the beginning of each
+  time slice of length min_delay whether it is free of input, i.e., not
+  refractory, without pending spikes or current input, and without
+  connected multimeter. If, in addition, bounds on the membrane potential
+  over the slice lie between V_min and threshold, the state is propagated
+  across the entire slice in one step using precomputed powers of the
+  propagator. Results are identical to step-wise integration up to
+  floating point rounding.
+
 References:
   [1] Rotter S & Diesmann M (1999) Exact simulation of time-invariant linear
       systems with applications to neuronal modeling. Biologial Cybernetics
@@ -164,6 +175,13 @@ private:
 
   void update( Time const&, const long, const long );
 
+  /**
+   * Propagate the state across an input-free slice [from, to) in one step.
+   * @returns false, without changing the state, if the slice is not
+   *          input-free or a threshold crossing cannot be excluded.
+   */
+  bool try_fast_forward_( const long, const long );
+
   // The next two classes need to be friends to access the State_ class/member
   friend class RecordablesMap< iaf_psc_alpha >;
   friend class UniversalDataLogger< iaf_psc_alpha >;
@@ -205,6 +223,9 @@ private:
     /** Time constant of inhibitory synaptic current in ms. */
     double tau_in_;
 
+    /** Advance analytically across input-free time slices. */
+    bool fast_forward_;
+
     Parameters_(); //!< Sets default parameter values
 
     void get( DictionaryDatum& ) const; //!< Store current values in dictionary
@@ -286,6 +307,21 @@ private:
     double P33_;
     double expm1_tau_m_;
 
+    // propagators for ff_steps_ time steps, used by try_fast_forward_()
+    long ff_steps_;
+    double ff_P11_ex_;
+    double ff_P21_ex_;
+    double ff_P22_ex_;
+    double ff_P31_ex_;
+    double ff_P32_ex_;
+    double ff_P11_in_;
+    double ff_P21_in_;
+    double ff_P22_in_;
+    double ff_P31_in_;
+    double ff_P32_in_;
+    double ff_P30_;
+    double ff_P33_;
+
     double weighted_spikes_ex_;
     double weighted_spikes_in_;
   };
@@ -25,6 +25,7 @@
 #include "iaf_psc_delta.h"
 
 // C++ includes:
+#include <algorithm>
 #include <limits>
 
 // Includes from libnestutil:
@@ -74,6 +75,7 @@ nest::iaf_psc_delta::Parameters_::Parameters_()
   , V_min_( -std::numeric_limits< double >::max() ) // relative E_L_-55.0-E_L_
   , V_reset_( -70.0 - E_L_ )                        // mV, rel to E_L_
   , with_refr_input_( false )
+  , fast_forward_( false )
 {
 }
 
@@ -101,6 +103,7 @@ nest::iaf_psc_delta::Parameters_::get( DictionaryDatum& d ) const
   def< double >( d, names::tau_m, tau_m_ );
   def< double >( d, names::t_ref, t_ref_ );
   def< bool >( d, names::refractory_input, with_refr_input_ );
+  def< bool >( d, names::fast_forward, fast_forward_ );
 }
 
 double
@@ -161,6 +164,7 @@ nest::iaf_psc_delta::Parameters_::set( const DictionaryDatum& d )
   }
 
   updateValue< bool >( d, names::refractory_input, with_refr_input_ );
+  updateValue< bool >( d, names::fast_forward, fast_forward_ );
 
   return delta_EL;
 }
@@ -249,6 +253,18 @@ nest::iaf_psc_delta::calibrate()
   V_.P33_ = std::exp( -h / P_.tau_m_ );
   V_.P30_ = 1 / P_.c_m_ * ( 1 - V_.P33_ ) * P_.tau_m_;
 
+  // propagators across one time slice for try_fast_forward_(), obtained by
+  // applying the single-step propagators ff_steps_ times so that the result
+  // agrees with step-wise integration up to rounding
+  V_.ff_steps_ = kernel().connection_manager.get_min_delay();
+  V_.ff_P33_ = 1.0;
+  V_.ff_P30_ = 0.0;
+  for ( long k = 0; k < V_.ff_steps_; ++k )
+  {
+    V_.ff_P30_ = V_.P33_ * V_.ff_P30_ + V_.P30_;
+    V_.ff_P33_ *= V_.P33_;
+  }
+
 
   // t_ref_ specifies the length of the absolute refractory period as
   // a double in ms. The grid based iaf_psp_delta can only handle refractory
@@ -285,6 +301,11 @@ nest::iaf_psc_delta::update( Time const& origin,
     to >= 0 && ( delay ) from < kernel().connection_manager.get_min_delay() );
   assert( from < to );
 
+  if ( P_.fast_forward_ && try_fast_forward_( from, to ) )
+  {
+    return;
+  }
+
   const double h = Time::get_resolution().get_ms();
   for ( long lag = from; lag < to; ++lag )
   {
@@ -343,6 +364,35 @@ nest::iaf_psc_delta::update( Time const& origin,
   }
 }
 
+bool
+nest::iaf_psc_delta::try_fast_forward_( const long from, const long to )
+{
+  if ( from != 0 || to != V_.ff_steps_ || S_.r_ != 0 || S_.y0_ != 0.0
+    || S_.refr_spikes_buffer_ != 0.0 || B_.logger_.has_loggers() )
+  {
+    return false;
+  }
+
+  if ( not( B_.spikes_.is_zero( from, to )
+         && B_.currents_.is_zero( from, to ) ) )
+  {
+    return false;
+  }
+
+  // Without input, the membrane potential relaxes monotonically from its
+  // initial value towards the steady state potential for I_e.
+  const double V_inf = P_.tau_m_ / P_.c_m_ * P_.I_e_;
+  if ( std::max( S_.y3_, V_inf ) >= P_.V_th_
+    || std::min( S_.y3_, V_inf ) < P_.V_min_ )
+  {
+    return false;
+  }
+
+  S_.y3_ = V_.ff_P30_ * P_.I_e_ + V_.ff_P33_ * S_.y3_;
+
+  return true;
+}
+
 void
 nest::iaf_psc_delta::handle( SpikeEvent& e )
 {
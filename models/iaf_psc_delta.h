@@ -104,6 +104,18 @@ namespace nest
    refractory_input bool - If true, do not discard input during
    refractory period. Default: false.
 
+   fast_forward bool - If true, advance the neuron analytically across
+   input-free time slices. Default: false.
+
+   If fast_forward is set, the neuron checks at the beginning of each
+   time slice of length min_delay whether it is free of input, i.e., not
+   refractory, without pending spikes or current input, and without
+   connected multimeter. If, in addition, the membrane potential relaxes
+   towards a value between V_min and threshold, the state is propagated
+   across the entire slice in one step using precomputed powers of the
+   propagator. Results are identical to step-wise integration up to
+   floating point rounding.
+
    References:
    [1] Rotter S & Diesmann M (1999) Exact digital simulation of time-invariant
    linear systems with applications to neuronal modeling. Biologial Cybernetics
@@ -158,6 +170,13 @@ private:
 
   void update( Time const&, const long, const long );
 
+  /**
+   * Propagate the state across an input-free slice [from, to) in one step.
+   * @returns false, without changing the state, if the slice is not
+   *          input-free or a threshold crossing cannot be excluded.
+   */
+  bool try_fast_forward_( const long, const long );
+
   // The next two classes need to be friends to access the State_ class/member
   friend class RecordablesMap< iaf_psc_delta >;
   friend class UniversalDataLogger< iaf_psc_delta >;
@@ -198,6 +217,9 @@ private:
     bool with_refr_input_; //!< spikes arriving during refractory period are
                            //!< counted
 
+    /** Advance analytically across input-free time slices. */
+    bool fast_forward_;
+
     Parameters_(); //!< Sets default parameter values
 
     void get( DictionaryDatum& ) const; //!< Store current values in dictionary
@@ -267,6 +289,11 @@ private:
     double P30_;
     double P33_;
 
+    // propagators for ff_steps_ time steps, used by try_fast_forward_()
+    long ff_steps_;
+    double ff_P30_;
+    double ff_P33_;
+
     int RefractoryCounts_;
   };
 
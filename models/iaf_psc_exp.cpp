@@ -23,6 +23,8 @@
 #include "iaf_psc_exp.h"
 
 // C++ includes:
+#include <algorithm>
+#include <cmath>
 #include <limits>
 
 // Includes from libnestutil:
@@ -33,6 +35,7 @@
 #include "event_delivery_manager_impl.h"
 #include "exceptions.h"
 #include "kernel_manager.h"
+#include "shared_parameters_impl.h"
 #include "universal_data_logger_impl.h"
 
 // Includes from sli:
@@ -78,11 +81,13 @@ nest::iaf_psc_exp::Parameters_::Parameters_()
   , V_reset_( -70.0 - E_L_ ) // in mV
   , tau_ex_( 2.0 )           // in ms
   , tau_in_( 2.0 )           // in ms
+  , fast_forward_( false )
 {
 }
 
 nest::iaf_psc_exp::State_::State_()
   : i_0_( 0.0 )
+  , i_1_( 0.0 )
   , i_syn_ex_( 0.0 )
   , i_syn_in_( 0.0 )
   , V_m_( 0.0 )
@@ -106,6 +111,7 @@ nest::iaf_psc_exp::Parameters_::get( DictionaryDatum& d ) const
   def< double >( d, names::tau_syn_ex, tau_ex_ );
   def< double >( d, names::tau_syn_in, tau_in_ );
   def< double >( d, names::t_ref, t_ref_ );
+  def< bool >( d, names::fast_forward, fast_forward_ );
 }
 
 double
@@ -141,6 +147,20 @@ nest::iaf_psc_exp::Parameters_::set( const DictionaryDatum& d )
   updateValue< double >( d, names::tau_syn_ex, tau_ex_ );
   updateValue< double >( d, names::tau_syn_in, tau_in_ );
   updateValue< double >( d, names::t_ref, t_ref_ );
+  updateValue< bool >( d, names::fast_forward, fast_forward_ );
+
+  // NaN would break the ordering of the blocks of shared parameters
+  const double values[] = {
+    E_L_, V_reset_, Theta_, I_e_, C_, Tau_, tau_ex_, tau_in_, t_ref_
+  };
+  for ( size_t i = 0; i < sizeof( values ) / sizeof( double ); ++i )
+  {
+    if ( std::isnan( values[ i ] ) )
+    {
+      throw BadProperty( "Parameters must not be NaN." );
+    }
+  }
+
   if ( V_reset_ >= Theta_ )
   {
     throw BadProperty( "Reset potential must be smaller than threshold." );
@@ -162,6 +182,33 @@ nest::iaf_psc_exp::Parameters_::set( const DictionaryDatum& d )
   return delta_EL;
 }
 
+bool
+nest::iaf_psc_exp::Parameters_::operator<( const Parameters_& p ) const
+{
+  const double lhs[] = { Tau_,
+    C_,
+    t_ref_,
+    E_L_,
+    I_e_,
+    Theta_,
+    V_reset_,
+    tau_ex_,
+    tau_in_,
+    static_cast< double >( fast_forward_ ) };
+  const double rhs[] = { p.Tau_,
+    p.C_,
+    p.t_ref_,
+    p.E_L_,
+    p.I_e_,
+    p.Theta_,
+    p.V_reset_,
+    p.tau_ex_,
+    p.tau_in_,
+    static_cast< double >( p.fast_forward_ ) };
+  const size_t n = sizeof( lhs ) / sizeof( double );
+  return std::lexicographical_compare( lhs, lhs + n, rhs, rhs + n );
+}
+
 void
 nest::iaf_psc_exp::State_::get( DictionaryDatum& d, const Parameters_& p ) const
 {
@@ -184,12 +231,16 @@ nest::iaf_psc_exp::State_::set( const DictionaryDatum& d,
 }
 
 nest::iaf_psc_exp::Buffers_::Buffers_( iaf_psc_exp& n )
-  : logger_( n )
+  : weighted_spikes_ex_( 0.0 )
+  , weighted_spikes_in_( 0.0 )
+  , logger_( n )
 {
 }
 
 nest::iaf_psc_exp::Buffers_::Buffers_( const Buffers_&, iaf_psc_exp& n )
-  : logger_( n )
+  : weighted_spikes_ex_( 0.0 )
+  , weighted_spikes_in_( 0.0 )
+  , logger_( n )
 {
 }
 
@@ -199,7 +250,7 @@ nest::iaf_psc_exp::Buffers_::Buffers_( const Buffers_&, iaf_psc_exp& n )
 
 nest::iaf_psc_exp::iaf_psc_exp()
   : Archiving_Node()
-  , P_()
+  , shared_()
   , S_()
   , B_( *this )
 {
@@ -208,7 +259,7 @@ nest::iaf_psc_exp::iaf_psc_exp()
 
 nest::iaf_psc_exp::iaf_psc_exp( const iaf_psc_exp& n )
   : Archiving_Node( n )
-  , P_( n.P_ )
+  , shared_( n.shared_ )
   , S_( n.S_ )
   , B_( n.B_, *this )
 {
@@ -242,6 +293,13 @@ nest::iaf_psc_exp::calibrate()
   // ensures initialization in case mm connected after Simulate
   B_.logger_.init();
 
+  // propagators are computed once for all neurons sharing the parameters
+  shared_.calibrate();
+}
+
+void
+nest::iaf_psc_exp::Variables_::calibrate( const Parameters_& p )
+{
   const double h = Time::get_resolution().get_ms();
 
   // numbering of state vaiables: i_0 = 0, i_syn_ = 1, V_m_ = 2
@@ -250,25 +308,45 @@ nest::iaf_psc_exp::calibrate()
   // needed to exactly reproduce Tsodyks network
 
   // these P are independent
-  V_.P11ex_ = std::exp( -h / P_.tau_ex_ );
+  P11ex_ = std::exp( -h / p.tau_ex_ );
   // P11ex_ = 1.0-h/tau_ex_;
 
-  V_.P11in_ = std::exp( -h / P_.tau_in_ );
+  P11in_ = std::exp( -h / p.tau_in_ );
   // P11in_ = 1.0-h/tau_in_;
 
-  V_.P22_ = std::exp( -h / P_.Tau_ );
+  P22_ = std::exp( -h / p.Tau_ );
   // P22_ = 1.0-h/Tau_;
 
   // these are determined according to a numeric stability criterion
-  V_.P21ex_ = propagator_32( P_.tau_ex_, P_.Tau_, P_.C_, h );
-  V_.P21in_ = propagator_32( P_.tau_in_, P_.Tau_, P_.C_, h );
+  P21ex_ = propagator_32( p.tau_ex_, p.Tau_, p.C_, h );
+  P21in_ = propagator_32( p.tau_in_, p.Tau_, p.C_, h );
 
   // P21ex_ = h/C_;
   // P21in_ = h/C_;
 
-  V_.P20_ = P_.Tau_ / P_.C_ * ( 1.0 - V_.P22_ );
+  P20_ = p.Tau_ / p.C_ * ( 1.0 - P22_ );
   // P20_ = h/C_;
 
+  // propagators across one time slice for try_fast_forward_(), obtained by
+  // applying the single-step propagators ff_steps_ times so that the result
+  // agrees with step-wise integration up to rounding
+  ff_steps_ = kernel().connection_manager.get_min_delay();
+  ff_P22_ = 1.0;
+  ff_P11ex_ = 1.0;
+  ff_P11in_ = 1.0;
+  ff_P21ex_ = 0.0;
+  ff_P21in_ = 0.0;
+  ff_P20_ = 0.0;
+  for ( long k = 0; k < ff_steps_; ++k )
+  {
+    ff_P21ex_ = P22_ * ff_P21ex_ + P21ex_ * ff_P11ex_;
+    ff_P21in_ = P22_ * ff_P21in_ + P21in_ * ff_P11in_;
+    ff_P20_ = P22_ * ff_P20_ + P20_;
+    ff_P22_ *= P22_;
+    ff_P11ex_ *= P11ex_;
+    ff_P11in_ *= P11in_;
+  }
+
   // t_ref_ specifies the length of the absolute refractory period as
   // a double in ms. The grid based iaf_psc_exp can only handle refractory
   // periods that are integer multiples of the computation step size (h).
@@ -286,25 +364,33 @@ nest::iaf_psc_exp::calibrate()
   // results. However, a neuron model capable of operating with real valued
   // spike time may exhibit a different effective refractory time.
 
-  V_.RefractoryCounts_ = Time( Time::ms( P_.t_ref_ ) ).get_steps();
+  RefractoryCounts_ = Time( Time::ms( p.t_ref_ ) ).get_steps();
   // since t_ref_ >= 0, this can only fail in error
-  assert( V_.RefractoryCounts_ >= 0 );
+  assert( RefractoryCounts_ >= 0 );
 }
 
 void
 nest::iaf_psc_exp::update( const Time& origin, const long from, const long to )
 {
+  const Parameters_& P = shared_.get_parameters();
+  const Variables_& V = shared_.get_variables();
+
   assert(
     to >= 0 && ( delay ) from < kernel().connection_manager.get_min_delay() );
   assert( from < to );
 
+  if ( P.fast_forward_ && try_fast_forward_( from, to ) )
+  {
+    return;
+  }
+
   // evolve from timestep 'from' to timestep 'to' with steps of h each
   for ( long lag = from; lag < to; ++lag )
   {
     if ( S_.r_ref_ == 0 ) // neuron not refractory, so evolve V
     {
-      S_.V_m_ = S_.V_m_ * V_.P22_ + S_.i_syn_ex_ * V_.P21ex_
-        + S_.i_syn_in_ * V_.P21in_ + ( P_.I_e_ + S_.i_0_ ) * V_.P20_;
+      S_.V_m_ = S_.V_m_ * V.P22_ + S_.i_syn_ex_ * V.P21ex_
+        + S_.i_syn_in_ * V.P21in_ + ( P.I_e_ + S_.i_0_ ) * V.P20_;
     }
     else
     {
@@ -312,25 +398,25 @@ nest::iaf_psc_exp::update( const Time& origin, const long from, const long to )
     } // neuron is absolute refractory
 
     // exponential decaying PSCs
-    S_.i_syn_ex_ *= V_.P11ex_;
-    S_.i_syn_in_ *= V_.P11in_;
+    S_.i_syn_ex_ *= V.P11ex_;
+    S_.i_syn_in_ *= V.P11in_;
 
     // add evolution of presynaptic input current
-    S_.i_syn_ex_ += ( 1. - V_.P11ex_ ) * S_.i_1_;
+    S_.i_syn_ex_ += ( 1. - V.P11ex_ ) * S_.i_1_;
 
     // the spikes arriving at T+1 have an immediate effect on the state of the
     // neuron
 
-    V_.weighted_spikes_ex_ = B_.spikes_ex_.get_value( lag );
-    V_.weighted_spikes_in_ = B_.spikes_in_.get_value( lag );
+    B_.weighted_spikes_ex_ = B_.spikes_ex_.get_value( lag );
+    B_.weighted_spikes_in_ = B_.spikes_in_.get_value( lag );
 
-    S_.i_syn_ex_ += V_.weighted_spikes_ex_;
-    S_.i_syn_in_ += V_.weighted_spikes_in_;
+    S_.i_syn_ex_ += B_.weighted_spikes_ex_;
+    S_.i_syn_in_ += B_.weighted_spikes_in_;
 
-    if ( S_.V_m_ >= P_.Theta_ ) // threshold crossing
+    if ( S_.V_m_ >= P.Theta_ ) // threshold crossing
     {
-      S_.r_ref_ = V_.RefractoryCounts_;
-      S_.V_m_ = P_.V_reset_;
+      S_.r_ref_ = V.RefractoryCounts_;
+      S_.V_m_ = P.V_reset_;
 
       set_spiketime( Time::step( origin.get_steps() + lag + 1 ) );
 
@@ -347,6 +433,48 @@ nest::iaf_psc_exp::update( const Time& origin, const long from, const long to )
   }
 }
 
+bool
+nest::iaf_psc_exp::try_fast_forward_( const long from, const long to )
+{
+  const Parameters_& P = shared_.get_parameters();
+  const Variables_& V = shared_.get_variables();
+
+  if ( from != 0 || to != V.ff_steps_ || S_.r_ref_ != 0 || S_.i_0_ != 0.0
+    || S_.i_1_ != 0.0 || B_.logger_.has_loggers() )
+  {
+    return false;
+  }
+
+  if ( not( B_.spikes_ex_.is_zero( from, to )
+         && B_.spikes_in_.is_zero( from, to )
+         && B_.currents_[ 0 ].is_zero( from, to )
+         && B_.currents_[ 1 ].is_zero( from, to ) ) )
+  {
+    return false;
+  }
+
+  // Without input, the synaptic currents decay monotonically, so the total
+  // current is bounded from above by its positive parts at the beginning of
+  // the slice. V_m then stays below the larger of its initial value and the
+  // steady state potential for that bound.
+  const double I_max = P.I_e_ + std::max( S_.i_syn_ex_, 0.0 )
+    + std::max( S_.i_syn_in_, 0.0 );
+  if ( std::max( S_.V_m_, P.Tau_ / P.C_ * I_max ) >= P.Theta_ )
+  {
+    return false;
+  }
+
+  S_.V_m_ = S_.V_m_ * V.ff_P22_ + S_.i_syn_ex_ * V.ff_P21ex_
+    + S_.i_syn_in_ * V.ff_P21in_ + P.I_e_ * V.ff_P20_;
+  S_.i_syn_ex_ *= V.ff_P11ex_;
+  S_.i_syn_in_ *= V.ff_P11in_;
+
+  B_.weighted_spikes_ex_ = 0.0;
+  B_.weighted_spikes_in_ = 0.0;
+
+  return true;
+}
+
 void
 nest::iaf_psc_exp::handle( SpikeEvent& e )
 {
@@ -30,6 +30,7 @@
 #include "nest_types.h"
 #include "recordables_map.h"
 #include "ring_buffer.h"
+#include "shared_parameters.h"
 #include "universal_data_logger.h"
 
 namespace nest
@@ -87,6 +88,8 @@ namespace nest
    V_reset      double - Reset membrane potential after a spike in mV.
    I_e          double - Constant input current in pA.
    t_spike      double - Point in time of last spike in ms.
+   fast_forward bool   - If true, advance the neuron analytically across
+                         input-free time slices (default: false).
 
 Remarks:
 
@@ -104,6 +107,15 @@ Remarks:
    kernel with the time constant of the excitatory synapse,
    tau_syn_ex. For an example application, see [4].
 
+   If fast_forward is set, the neuron checks at the beginning of each
+   time slice of length min_delay whether it is free of input, i.e., not
+   refractory, without pending spikes or current input, and without
+   connected multimeter. If, in addition, an upper bound on the membrane
+   potential over the slice lies below threshold, the state is propagated
+   across the entire slice in one step using precomputed powers of the
+   propagator. Results are identical to step-wise integration up to
+   floating point rounding.
+
    References:
    [1] Misha Tsodyks, Asher Uziel, and Henry Markram (2000) Synchrony Generation
    in Recurrent Networks with Frequency-Dependent Synapses, The Journal of
@@ -166,6 +178,13 @@ private:
 
   void update( const Time&, const long, const long );
 
+  /**
+   * Propagate the state across an input-free slice [from, to) in one step.
+   * @returns false, without changing the state, if the slice is not
+   *          input-free or a threshold crossing cannot be excluded.
+   */
+  bool try_fast_forward_( const long, const long );
+
   // The next two classes need to be friends to access the State_ class/member
   friend class RecordablesMap< iaf_psc_exp >;
   friend class UniversalDataLogger< iaf_psc_exp >;
@@ -206,6 +225,9 @@ private:
     /** Time constant of inhibitory synaptic current in ms. */
     double tau_in_;
 
+    /** Advance analytically across input-free time slices. */
+    bool fast_forward_;
+
     Parameters_(); //!< Sets default parameter values
 
     void get( DictionaryDatum& ) const; //!< Store current values in dictionary
@@ -214,6 +236,9 @@ private:
      * @returns Change in reversal potential E_L, to be passed to State_::set()
      */
     double set( const DictionaryDatum& );
+
+    //! Order parameter sets for sharing, see SharedParameters
+    bool operator<( const Parameters_& ) const;
   };
 
   // ----------------------------------------------------------------
@@ -261,6 +286,10 @@ private:
     RingBuffer spikes_in_;
     std::vector< RingBuffer > currents_;
 
+    //! Spike input in the last time step, for recording
+    double weighted_spikes_ex_;
+    double weighted_spikes_in_;
+
     //! Logger for all analog data
     UniversalDataLogger< iaf_psc_exp > logger_;
   };
@@ -269,6 +298,7 @@ private:
 
   /**
    * Internal variables of the model.
+   * They depend only on the parameters and are shared with them.
    */
   struct Variables_
   {
@@ -287,10 +317,19 @@ private:
     double P21in_;
     double P22_;
 
-    double weighted_spikes_ex_;
-    double weighted_spikes_in_;
+    // propagators for ff_steps_ time steps, used by try_fast_forward_()
+    long ff_steps_;
+    double ff_P20_;
+    double ff_P11ex_;
+    double ff_P11in_;
+    double ff_P21ex_;
+    double ff_P21in_;
+    double ff_P22_;
 
     int RefractoryCounts_;
+
+    //! Compute propagators for the given parameters
+    void calibrate( const Parameters_& );
   };
 
   // Access functions for UniversalDataLogger -------------------------------
@@ -299,19 +338,19 @@ private:
   inline double
   get_V_m_() const
   {
-    return S_.V_m_ + P_.E_L_;
+    return S_.V_m_ + shared_.get_parameters().E_L_;
   }
 
   inline double
   get_weighted_spikes_ex_() const
   {
-    return V_.weighted_spikes_ex_;
+    return B_.weighted_spikes_ex_;
   }
 
   inline double
   get_weighted_spikes_in_() const
   {
-    return V_.weighted_spikes_in_;
+    return B_.weighted_spikes_in_;
   }
 
   inline double
@@ -335,9 +374,9 @@ private:
    * @note The order of definitions is important for speed.
    * @{
    */
-  Parameters_ P_;
+  //! Parameters and internal variables, shared by identical neurons
+  SharedParameters< Parameters_, Variables_ > shared_;
   State_ S_;
-  Variables_ V_;
   Buffers_ B_;
   /** @} */
 
@@ -397,8 +436,9 @@ iaf_psc_exp::handles_test_event( DataLoggingRequest& dlr, rport receptor_type )
 inline void
 iaf_psc_exp::get_status( DictionaryDatum& d ) const
 {
-  P_.get( d );
-  S_.get( d, P_ );
+  const Parameters_& p = shared_.get_parameters();
+  p.get( d );
+  S_.get( d, p );
   Archiving_Node::get_status( d );
 
   ( *d )[ names::recordables ] = recordablesMap_.get_list();
@@ -407,7 +447,7 @@ iaf_psc_exp::get_status( DictionaryDatum& d ) const
 inline void
 iaf_psc_exp::set_status( const DictionaryDatum& d )
 {
-  Parameters_ ptmp = P_;                 // temporary copy in case of errors
+  Parameters_ ptmp = shared_.get_parameters(); // temporary copy
   const double delta_EL = ptmp.set( d ); // throws if BadProperty
   State_ stmp = S_;                      // temporary copy in case of errors
   stmp.set( d, ptmp, delta_EL );         // throws if BadProperty
@@ -418,8 +458,9 @@ iaf_psc_exp::set_status( const DictionaryDatum& d )
   // consistent.
   Archiving_Node::set_status( d );
 
-  // if we get here, temporaries contain consistent set of properties
-  P_ = ptmp;
+  // if we get here, temporaries contain consistent set of properties;
+  // this node stops sharing parameters with others if they differ
+  shared_.set_parameters( ptmp );
   S_ = stmp;
 }
 
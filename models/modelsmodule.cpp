@@ -98,9 +98,12 @@
 #include "poisson_generator.h"
 #include "ppd_sup_generator.h"
 #include "pulsepacket_generator.h"
+#include "shm_current_generator.h"
+#include "shm_spike_generator.h"
 #include "sinusoidal_gamma_generator.h"
 #include "sinusoidal_poisson_generator.h"
 #include "spike_generator.h"
+#include "spike_replay_generator.h"
 #include "step_current_generator.h"
 
 // Recording devices
@@ -108,7 +111,9 @@
 #include "correlomatrix_detector.h"
 #include "correlospinmatrix_detector.h"
 #include "multimeter.h"
+#include "population_multimeter.h"
 #include "spike_detector.h"
+#include "spike_statistics_detector.h"
 #include "spin_detector.h"
 #include "weight_recorder.h"
 
@@ -269,6 +274,12 @@ ModelsModule::init( SLIInterpreter* )
     "ppd_sup_generator" );
   kernel().model_manager.register_node_model< gamma_sup_generator >(
     "gamma_sup_generator" );
+  kernel().model_manager.register_node_model< shm_spike_generator >(
+    "shm_spike_generator" );
+  kernel().model_manager.register_node_model< shm_current_generator >(
+    "shm_current_generator" );
+  kernel().model_manager.register_node_model< spike_replay_generator >(
+    "spike_replay_generator" );
   kernel().model_manager.register_node_model< ginzburg_neuron >(
     "ginzburg_neuron" );
   kernel().model_manager.register_node_model< mcculloch_pitts_neuron >(
@@ -279,11 +290,15 @@ ModelsModule::init( SLIInterpreter* )
 
   kernel().model_manager.register_node_model< spike_detector >(
     "spike_detector" );
+  kernel().model_manager.register_node_model< spike_statistics_detector >(
+    "spike_statistics_detector" );
   kernel().model_manager.register_node_model< weight_recorder >(
     "weight_recorder" );
   kernel().model_manager.register_node_model< spin_detector >(
     "spin_detector" );
   kernel().model_manager.register_node_model< Multimeter >( "multimeter" );
+  kernel().model_manager.register_node_model< PopulationMultimeter >(
+    "population_multimeter" );
   kernel().model_manager.register_node_model< correlation_detector >(
     "correlation_detector" );
   kernel().model_manager.register_node_model< correlomatrix_detector >(
@@ -224,6 +224,7 @@ Multimeter::update( Time const& origin, const long from, const long )
     B_.has_targets_ && not P_.record_from_.empty(); // no targets, no request
   DataLoggingRequest req;
   kernel().event_delivery_manager.send( *this, req );
+  device_.publish_records();
 }
 
 void
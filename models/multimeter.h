@@ -172,6 +172,15 @@ public:
     return false;
   }
 
+  /**
+   * Requests only data logged by its targets in the previous slice.
+   */
+  bool
+  independent_of_delivery() const
+  {
+    return true;
+  }
+
   /**
    * Import sets of overloaded virtual functions.
    * @see Technical Issues / Virtual Functions: Overriding, Overloading, and
@@ -194,6 +203,11 @@ protected:
   void init_state_( Node const& );
   void init_buffers_();
   void calibrate();
+  bool
+  is_run_dependent() const
+  {
+    return true;
+  }
   void post_run_cleanup();
   void finalize();
 
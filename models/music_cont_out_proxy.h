@@ -137,6 +137,11 @@ protected:
   void init_state_( Node const& );
   void init_buffers_();
   void calibrate();
+  bool
+  is_run_dependent() const
+  {
+    return true;
+  }
   void finalize();
 
   /**
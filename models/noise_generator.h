@@ -125,6 +125,12 @@ public:
     return false;
   }
 
+  bool
+  independent_of_delivery() const
+  {
+    return true;
+  }
+
   /**
    * Import sets of overloaded virtual functions.
    * @see Technical Issues / Virtual Functions: Overriding, Overloading, and
@@ -162,6 +168,11 @@ private:
    * of amplitudes if number of targets has changed.
    */
   void calibrate();
+  bool
+  is_run_dependent() const
+  {
+    return true;
+  }
 
   void update( Time const&, const long, const long );
   void event_hook( DSCurrentEvent& );
@@ -117,6 +117,12 @@ public:
     return false;
   }
 
+  bool
+  independent_of_delivery() const
+  {
+    return true;
+  }
+
   /**
    * Import sets of overloaded virtual functions.
    * @see Technical Issues / Virtual Functions: Overriding, Overloading, and
@@ -0,0 +1,320 @@
+/*
+ *  population_multimeter.cpp
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "population_multimeter.h"
+
+// C++ includes:
+#include <algorithm>
+#include <limits>
+
+// Includes from nestkernel:
+#include "kernel_manager.h"
+#include "sibling_container.h"
+
+// Includes from sli:
+#include "arraydatum.h"
+
+namespace nest
+{
+PopulationMultimeter::PopulationMultimeter()
+  : Node()
+  , device_()
+  , P_()
+  , S_()
+  , B_()
+{
+}
+
+PopulationMultimeter::PopulationMultimeter( const PopulationMultimeter& n )
+  : Node( n )
+  , device_( n.device_ )
+  , P_( n.P_ )
+  , S_()
+  , B_()
+{
+}
+
+port
+PopulationMultimeter::send_test_event( Node& target,
+  rport receptor_type,
+  synindex,
+  bool dummy_target )
+{
+  if ( dummy_target || is_model_prototype() )
+  {
+    DataLoggingRequest e( P_.interval_, P_.offset_, P_.record_from_ );
+    e.set_sender( *this );
+    return target.handles_test_event( e, receptor_type );
+  }
+
+  // The target registers the buffer and its column with its data logger.
+  DataLoggingRequest e(
+    P_.interval_, P_.offset_, P_.record_from_, S_.data_, B_.targets_.size() );
+  e.set_sender( *this );
+  const port p = target.handles_test_event( e, receptor_type );
+  if ( p != invalid_port_ )
+  {
+    B_.targets_.push_back( target.get_gid() );
+  }
+  return p;
+}
+
+nest::PopulationMultimeter::Parameters_::Parameters_()
+  : interval_( Time::ms( 1.0 ) )
+  , offset_( Time::ms( 0. ) )
+  , record_from_()
+{
+}
+
+nest::PopulationMultimeter::Parameters_::Parameters_( const Parameters_& p )
+  : interval_( p.interval_ )
+  , offset_( p.offset_ )
+  , record_from_( p.record_from_ )
+{
+  interval_.calibrate();
+  offset_.calibrate();
+}
+
+void
+nest::PopulationMultimeter::Parameters_::get( DictionaryDatum& d ) const
+{
+  ( *d )[ names::interval ] = interval_.get_ms();
+  ( *d )[ names::offset ] = offset_.get_ms();
+  ArrayDatum ad;
+  for ( size_t j = 0; j < record_from_.size(); ++j )
+  {
+    ad.push_back( LiteralDatum( record_from_[ j ] ) );
+  }
+  ( *d )[ names::record_from ] = ad;
+}
+
+void
+nest::PopulationMultimeter::Parameters_::set( const DictionaryDatum& d,
+  const Buffers_& b )
+{
+  if ( not b.targets_.empty()
+    && ( d->known( names::interval ) || d->known( names::offset )
+         || d->known( names::record_from ) ) )
+  {
+    throw BadProperty(
+      "The recording interval, the interval offset and the list of properties "
+      "to record cannot be changed after the population_multimeter has been "
+      "connected to nodes." );
+  }
+
+  double v;
+  if ( updateValue< double >( d, names::interval, v ) )
+  {
+    if ( Time( Time::ms( v ) ) < Time::get_resolution() )
+    {
+      throw BadProperty(
+        "The sampling interval must be at least as long "
+        "as the simulation resolution." );
+    }
+
+    interval_ = Time::step( Time( Time::ms( v ) ).get_steps() );
+    if ( not interval_.is_multiple_of( Time::get_resolution() ) )
+    {
+      throw BadProperty(
+        "The sampling interval must be a multiple of "
+        "the simulation resolution" );
+    }
+  }
+
+  if ( updateValue< double >( d, names::offset, v ) )
+  {
+    if ( v != 0 && Time( Time::ms( v ) ) < Time::get_resolution() )
+    {
+      throw BadProperty(
+        "The offset for the sampling interval must be at least as long as the "
+        "simulation resolution." );
+    }
+
+    offset_ = Time::step( Time( Time::ms( v ) ).get_steps() );
+    if ( not offset_.is_multiple_of( Time::get_resolution() ) )
+    {
+      throw BadProperty(
+        "The offset for the sampling interval must be a multiple of the "
+        "simulation resolution" );
+    }
+  }
+
+  if ( d->known( names::record_from ) )
+  {
+    record_from_.clear();
+
+    ArrayDatum ad = getValue< ArrayDatum >( d, names::record_from );
+    for ( Token* t = ad.begin(); t != ad.end(); ++t )
+    {
+      record_from_.push_back( Name( getValue< std::string >( *t ) ) );
+    }
+  }
+}
+
+void
+PopulationMultimeter::init_state_( const Node& np )
+{
+  const PopulationMultimeter& pm =
+    dynamic_cast< const PopulationMultimeter& >( np );
+  device_.init_state( pm.device_ );
+  S_.data_.clear();
+}
+
+void
+PopulationMultimeter::init_buffers_()
+{
+  device_.init_buffers();
+}
+
+void
+PopulationMultimeter::calibrate()
+{
+  device_.calibrate();
+  S_.data_.configure( B_.targets_.size(),
+    P_.record_from_.size(),
+    P_.interval_.get_steps(),
+    device_.get_t_min_(),
+    device_.get_t_max_() );
+}
+
+void
+PopulationMultimeter::get_status( DictionaryDatum& d ) const
+{
+  device_.get_status( d );
+  P_.get( d );
+
+  if ( not is_model_prototype() )
+  {
+    add_data_( d );
+  }
+
+  ( *d )[ names::element_type ] = LiteralDatum( names::recorder );
+}
+
+void
+PopulationMultimeter::set_status( const DictionaryDatum& d )
+{
+  Parameters_ ptmp = P_;
+  ptmp.set( d, B_ );
+
+  long n_events;
+  if ( updateValue< long >( d, names::n_events, n_events ) )
+  {
+    if ( n_events != 0 )
+    {
+      throw BadProperty(
+        "Property n_events can only be set to 0 (which clears all stored "
+        "data)." );
+    }
+    S_.data_.clear();
+  }
+
+  device_.set_status( d );
+  P_ = ptmp;
+}
+
+void
+PopulationMultimeter::add_data_( DictionaryDatum& d ) const
+{
+  // collect the instances of this device on all threads
+  std::vector< const PopulationMultimeter* > instances;
+  const SiblingContainer* siblings =
+    kernel().node_manager.get_thread_siblings( get_gid() );
+  for ( std::vector< Node* >::const_iterator sibling = siblings->begin();
+        sibling != siblings->end();
+        ++sibling )
+  {
+    instances.push_back(
+      dynamic_cast< const PopulationMultimeter* >( *sibling ) );
+  }
+
+  // columns of all threads, sorted by gid, and common time axis
+  std::vector< std::pair< index, std::pair< size_t, size_t > > > columns;
+  long first_stamp = std::numeric_limits< long >::max();
+  long last_stamp = std::numeric_limits< long >::min();
+  const long interval = P_.interval_.get_steps();
+  for ( size_t i = 0; i < instances.size(); ++i )
+  {
+    const std::vector< index >& targets = instances[ i ]->B_.targets_;
+    for ( size_t c = 0; c < targets.size(); ++c )
+    {
+      columns.push_back(
+        std::make_pair( targets[ c ], std::make_pair( i, c ) ) );
+    }
+
+    const PopulationDataBuffer& buf = instances[ i ]->S_.data_;
+    if ( buf.get_num_rows() > 0 )
+    {
+      first_stamp = std::min( first_stamp, buf.get_first_stamp() );
+      last_stamp = std::max( last_stamp,
+        buf.get_first_stamp()
+          + static_cast< long >( buf.get_num_rows() - 1 ) * interval );
+    }
+  }
+  std::sort( columns.begin(), columns.end() );
+
+  const size_t n_rows = first_stamp <= last_stamp
+    ? ( last_stamp - first_stamp ) / interval + 1
+    : 0;
+  const size_t n_cols = columns.size();
+  const size_t n_vars = P_.record_from_.size();
+
+  std::vector< double >* times = new std::vector< double >( n_rows );
+  for ( size_t r = 0; r < n_rows; ++r )
+  {
+    ( *times )[ r ] = Time( Time::step( first_stamp + r * interval ) ).get_ms();
+  }
+
+  std::vector< long >* senders = new std::vector< long >( n_cols );
+  std::vector< double >* data = new std::vector< double >(
+    n_rows * n_cols * n_vars, std::numeric_limits< double >::quiet_NaN() );
+  for ( size_t c = 0; c < n_cols; ++c )
+  {
+    ( *senders )[ c ] = columns[ c ].first;
+
+    const PopulationDataBuffer& buf =
+      instances[ columns[ c ].second.first ]->S_.data_;
+    const size_t src_col = columns[ c ].second.second;
+    if ( buf.get_num_rows() == 0 || src_col >= buf.get_num_columns() )
+    {
+      continue; // connected after the last Prepare, no data yet
+    }
+
+    const size_t row_offset = ( buf.get_first_stamp() - first_stamp ) / interval;
+    for ( size_t r = 0; r < buf.get_num_rows(); ++r )
+    {
+      const double* src = buf.get_row( r ) + src_col * n_vars;
+      std::copy( src,
+        src + n_vars,
+        data->begin() + ( ( r + row_offset ) * n_cols + c ) * n_vars );
+    }
+  }
+
+  DictionaryDatum events( new Dictionary );
+  ( *events )[ names::times ] = DoubleVectorDatum( times );
+  ( *events )[ names::senders ] = IntVectorDatum( senders );
+  ( *events )[ names::data ] = DoubleVectorDatum( data );
+  ( *d )[ names::events ] = events;
+  ( *d )[ names::n_events ] = static_cast< long >( n_rows );
+}
+
+} // namespace
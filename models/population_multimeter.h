@@ -0,0 +1,213 @@
+/*
+ *  population_multimeter.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef POPULATION_MULTIMETER_H
+#define POPULATION_MULTIMETER_H
+
+// C++ includes:
+#include <vector>
+
+// Includes from nestkernel:
+#include "event.h"
+#include "exceptions.h"
+#include "node.h"
+#include "population_data_buffer.h"
+#include "pseudo_recording_device.h"
+
+// Includes from sli:
+#include "dictutils.h"
+#include "name.h"
+
+/*BeginDocumentation
+Name: population_multimeter - Device to sample analog data from many neurons.
+
+Synopsis: population_multimeter Create
+
+Description:
+A population_multimeter records a user-defined set of state variables from
+connected nodes at regular intervals, like the multimeter. It is intended
+for recording from large populations: instead of exchanging
+DataLoggingRequest and DataLoggingReply events with every node in every
+time slice, each connected node writes its values directly into a
+contiguous matrix held by the population_multimeter on the node's thread.
+
+Data is only recorded to memory. The /events entry of the status dictionary
+contains
+
+  times    - times of the samples in ms, one per row of the matrix
+  senders  - global ids of the recorded nodes, in ascending order, one per
+             column of the matrix
+  data     - all samples as a single vector of doubles in time x node x
+             variable order, i.e., the value of variable v of node n at
+             time t is found at index (t * N + n) * V + v, where N is the
+             number of recorded nodes and V the number of entries in
+             /record_from.
+
+Values of nodes that have not been updated at a sampling time, e.g.,
+because they were frozen, are NaN. Set /n_events to 0 to clear the data.
+
+In PyNEST, GetPopulationData() returns the data as an array of shape
+(time, node, variable).
+
+Remarks:
+ - The set of variables to record, the recording interval and the offset
+   must be set BEFORE the population_multimeter is connected to any node
+   and cannot be changed afterwards.
+ - A population_multimeter can only be connected once to a given node.
+
+Parameters:
+     interval     double - Recording interval in ms
+     offset       double - Offset of the recording interval in ms
+     record_from  array  - Array containing the names of variables to record
+                           from, obtained from the /recordables entry of the
+                           model from which one wants to record
+     n_events     int    - Number of samples recorded, set to 0 to clear data
+
+Examples:
+SLI ] /iaf_psc_alpha 1000 Create pop /nrns [ 1 1000 ] Range def
+SLI ] /population_multimeter << /record_from [ /V_m ] /interval 0.5 >> Create
+SLI ] /pm Set
+SLI ] pm nrns Connect
+SLI ] 100 Simulate
+SLI ] pm /events get /data get length ==
+200000
+
+Sends: DataLoggingRequest
+
+FirstVersion: October 2026
+
+SeeAlso: multimeter, Device, PseudoRecordingDevice
+*/
+
+namespace nest
+{
+/**
+ * Sampling of analog data from a population of nodes.
+ *
+ * When connecting to a node, the device passes a PopulationDataBuffer and
+ * the column assigned to the node with the DataLoggingRequest test event.
+ * The UniversalDataLogger of the node resolves the access functions of the
+ * recorded variables once and then writes the values into that column at
+ * each sampling time. The buffer is laid out at Prepare. Since each thread
+ * has its own instance of the device, the buffer is only written by the
+ * thread owning it. The data of all threads is merged on GetStatus.
+ *
+ * @ingroup Devices
+ * @see Multimeter, UniversalDataLogger
+ */
+class PopulationMultimeter : public Node
+{
+
+public:
+  PopulationMultimeter();
+  PopulationMultimeter( const PopulationMultimeter& );
+
+  /**
+   * @note Population multimeters never have proxies, since their targets
+   *       write data directly into them.
+   */
+  bool
+  has_proxies() const
+  {
+    return false;
+  }
+
+  using Node::handles_test_event;
+  using Node::sends_signal;
+
+  port send_test_event( Node&, rport, synindex, bool );
+
+  SignalType sends_signal() const;
+
+  void get_status( DictionaryDatum& ) const;
+  void set_status( const DictionaryDatum& );
+
+protected:
+  void init_state_( Node const& );
+  void init_buffers_();
+  void calibrate();
+
+  /**
+   * Nothing to do, the recorded nodes write their data directly.
+   */
+  void
+  update( Time const&, const long, const long )
+  {
+  }
+
+private:
+  /**
+   * Merge data of all threads and store it in the events dictionary.
+   */
+  void add_data_( DictionaryDatum& ) const;
+
+  // ------------------------------------------------------------
+
+  PseudoRecordingDevice device_;
+
+  // ------------------------------------------------------------
+
+  struct Buffers_;
+
+  struct Parameters_
+  {
+    Time interval_; //!< recording interval, in ms
+    Time offset_;   //!< offset relative to which interval is calculated, in ms
+    std::vector< Name > record_from_; //!< which data to record
+
+    Parameters_();
+    Parameters_( const Parameters_& );
+    void get( DictionaryDatum& ) const;
+    void set( const DictionaryDatum&, const Buffers_& );
+  };
+
+  // ------------------------------------------------------------
+
+  struct State_
+  {
+    PopulationDataBuffer data_; //!< recorded data of nodes on this thread
+  };
+
+  // ------------------------------------------------------------
+
+  struct Buffers_
+  {
+    //! GIDs of recorded nodes on this thread, index is column in S_.data_
+    std::vector< index > targets_;
+  };
+
+  // ------------------------------------------------------------
+
+  Parameters_ P_;
+  State_ S_;
+  Buffers_ B_;
+};
+
+inline SignalType
+PopulationMultimeter::sends_signal() const
+{
+  return ALL;
+}
+
+} // namespace
+
+#endif /* #ifndef POPULATION_MULTIMETER_H */
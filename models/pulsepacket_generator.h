@@ -88,6 +88,12 @@ public:
     return true;
   }
 
+  bool
+  independent_of_delivery() const
+  {
+    return true;
+  }
+
   port send_test_event( Node&, rport, synindex, bool );
 
   void get_status( DictionaryDatum& ) const;
@@ -97,6 +103,11 @@ private:
   void init_state_( const Node& );
   void init_buffers_();
   void calibrate();
+  bool
+  is_run_dependent() const
+  {
+    return true;
+  }
 
   void create_pulse();
   void update( Time const&, const long, const long );
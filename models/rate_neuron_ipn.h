@@ -105,6 +105,15 @@ public:
   {
   }
 
+  /**
+   * Rate input can be computed by the RateNetworkEngine.
+   */
+  bool
+  supports_rate_engine() const
+  {
+    return true;
+  }
+
   void get_status( DictionaryDatum& ) const;
   void set_status( const DictionaryDatum& );
 
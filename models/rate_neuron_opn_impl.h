@@ -39,6 +39,7 @@
 // Includes from nestkernel:
 #include "exceptions.h"
 #include "kernel_manager.h"
+#include "rate_network_engine.h"
 #include "universal_data_logger_impl.h"
 
 // Includes from sli:
@@ -248,6 +249,34 @@ nest::rate_neuron_opn< TNonlinearities >::update_( Time const& origin,
   // allocate memory to store rates to be sent by rate events
   std::vector< double > new_rates( buffer_size, 0.0 );
 
+  // with the rate network engine, all input is collected at once
+  RateNetworkEngine& engine = kernel().event_delivery_manager.get_rate_engine();
+  if ( engine.is_active() )
+  {
+    if ( P_.linear_summation_ )
+    {
+      engine.add_input( get_thread(),
+        get_thread_lid(),
+        origin,
+        from,
+        to,
+        RateIdentityInput(),
+        B_.instant_rates_ex_,
+        B_.instant_rates_in_ );
+    }
+    else
+    {
+      engine.add_input( get_thread(),
+        get_thread_lid(),
+        origin,
+        from,
+        to,
+        RateNonlinearInput< TNonlinearities >( nonlinearities_ ),
+        B_.instant_rates_ex_,
+        B_.instant_rates_in_ );
+    }
+  }
+
   for ( long lag = from; lag < to; ++lag )
   {
     // get noise
@@ -330,9 +359,16 @@ nest::rate_neuron_opn< TNonlinearities >::update_( Time const& origin,
   {
     // Send delay-rate-neuron-event. This only happens in the final iteration
     // to avoid accumulation in the buffers of the receiving neurons.
-    DelayedRateConnectionEvent drve;
-    drve.set_coeffarray( new_rates );
-    kernel().event_delivery_manager.send_secondary( *this, drve );
+    if ( engine.is_active() )
+    {
+      engine.store_delayed_rates( get_gid(), origin, from, to, new_rates );
+    }
+    else
+    {
+      DelayedRateConnectionEvent drve;
+      drve.set_coeffarray( new_rates );
+      kernel().event_delivery_manager.send_secondary( *this, drve );
+    }
 
     // clear last_y_values
     std::vector< double >( buffer_size, 0.0 ).swap( B_.last_y_values );
@@ -351,9 +387,16 @@ nest::rate_neuron_opn< TNonlinearities >::update_( Time const& origin,
   }
 
   // Send rate-neuron-event
-  InstantaneousRateConnectionEvent rve;
-  rve.set_coeffarray( new_rates );
-  kernel().event_delivery_manager.send_secondary( *this, rve );
+  if ( engine.is_active() )
+  {
+    engine.store_instantaneous_rates( get_gid(), from, to, new_rates );
+  }
+  else
+  {
+    InstantaneousRateConnectionEvent rve;
+    rve.set_coeffarray( new_rates );
+    kernel().event_delivery_manager.send_secondary( *this, rve );
+  }
 
   // Reset variables
   std::vector< double >( buffer_size, 0.0 ).swap( B_.instant_rates_ex_ );
@@ -0,0 +1,253 @@
+/*
+ *  shm_current_generator.cpp
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "shm_current_generator.h"
+
+// C++ includes:
+#include <cstring>
+
+// Includes from nestkernel:
+#include "event_delivery_manager_impl.h"
+#include "kernel_manager.h"
+#include "universal_data_logger_impl.h"
+
+// Includes from sli:
+#include "dict.h"
+#include "dictutils.h"
+#include "integerdatum.h"
+#include "stringdatum.h"
+
+namespace nest
+{
+RecordablesMap< shm_current_generator > shm_current_generator::recordablesMap_;
+
+template <>
+void
+RecordablesMap< shm_current_generator >::create()
+{
+  insert_( Name( names::I ), &shm_current_generator::get_I_ );
+}
+}
+
+/* ----------------------------------------------------------------
+ * Default constructors defining default parameter
+ * ---------------------------------------------------------------- */
+
+nest::shm_current_generator::Parameters_::Parameters_()
+  : shm_name_()
+  , shm_buffer_size_( 1 << 20 )
+{
+}
+
+nest::shm_current_generator::State_::State_()
+  : I_( 0.0 ) // pA
+{
+}
+
+nest::shm_current_generator::Buffers_::Buffers_( shm_current_generator& n )
+  : ring_()
+  , record_()
+  , pending_()
+  , amp_( 0 )
+  , logger_( n )
+{
+}
+
+nest::shm_current_generator::Buffers_::Buffers_( const Buffers_&,
+  shm_current_generator& n )
+  : ring_()
+  , record_()
+  , pending_()
+  , amp_( 0 )
+  , logger_( n )
+{
+}
+
+/* ----------------------------------------------------------------
+ * Parameter extraction and manipulation functions
+ * ---------------------------------------------------------------- */
+
+void
+nest::shm_current_generator::Parameters_::get( DictionaryDatum& d ) const
+{
+  ( *d )[ names::shm_name ] = shm_name_;
+  ( *d )[ names::shm_buffer_size ] = shm_buffer_size_;
+}
+
+void
+nest::shm_current_generator::Parameters_::set( const DictionaryDatum& d )
+{
+  updateValue< std::string >( d, names::shm_name, shm_name_ );
+  if ( not shm_name_.empty() and shm_name_[ 0 ] != '/' )
+  {
+    throw BadProperty( "shm_name must start with a slash." );
+  }
+
+  updateValue< long >( d, names::shm_buffer_size, shm_buffer_size_ );
+  if ( shm_buffer_size_ < 64 )
+  {
+    throw BadProperty( "shm_buffer_size must be >= 64." );
+  }
+}
+
+
+/* ----------------------------------------------------------------
+ * Default and copy constructor for node
+ * ---------------------------------------------------------------- */
+
+nest::shm_current_generator::shm_current_generator()
+  : Node()
+  , device_()
+  , P_()
+  , S_()
+  , B_( *this )
+{
+  recordablesMap_.create();
+}
+
+nest::shm_current_generator::shm_current_generator(
+  const shm_current_generator& n )
+  : Node( n )
+  , device_( n.device_ )
+  , P_( n.P_ )
+  , S_( n.S_ )
+  , B_( n.B_, *this )
+{
+}
+
+
+/* ----------------------------------------------------------------
+ * Node initialization functions
+ * ---------------------------------------------------------------- */
+
+void
+nest::shm_current_generator::init_state_( const Node& proto )
+{
+  const shm_current_generator& pr = downcast< shm_current_generator >( proto );
+
+  device_.init_state( pr.device_ );
+}
+
+void
+nest::shm_current_generator::init_buffers_()
+{
+  device_.init_buffers();
+  B_.logger_.reset();
+
+  // records already read are discarded, those still in the ring are kept
+  B_.pending_.clear();
+  B_.amp_ = 0;
+}
+
+void
+nest::shm_current_generator::calibrate()
+{
+  B_.logger_.init();
+
+  device_.calibrate();
+
+  if ( P_.shm_name_.empty() )
+  {
+    B_.ring_.close();
+  }
+  else if ( not B_.ring_.is_open() or B_.ring_.get_name() != P_.shm_name_ )
+  {
+    // each thread has its own instance, which reads as reader get_thread()
+    B_.ring_.attach_or_create( P_.shm_name_,
+      P_.shm_buffer_size_,
+      kernel().vp_manager.get_num_threads() );
+  }
+}
+
+
+/* ----------------------------------------------------------------
+ * Update function and event hook
+ * ---------------------------------------------------------------- */
+
+void
+nest::shm_current_generator::update( Time const& origin,
+  const long from,
+  const long to )
+{
+  assert(
+    to >= 0 && ( delay ) from < kernel().connection_manager.get_min_delay() );
+  assert( from < to );
+
+  const long t0 = origin.get_steps();
+
+  if ( B_.ring_.is_open() )
+  {
+    const long t_origin = device_.get_origin().get_steps();
+
+    ShmRingBuffer::RecordType type;
+    while ( B_.ring_.read( get_thread(), type, B_.record_ ) )
+    {
+      if ( type == ShmRingBuffer::CURRENT and B_.record_.size() >= 16 )
+      {
+        double v[ 2 ];
+        std::memcpy( v, &B_.record_[ 0 ], sizeof( v ) );
+        B_.pending_.push_back( std::make_pair(
+          t_origin + Time( Time::ms_stamp( v[ 0 ] ) ).get_steps(), v[ 1 ] ) );
+      }
+      else if ( type == ShmRingBuffer::EVENT and B_.record_.size() >= 40 )
+      {
+        int64_t step;
+        double value;
+        std::memcpy( &step, &B_.record_[ 8 ], sizeof( step ) );
+        std::memcpy( &value, &B_.record_[ 32 ], sizeof( value ) );
+        B_.pending_.push_back( std::make_pair( t_origin + step, value ) );
+      }
+    }
+  }
+
+  for ( long offs = from; offs < to; ++offs )
+  {
+    const long curr_time = t0 + offs;
+
+    S_.I_ = 0.0;
+
+    // We need to change the amplitude one step ahead of time, see comment
+    // on class StimulatingDevice. Late changes take effect immediately.
+    while ( not B_.pending_.empty()
+      && B_.pending_.front().first <= curr_time + 1 )
+    {
+      B_.amp_ = B_.pending_.front().second;
+      B_.pending_.pop_front();
+    }
+
+    // but send only if active
+    if ( device_.is_active( Time::step( curr_time ) ) )
+    {
+      CurrentEvent ce;
+      ce.set_current( B_.amp_ );
+      S_.I_ = B_.amp_;
+      kernel().event_delivery_manager.send( *this, ce, offs );
+    }
+    B_.logger_.record_data( origin.get_steps() + offs );
+  }
+}
+
+void
+nest::shm_current_generator::handle( DataLoggingRequest& e )
+{
+  B_.logger_.handle( e );
+}
@@ -0,0 +1,241 @@
+/*
+ *  shm_current_generator.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef SHM_CURRENT_GENERATOR_H
+#define SHM_CURRENT_GENERATOR_H
+
+// C++ includes:
+#include <deque>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Includes from nestkernel:
+#include "connection.h"
+#include "event.h"
+#include "nest_types.h"
+#include "node.h"
+#include "shm_ring_buffer.h"
+#include "stimulating_device.h"
+#include "universal_data_logger.h"
+
+namespace nest
+{
+
+/*BeginDocumentation
+  Name: shm_current_generator - Provides a piecewise constant current read
+  from shared memory.
+
+  Synopsis: shm_current_generator Create -> gid
+
+  Description:
+  The shm_current_generator works like the step_current_generator, but reads
+  amplitude changes from a ring in POSIX shared memory while the simulation
+  runs. The ring is written by another process, e.g., an environment in a
+  closed-loop simulation, using the reader and writer in extras/shm_stream
+  or pynest/nest/shm_stream.py.
+
+  The ring is opened in Prepare. If it does not exist, it is created with
+  one reader per thread, as the generator has one instance per thread, and
+  removed when the generator is destroyed. The generator accepts the
+  following records, see ShmRingBuffer for the layout:
+
+  CURRENT - time in ms and amplitude in pA
+  EVENT   - events written by a multimeter with /to_shm true; the first
+            recorded value is used as amplitude
+
+  Records must be written in the order of their times. All available
+  records are read at the beginning of each time slice. Times are rounded up
+  to the simulation grid and are relative to /origin. Changes that arrive
+  too late to take effect at their time take effect at the beginning of the
+  current slice. For reproducible results, the writer must thus stay at
+  least one min_delay ahead of the simulation.
+
+  Parameters:
+  /shm_name        - Name of the shared memory ring, starting with a slash.
+                     The amplitude stays 0 pA if empty (default).
+  /shm_buffer_size - Size of the ring in bytes, if it is created by the
+                     generator (default: 1 MB).
+
+  Sends: CurrentEvent
+
+  SeeAlso: step_current_generator, shm_spike_generator, multimeter, Device,
+  StimulatingDevice
+*/
+class shm_current_generator : public Node
+{
+
+public:
+  shm_current_generator();
+  shm_current_generator( const shm_current_generator& );
+
+  bool
+  has_proxies() const
+  {
+    return false;
+  }
+
+  bool
+  independent_of_delivery() const
+  {
+    return true;
+  }
+
+  port send_test_event( Node&, rport, synindex, bool );
+
+  using Node::handle;
+  using Node::handles_test_event;
+
+  void handle( DataLoggingRequest& );
+
+  port handles_test_event( DataLoggingRequest&, rport );
+
+  void get_status( DictionaryDatum& ) const;
+  void set_status( const DictionaryDatum& );
+
+  //! Allow multimeter to connect to local instances
+  bool
+  local_receiver() const
+  {
+    return true;
+  }
+
+private:
+  void init_state_( const Node& );
+  void init_buffers_();
+  void calibrate();
+
+  void update( Time const&, const long, const long );
+
+  // ------------------------------------------------------------
+
+  struct Parameters_
+  {
+    std::string shm_name_;  //!< name of the ring
+    long shm_buffer_size_; //!< size of the ring in bytes, if created
+
+    Parameters_(); //!< Sets default parameter values
+
+    void get( DictionaryDatum& ) const; //!< Store current values in dictionary
+    void set( const DictionaryDatum& ); //!< Set values from dictionary
+  };
+
+  // ------------------------------------------------------------
+
+  struct State_
+  {
+    double I_; //!< Instantaneous current value; used for recording current
+
+    State_(); //!< Sets default parameter values
+  };
+
+  // ------------------------------------------------------------
+
+  // The next two classes need to be friends to access the State_ class/member
+  friend class RecordablesMap< shm_current_generator >;
+  friend class UniversalDataLogger< shm_current_generator >;
+
+  // ------------------------------------------------------------
+
+  struct Buffers_
+  {
+    ShmRingBuffer ring_;
+    std::vector< char > record_; //!< payload of last record read
+
+    //! Steps and values of amplitude changes read, but not yet applied
+    std::deque< std::pair< long, double > > pending_;
+    double amp_; //!< current amplitude
+
+    Buffers_( shm_current_generator& );
+    Buffers_( const Buffers_&, shm_current_generator& );
+    UniversalDataLogger< shm_current_generator > logger_;
+  };
+
+  // ------------------------------------------------------------
+
+  double
+  get_I_() const
+  {
+    return S_.I_;
+  }
+
+  // ------------------------------------------------------------
+
+  StimulatingDevice< CurrentEvent > device_;
+  static RecordablesMap< shm_current_generator > recordablesMap_;
+  Parameters_ P_;
+  State_ S_;
+  Buffers_ B_;
+};
+
+inline port
+shm_current_generator::send_test_event( Node& target,
+  rport receptor_type,
+  synindex syn_id,
+  bool )
+{
+  device_.enforce_single_syn_type( syn_id );
+
+  CurrentEvent e;
+  e.set_sender( *this );
+
+  return target.handles_test_event( e, receptor_type );
+}
+
+inline port
+shm_current_generator::handles_test_event( DataLoggingRequest& dlr,
+  rport receptor_type )
+{
+  if ( receptor_type != 0 )
+  {
+    throw UnknownReceptorType( receptor_type, get_name() );
+  }
+  return B_.logger_.connect_logging_device( dlr, recordablesMap_ );
+}
+
+inline void
+shm_current_generator::get_status( DictionaryDatum& d ) const
+{
+  P_.get( d );
+  device_.get_status( d );
+
+  ( *d )[ names::recordables ] = recordablesMap_.get_list();
+}
+
+inline void
+shm_current_generator::set_status( const DictionaryDatum& d )
+{
+  Parameters_ ptmp = P_; // temporary copy in case of errors
+  ptmp.set( d );         // throws if BadProperty
+
+  // We now know that ptmp is consistent. We do not write it back
+  // to P_ before we are also sure that the properties to be set
+  // in the parent class are internally consistent.
+  device_.set_status( d );
+
+  // if we get here, temporaries contain consistent set of properties
+  P_ = ptmp;
+}
+
+} // namespace
+
+#endif /* #ifndef SHM_CURRENT_GENERATOR_H */
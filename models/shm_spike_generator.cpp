@@ -0,0 +1,194 @@
+/*
+ *  shm_spike_generator.cpp
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "shm_spike_generator.h"
+
+// C++ includes:
+#include <algorithm>
+#include <cstring>
+
+// Includes from nestkernel:
+#include "event_delivery_manager_impl.h"
+#include "exceptions.h"
+#include "kernel_manager.h"
+
+// Includes from sli:
+#include "dict.h"
+#include "dictutils.h"
+#include "integerdatum.h"
+#include "stringdatum.h"
+
+
+/* ----------------------------------------------------------------
+ * Default constructors defining default parameters
+ * ---------------------------------------------------------------- */
+
+nest::shm_spike_generator::Parameters_::Parameters_()
+  : shm_name_()
+  , shm_buffer_size_( 1 << 20 )
+{
+}
+
+
+/* ----------------------------------------------------------------
+ * Parameter extraction and manipulation functions
+ * ---------------------------------------------------------------- */
+
+void
+nest::shm_spike_generator::Parameters_::get( DictionaryDatum& d ) const
+{
+  ( *d )[ names::shm_name ] = shm_name_;
+  ( *d )[ names::shm_buffer_size ] = shm_buffer_size_;
+}
+
+void
+nest::shm_spike_generator::Parameters_::set( const DictionaryDatum& d )
+{
+  updateValue< std::string >( d, names::shm_name, shm_name_ );
+  if ( not shm_name_.empty() and shm_name_[ 0 ] != '/' )
+  {
+    throw BadProperty( "shm_name must start with a slash." );
+  }
+
+  updateValue< long >( d, names::shm_buffer_size, shm_buffer_size_ );
+  if ( shm_buffer_size_ < 64 )
+  {
+    throw BadProperty( "shm_buffer_size must be >= 64." );
+  }
+}
+
+
+/* ----------------------------------------------------------------
+ * Default and copy constructor for node
+ * ---------------------------------------------------------------- */
+
+nest::shm_spike_generator::shm_spike_generator()
+  : Node()
+  , device_()
+  , P_()
+  , B_()
+{
+}
+
+nest::shm_spike_generator::shm_spike_generator( const shm_spike_generator& n )
+  : Node( n )
+  , device_( n.device_ )
+  , P_( n.P_ )
+  , B_( n.B_ )
+{
+}
+
+
+/* ----------------------------------------------------------------
+ * Node initialization functions
+ * ---------------------------------------------------------------- */
+
+void
+nest::shm_spike_generator::init_state_( const Node& proto )
+{
+  const shm_spike_generator& pr = downcast< shm_spike_generator >( proto );
+
+  device_.init_state( pr.device_ );
+}
+
+void
+nest::shm_spike_generator::init_buffers_()
+{
+  device_.init_buffers();
+
+  // records already read are discarded, those still in the ring are kept
+  while ( not B_.pending_.empty() )
+  {
+    B_.pending_.pop();
+  }
+}
+
+void
+nest::shm_spike_generator::calibrate()
+{
+  device_.calibrate();
+
+  if ( P_.shm_name_.empty() )
+  {
+    B_.ring_.close();
+  }
+  else if ( not B_.ring_.is_open() or B_.ring_.get_name() != P_.shm_name_ )
+  {
+    B_.ring_.attach_or_create( P_.shm_name_, P_.shm_buffer_size_, 1 );
+  }
+}
+
+
+/* ----------------------------------------------------------------
+ * Other functions
+ * ---------------------------------------------------------------- */
+
+void
+nest::shm_spike_generator::update( Time const& sliceT0,
+  const long from,
+  const long to )
+{
+  if ( not B_.ring_.is_open() )
+  {
+    return;
+  }
+
+  const long origin = device_.get_origin().get_steps();
+
+  ShmRingBuffer::RecordType type;
+  while ( B_.ring_.read( 0, type, B_.record_ ) )
+  {
+    if ( type == ShmRingBuffer::EVENT and B_.record_.size() >= 16 )
+    {
+      int64_t step;
+      std::memcpy( &step, &B_.record_[ 8 ], sizeof( step ) );
+      B_.pending_.push( origin + step );
+    }
+    else if ( type == ShmRingBuffer::SPIKES )
+    {
+      const size_t n = B_.record_.size() / sizeof( double );
+      for ( size_t i = 0; i < n; ++i )
+      {
+        double t;
+        std::memcpy( &t, &B_.record_[ i * sizeof( double ) ], sizeof( t ) );
+        B_.pending_.push( origin + Time( Time::ms_stamp( t ) ).get_steps() );
+      }
+    }
+  }
+
+  const long t0 = sliceT0.get_steps();
+  while ( not B_.pending_.empty() and B_.pending_.top() <= t0 + to )
+  {
+    const long stamp = B_.pending_.top();
+    B_.pending_.pop();
+
+    if ( device_.is_active( Time::step( stamp ) ) )
+    {
+      // spikes that arrived too late are sent at the beginning of the slice;
+      // we need to subtract one from stamp which is added again in send()
+      const long lag = std::max( stamp - t0 - 1, from );
+
+      SpikeEvent se;
+      kernel().event_delivery_manager.send( *this, se, lag );
+    }
+  }
+}
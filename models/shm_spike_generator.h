@@ -0,0 +1,173 @@
+/*
+ *  shm_spike_generator.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef SHM_SPIKE_GENERATOR_H
+#define SHM_SPIKE_GENERATOR_H
+
+// C++ includes:
+#include <functional>
+#include <queue>
+#include <string>
+#include <vector>
+
+// Includes from nestkernel:
+#include "connection.h"
+#include "event.h"
+#include "nest_types.h"
+#include "node.h"
+#include "shm_ring_buffer.h"
+#include "stimulating_device.h"
+
+namespace nest
+{
+
+/*BeginDocumentation
+  Name: shm_spike_generator - Generates spikes read from shared memory.
+
+  Synopsis: shm_spike_generator Create -> gid
+
+  Description:
+  The shm_spike_generator reads spike times from a ring in POSIX shared
+  memory while the simulation runs, and emits them to all its targets. The
+  ring is written by another process, e.g., an environment in a closed-loop
+  simulation, using the reader and writer in extras/shm_stream or
+  pynest/nest/shm_stream.py.
+
+  The ring is opened in Prepare. If it does not exist, it is created with
+  one reader and removed when the generator is destroyed. The generator
+  accepts the following records, see ShmRingBuffer for the layout:
+
+  SPIKES  - spike times in ms
+  EVENT   - events written by a spike_detector with /to_shm true, so that
+            spikes recorded in one simulation can drive another one
+
+  All available records are read at the beginning of each time slice.
+  Spike times are rounded up to the simulation grid and are relative to
+  /origin. Spikes that arrive too late to be emitted at their time are
+  emitted at the beginning of the current slice. For reproducible results,
+  the writer must thus stay at least one min_delay ahead of the simulation.
+
+  Parameters:
+  /shm_name        - Name of the shared memory ring, starting with a slash.
+                     No spikes are emitted if empty (default).
+  /shm_buffer_size - Size of the ring in bytes, if it is created by the
+                     generator (default: 1 MB).
+
+  Sends: SpikeEvent
+
+  SeeAlso: spike_generator, shm_current_generator, spike_detector, Device,
+  StimulatingDevice
+*/
+class shm_spike_generator : public Node
+{
+
+public:
+  shm_spike_generator();
+  shm_spike_generator( const shm_spike_generator& );
+
+  port send_test_event( Node&, rport, synindex, bool );
+  void get_status( DictionaryDatum& ) const;
+  void set_status( const DictionaryDatum& );
+
+  bool
+  independent_of_delivery() const
+  {
+    return true;
+  }
+
+private:
+  void init_state_( const Node& );
+  void init_buffers_();
+  void calibrate();
+
+  void update( Time const&, const long, const long );
+
+  // ------------------------------------------------------------
+
+  struct Parameters_
+  {
+    std::string shm_name_;  //!< name of the ring
+    long shm_buffer_size_; //!< size of the ring in bytes, if created
+
+    Parameters_(); //!< Sets default parameter values
+
+    void get( DictionaryDatum& ) const; //!< Store current values in dictionary
+    void set( const DictionaryDatum& ); //!< Set values from dictionary
+  };
+
+  // ------------------------------------------------------------
+
+  struct Buffers_
+  {
+    ShmRingBuffer ring_;
+    std::vector< char > record_; //!< payload of last record read
+
+    //! Stamps of spikes read, but not yet emitted, earliest first
+    std::priority_queue< long, std::vector< long >, std::greater< long > >
+      pending_;
+  };
+
+  // ------------------------------------------------------------
+
+  StimulatingDevice< SpikeEvent > device_;
+  Parameters_ P_;
+  Buffers_ B_;
+};
+
+inline port
+shm_spike_generator::send_test_event( Node& target,
+  rport receptor_type,
+  synindex syn_id,
+  bool )
+{
+  device_.enforce_single_syn_type( syn_id );
+
+  SpikeEvent e;
+  e.set_sender( *this );
+  return target.handles_test_event( e, receptor_type );
+}
+
+inline void
+shm_spike_generator::get_status( DictionaryDatum& d ) const
+{
+  P_.get( d );
+  device_.get_status( d );
+}
+
+inline void
+shm_spike_generator::set_status( const DictionaryDatum& d )
+{
+  Parameters_ ptmp = P_; // temporary copy in case of errors
+  ptmp.set( d );         // throws if BadProperty
+
+  // We now know that ptmp is consistent. We do not write it back
+  // to P_ before we are also sure that the properties to be set
+  // in the parent class are internally consistent.
+  device_.set_status( d );
+
+  // if we get here, temporaries contain consistent set of properties
+  P_ = ptmp;
+}
+
+} // namespace
+
+#endif /* #ifndef SHM_SPIKE_GENERATOR_H */
@@ -160,6 +160,12 @@ public:
     return not P_.individual_spike_trains_;
   }
 
+  bool
+  independent_of_delivery() const
+  {
+    return true;
+  }
+
   //! Allow multimeter to connect to local instances
   bool
   local_receiver() const
@@ -171,6 +177,11 @@ private:
   void init_state_( const Node& );
   void init_buffers_();
   void calibrate();
+  bool
+  is_run_dependent() const
+  {
+    return true;
+  }
   void event_hook( DSSpikeEvent& );
 
   void update( Time const&, const long, const long );
@@ -125,6 +125,7 @@ nest::spike_detector::update( Time const&, const long, const long )
   // do not use swap here to clear, since we want to keep the reserved()
   // memory for the next round
   B_.spikes_[ kernel().event_delivery_manager.read_toggle() ].clear();
+  device_.publish_records();
 }
 
 void
@@ -143,6 +143,11 @@ private:
   void init_state_( Node const& );
   void init_buffers_();
   void calibrate();
+  bool
+  is_run_dependent() const
+  {
+    return true;
+  }
   void post_run_cleanup();
   void finalize();
 
@@ -0,0 +1,213 @@
+/*
+ *  spike_replay_generator.cpp
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "spike_replay_generator.h"
+
+// C++ includes:
+#include <cmath>
+
+// Includes from libnestutil:
+#include "compose.hpp"
+
+// Includes from nestkernel:
+#include "event_delivery_manager_impl.h"
+#include "exceptions.h"
+#include "kernel_manager.h"
+
+// Includes from sli:
+#include "dict.h"
+#include "dictutils.h"
+#include "integerdatum.h"
+#include "stringdatum.h"
+
+
+/* ----------------------------------------------------------------
+ * Default constructors defining default parameters and state
+ * ---------------------------------------------------------------- */
+
+nest::spike_replay_generator::Parameters_::Parameters_()
+  : filename_()
+  , gid_offset_( 0 )
+{
+}
+
+nest::spike_replay_generator::State_::State_()
+  : position_( 0 )
+{
+}
+
+
+/* ----------------------------------------------------------------
+ * Parameter extraction and manipulation functions
+ * ---------------------------------------------------------------- */
+
+void
+nest::spike_replay_generator::Parameters_::get( DictionaryDatum& d ) const
+{
+  ( *d )[ names::filename ] = filename_;
+  ( *d )[ names::gid_offset ] = gid_offset_;
+}
+
+void
+nest::spike_replay_generator::Parameters_::set( const DictionaryDatum& d )
+{
+  updateValue< std::string >( d, names::filename, filename_ );
+  updateValue< long >( d, names::gid_offset, gid_offset_ );
+}
+
+
+/* ----------------------------------------------------------------
+ * Default and copy constructor for node
+ * ---------------------------------------------------------------- */
+
+nest::spike_replay_generator::spike_replay_generator()
+  : Node()
+  , device_()
+  , P_()
+  , S_()
+  , B_()
+{
+}
+
+nest::spike_replay_generator::spike_replay_generator(
+  const spike_replay_generator& n )
+  : Node( n )
+  , device_( n.device_ )
+  , P_( n.P_ )
+  , S_( n.S_ )
+  , B_( n.B_ )
+{
+}
+
+
+/* ----------------------------------------------------------------
+ * Node initialization functions
+ * ---------------------------------------------------------------- */
+
+void
+nest::spike_replay_generator::init_state_( const Node& proto )
+{
+  const spike_replay_generator& pr =
+    downcast< spike_replay_generator >( proto );
+
+  device_.init_state( pr.device_ );
+  S_ = pr.S_;
+}
+
+void
+nest::spike_replay_generator::init_buffers_()
+{
+  device_.init_buffers();
+}
+
+void
+nest::spike_replay_generator::calibrate()
+{
+  device_.calibrate();
+
+  if ( P_.filename_.empty() )
+  {
+    B_.file_.close();
+    return;
+  }
+  if ( not B_.file_.is_open() or B_.file_.get_filename() != P_.filename_ )
+  {
+    B_.file_.open( P_.filename_ );
+    S_.position_ = 0;
+
+    const double h = Time::get_resolution().get_ms();
+    const double file_h = B_.file_.get_resolution();
+    if ( std::abs( file_h - h ) > 1e-10 * h )
+    {
+      B_.file_.close();
+      throw BadProperty( String::compose(
+        "Spike file '%1' was written with resolution %2 ms, not %3 ms.",
+        P_.filename_,
+        file_h,
+        h ) );
+    }
+  }
+
+  // checked on each call, as gid_offset or the network may have changed
+  // since the file was opened
+  if ( B_.file_.size() > 0
+    and ( static_cast< long >( B_.file_.get_min_gid() ) + P_.gid_offset_ < 1
+         or static_cast< long >( B_.file_.get_max_gid() ) + P_.gid_offset_
+           >= static_cast< long >( kernel().node_manager.size() ) ) )
+  {
+    const std::string msg = String::compose(
+      "GIDs %1 to %2 of spike file '%3' are not in the network.",
+      B_.file_.get_min_gid() + P_.gid_offset_,
+      B_.file_.get_max_gid() + P_.gid_offset_,
+      P_.filename_ );
+    B_.file_.close();
+    throw BadProperty( msg );
+  }
+}
+
+
+/* ----------------------------------------------------------------
+ * Other functions
+ * ---------------------------------------------------------------- */
+
+void
+nest::spike_replay_generator::update( Time const& sliceT0,
+  const long from,
+  const long to )
+{
+  if ( not B_.file_.is_open() )
+  {
+    return;
+  }
+
+  const SpikeReplayFile& file = B_.file_;
+  const long t0 = sliceT0.get_steps();
+  const long origin = device_.get_origin().get_steps();
+
+  // skip spikes in the past; they are found by bisection, since there may
+  // be many of them, e.g., after origin has been increased
+  if ( S_.position_ < file.size()
+    and file[ S_.position_ ].step + origin <= t0 + from )
+  {
+    S_.position_ = file.lower_bound( S_.position_, t0 + from + 1 - origin );
+  }
+
+  const bool off_grid =
+    kernel().event_delivery_manager.get_off_grid_communication();
+  while ( S_.position_ < file.size()
+    and file[ S_.position_ ].step + origin <= t0 + to )
+  {
+    const SpikeReplayFile::Record& r = file[ S_.position_ ];
+    const long stamp = r.step + origin;
+    if ( device_.is_active( Time::step( stamp ) ) )
+    {
+      // we need to subtract one from stamp which is added again in send()
+      kernel().event_delivery_manager.send_remote_as( get_thread(),
+        r.gid + P_.gid_offset_,
+        stamp - t0 - 1,
+        off_grid ? r.offset : 0.0 );
+    }
+    ++S_.position_;
+  }
+
+  B_.file_.release( S_.position_ );
+}
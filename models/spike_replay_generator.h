@@ -0,0 +1,173 @@
+/*
+ *  spike_replay_generator.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef SPIKE_REPLAY_GENERATOR_H
+#define SPIKE_REPLAY_GENERATOR_H
+
+// C++ includes:
+#include <string>
+
+// Includes from nestkernel:
+#include "event.h"
+#include "nest_types.h"
+#include "node.h"
+#include "spike_replay_file.h"
+#include "stimulating_device.h"
+
+// Includes from sli:
+#include "namedatum.h"
+
+namespace nest
+{
+
+/*BeginDocumentation
+  Name: spike_replay_generator - Replays the spikes of many nodes from a file.
+
+  Synopsis: spike_replay_generator Create -> gid
+
+  Description:
+  The spike_replay_generator replays recorded activity of a whole
+  population with a single device. It reads a binary file of spikes sorted
+  by time, as written by WriteSpikeReplayFile, and emits each spike on
+  behalf of the node with GID gid + /gid_offset, where gid is the sender
+  stored in the file. The spike is delivered to all targets of that node,
+  exactly as if the node had spiked itself. The replaying nodes are
+  typically parrot_neurons without input, which are connected to the
+  network in place of the recorded population.
+
+  The generator cannot be connected itself, and its element_type is
+  other. The file is mapped into memory in Prepare and read sequentially,
+  one time slice at a time. Pages already replayed are released, so that
+  the memory used does not depend on the length of the recording. The file
+  must have been written with the current resolution.
+
+  Spike times are relative to /origin, and only spikes within /start and
+  /stop are emitted. Spikes at or before the current time, e.g., after
+  /origin was increased, are skipped. Offsets stored in the file are used
+  only if off_grid_spiking is enabled. ResetNetwork rewinds the file.
+
+  Parameters:
+  /filename   - Name of the spike file. No spikes are emitted if empty
+                (default).
+  /gid_offset - Offset added to the GIDs in the file (default: 0).
+
+  Sends: SpikeEvent
+
+  Examples:
+  % record 100 neurons, then replay them through 100 parrot neurons
+  sd /events get dup /senders get cva exch /times get cva
+  (spikes.rpl) rolld WriteSpikeReplayFile
+  ResetKernel
+  /parrot_neuron 100 Create ;
+  /spike_replay_generator << /filename (spikes.rpl) >> Create ;
+
+  SeeAlso: WriteSpikeReplayFile, spike_generator, parrot_neuron, Device,
+  StimulatingDevice
+*/
+class spike_replay_generator : public Node
+{
+
+public:
+  spike_replay_generator();
+  spike_replay_generator( const spike_replay_generator& );
+
+  void get_status( DictionaryDatum& ) const;
+  void set_status( const DictionaryDatum& );
+
+  bool
+  independent_of_delivery() const
+  {
+    return true;
+  }
+
+private:
+  void init_state_( const Node& );
+  void init_buffers_();
+  void calibrate();
+
+  void update( Time const&, const long, const long );
+
+  // ------------------------------------------------------------
+
+  struct State_
+  {
+    size_t position_; //!< index of next spike to emit
+
+    State_(); //!< Sets default state value
+  };
+
+  // ------------------------------------------------------------
+
+  struct Parameters_
+  {
+    std::string filename_; //!< name of the spike file
+    long gid_offset_;      //!< added to the GIDs in the file
+
+    Parameters_(); //!< Sets default parameter values
+
+    void get( DictionaryDatum& ) const; //!< Store current values in dictionary
+    void set( const DictionaryDatum& ); //!< Set values from dictionary
+  };
+
+  // ------------------------------------------------------------
+
+  struct Buffers_
+  {
+    SpikeReplayFile file_;
+  };
+
+  // ------------------------------------------------------------
+
+  StimulatingDevice< SpikeEvent > device_;
+  Parameters_ P_;
+  State_ S_;
+  Buffers_ B_;
+};
+
+inline void
+spike_replay_generator::get_status( DictionaryDatum& d ) const
+{
+  P_.get( d );
+  device_.get_status( d );
+
+  // the generator has no targets of its own
+  ( *d )[ names::element_type ] = LiteralDatum( names::other );
+}
+
+inline void
+spike_replay_generator::set_status( const DictionaryDatum& d )
+{
+  Parameters_ ptmp = P_; // temporary copy in case of errors
+  ptmp.set( d );         // throws if BadProperty
+
+  // We now know that ptmp is consistent. We do not write it back
+  // to P_ before we are also sure that the properties to be set
+  // in the parent class are internally consistent.
+  device_.set_status( d );
+
+  // if we get here, temporaries contain consistent set of properties
+  P_ = ptmp;
+}
+
+} // namespace
+
+#endif /* #ifndef SPIKE_REPLAY_GENERATOR_H */
@@ -0,0 +1,456 @@
+/*
+ *  spike_statistics_detector.cpp
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "spike_statistics_detector.h"
+
+// C++ includes:
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+// Includes from nestkernel:
+#include "kernel_manager.h"
+#include "sibling_container.h"
+
+// Includes from sli:
+#include "arraydatum.h"
+#include "dict.h"
+#include "dictutils.h"
+
+/* ----------------------------------------------------------------
+ * Default constructors defining default parameters and state
+ * ---------------------------------------------------------------- */
+
+nest::spike_statistics_detector::Sender_::Sender_( const index gid,
+  const long population )
+  : gid_( gid )
+  , population_( population )
+{
+  clear();
+}
+
+void
+nest::spike_statistics_detector::Sender_::clear()
+{
+  n_spikes_ = 0;
+  last_spike_ = 0.0;
+  isi_mean_ = 0.0;
+  isi_m2_ = 0.0;
+  window_ = 0;
+  window_count_ = 0;
+  count_sum_ = 0.0;
+  count_sq_sum_ = 0.0;
+}
+
+nest::spike_statistics_detector::Parameters_::Parameters_()
+  : N_channels_( 1 )
+  , bin_width_( Time::ms( 1.0 ) )
+  , n_bins_( 1000 )
+  , count_window_( Time::ms( 100.0 ) )
+{
+}
+
+nest::spike_statistics_detector::State_::State_()
+  : n_events_( 0 )
+  , senders_()
+  , histogram_()
+{
+}
+
+/* ----------------------------------------------------------------
+ * Parameter extraction and manipulation functions
+ * ---------------------------------------------------------------- */
+
+void
+nest::spike_statistics_detector::Parameters_::get( DictionaryDatum& d ) const
+{
+  ( *d )[ names::N_channels ] = N_channels_;
+  ( *d )[ names::bin_width ] = bin_width_.get_ms();
+  ( *d )[ names::n_bins ] = n_bins_;
+  ( *d )[ names::count_window ] = count_window_.get_ms();
+}
+
+bool
+nest::spike_statistics_detector::Parameters_::set( const DictionaryDatum& d,
+  const spike_statistics_detector& n )
+{
+  bool clear = false;
+  double t;
+  long v;
+
+  if ( updateValue< long >( d, names::N_channels, v ) )
+  {
+    if ( v < 1 )
+    {
+      throw BadProperty( "/N_channels can only be larger than zero." );
+    }
+    if ( v != N_channels_ && not n.B_.sender_index_.empty() )
+    {
+      throw BadProperty(
+        "/N_channels cannot be changed after nodes have been connected." );
+    }
+    N_channels_ = v;
+    clear = true;
+  }
+
+  if ( updateValue< double >( d, names::bin_width, t ) )
+  {
+    bin_width_ = Time::ms( t );
+    if ( not bin_width_.is_step() or bin_width_.get_steps() < 1 )
+    {
+      throw StepMultipleRequired( n.get_name(), names::bin_width, bin_width_ );
+    }
+    clear = true;
+  }
+
+  if ( updateValue< long >( d, names::n_bins, v ) )
+  {
+    if ( v < 0 )
+    {
+      throw BadProperty( "/n_bins cannot be negative." );
+    }
+    n_bins_ = v;
+    clear = true;
+  }
+
+  if ( updateValue< double >( d, names::count_window, t ) )
+  {
+    count_window_ = Time::ms( t );
+    if ( not count_window_.is_step() or count_window_.get_steps() < 1 )
+    {
+      throw StepMultipleRequired(
+        n.get_name(), names::count_window, count_window_ );
+    }
+    clear = true;
+  }
+
+  return clear;
+}
+
+void
+nest::spike_statistics_detector::State_::clear( const Parameters_& p )
+{
+  n_events_ = 0;
+  for ( std::vector< Sender_ >::iterator s = senders_.begin();
+        s != senders_.end();
+        ++s )
+  {
+    s->clear();
+  }
+  histogram_.assign( p.N_channels_ * p.n_bins_, 0 );
+}
+
+/* ----------------------------------------------------------------
+ * Default and copy constructor for node
+ * ---------------------------------------------------------------- */
+
+nest::spike_statistics_detector::spike_statistics_detector()
+  : Node()
+  , device_()
+  , P_()
+  , S_()
+  , B_()
+{
+}
+
+nest::spike_statistics_detector::spike_statistics_detector(
+  const spike_statistics_detector& n )
+  : Node( n )
+  , device_( n.device_ )
+  , P_( n.P_ )
+  , S_()
+  , B_()
+{
+  if ( not P_.bin_width_.is_step() )
+  {
+    throw InvalidTimeInModel( get_name(), names::bin_width, P_.bin_width_ );
+  }
+  if ( not P_.count_window_.is_step() )
+  {
+    throw InvalidTimeInModel(
+      get_name(), names::count_window, P_.count_window_ );
+  }
+}
+
+/* ----------------------------------------------------------------
+ * Node initialization functions
+ * ---------------------------------------------------------------- */
+
+void
+nest::spike_statistics_detector::init_state_( const Node& proto )
+{
+  const spike_statistics_detector& pr =
+    downcast< spike_statistics_detector >( proto );
+
+  device_.init_state( pr.device_ );
+  S_.clear( P_ );
+}
+
+void
+nest::spike_statistics_detector::init_buffers_()
+{
+  device_.init_buffers();
+  S_.clear( P_ );
+}
+
+void
+nest::spike_statistics_detector::calibrate()
+{
+  device_.calibrate();
+
+  // senders may have been connected since the last simulation
+  B_.gids_.clear();
+  B_.indices_.clear();
+  B_.gids_.reserve( B_.sender_index_.size() );
+  B_.indices_.reserve( B_.sender_index_.size() );
+  for ( std::map< index, size_t >::const_iterator it =
+          B_.sender_index_.begin();
+        it != B_.sender_index_.end();
+        ++it )
+  {
+    B_.gids_.push_back( it->first );
+    B_.indices_.push_back( it->second );
+  }
+}
+
+/* ----------------------------------------------------------------
+ * Other functions
+ * ---------------------------------------------------------------- */
+
+nest::port
+nest::spike_statistics_detector::handles_test_event( SpikeEvent& e,
+  rport receptor_type )
+{
+  if ( receptor_type < 0 || receptor_type > P_.N_channels_ - 1 )
+  {
+    throw UnknownReceptorType( receptor_type, get_name() );
+  }
+
+  const index gid = e.get_sender().get_gid();
+  if ( B_.sender_index_.find( gid ) != B_.sender_index_.end() )
+  {
+    throw IllegalConnection(
+      "spike_statistics_detector can only be connected once to each node." );
+  }
+  B_.sender_index_[ gid ] = S_.senders_.size();
+  S_.senders_.push_back( Sender_( gid, receptor_type ) );
+
+  return receptor_type;
+}
+
+void
+nest::spike_statistics_detector::handle( SpikeEvent& e )
+{
+  // accept spikes only if detector was active when spike was emitted
+  const Time stamp = e.get_stamp();
+  if ( not device_.is_active( stamp ) )
+  {
+    return;
+  }
+
+  const std::vector< index >::const_iterator it = std::lower_bound(
+    B_.gids_.begin(), B_.gids_.end(), e.get_sender_gid() );
+  assert( it != B_.gids_.end() && *it == e.get_sender_gid() );
+  Sender_& s = S_.senders_[ B_.indices_[ it - B_.gids_.begin() ] ];
+
+  const long m = e.get_multiplicity();
+  const double t_spike = stamp.get_ms() - e.get_offset();
+  const long step = stamp.get_steps() - device_.get_t_min_() - 1;
+
+  // inter-spike intervals, updated with Welford's algorithm, the first
+  // spike of the multiplet closes the interval to the previous spike
+  for ( long k = 0; k < m; ++k )
+  {
+    if ( s.n_spikes_ > 0 )
+    {
+      const double isi = k == 0 ? t_spike - s.last_spike_ : 0.0;
+      const double delta = isi - s.isi_mean_;
+      s.isi_mean_ += delta / s.n_spikes_;
+      s.isi_m2_ += delta * ( isi - s.isi_mean_ );
+    }
+    ++s.n_spikes_;
+  }
+  s.last_spike_ = t_spike;
+
+  // spike counts in windows
+  const long window = step / P_.count_window_.get_steps();
+  if ( window != s.window_ )
+  {
+    s.count_sum_ += s.window_count_;
+    s.count_sq_sum_ +=
+      static_cast< double >( s.window_count_ ) * s.window_count_;
+    s.window_ = window;
+    s.window_count_ = 0;
+  }
+  s.window_count_ += m;
+
+  // population histogram
+  const long bin = step / P_.bin_width_.get_steps();
+  if ( bin < P_.n_bins_ )
+  {
+    S_.histogram_[ s.population_ * P_.n_bins_ + bin ] += m;
+  }
+
+  S_.n_events_ += m;
+}
+
+void
+nest::spike_statistics_detector::get_status( DictionaryDatum& d ) const
+{
+  device_.get_status( d );
+  P_.get( d );
+
+  if ( not is_model_prototype() )
+  {
+    add_statistics_( d );
+  }
+
+  ( *d )[ names::element_type ] = LiteralDatum( names::recorder );
+}
+
+void
+nest::spike_statistics_detector::add_statistics_( DictionaryDatum& d ) const
+{
+  const double nan = std::numeric_limits< double >::quiet_NaN();
+
+  // time elapsed in the activity interval and completed count windows
+  const long now = std::min(
+    kernel().simulation_manager.get_time().get_steps(), device_.get_t_max_() );
+  const long elapsed = std::max( now - device_.get_t_min_(), 0L );
+  const double duration = Time( Time::step( elapsed ) ).get_ms();
+  const long n_windows = elapsed / P_.count_window_.get_steps();
+
+  // per sender: gid, n_spikes, rate, cv_isi, fano_factor
+  const size_t n_fields = 5;
+  std::vector< double > local;
+  std::vector< double > histogram( P_.N_channels_ * P_.n_bins_, 0.0 );
+  double n_events = 0.0;
+
+  const SiblingContainer* siblings =
+    kernel().node_manager.get_thread_siblings( get_gid() );
+  for ( std::vector< Node* >::const_iterator sibling = siblings->begin();
+        sibling != siblings->end();
+        ++sibling )
+  {
+    const spike_statistics_detector* ssd =
+      dynamic_cast< const spike_statistics_detector* >( *sibling );
+    assert( ssd != 0 );
+    const State_& S = ssd->S_;
+
+    n_events += S.n_events_;
+    for ( size_t i = 0; i < S.histogram_.size(); ++i )
+    {
+      histogram[ i ] += S.histogram_[ i ];
+    }
+
+    for ( std::vector< Sender_ >::const_iterator s = S.senders_.begin();
+          s != S.senders_.end();
+          ++s )
+    {
+      const double rate =
+        duration > 0.0 ? 1000.0 * s->n_spikes_ / duration : nan;
+
+      const long n_isi = s->n_spikes_ - 1;
+      const double cv = n_isi > 0 && s->isi_mean_ > 0.0
+        ? std::sqrt( s->isi_m2_ / n_isi ) / s->isi_mean_
+        : nan;
+
+      // include the current window if it is completed
+      double count_sum = s->count_sum_;
+      double count_sq_sum = s->count_sq_sum_;
+      if ( s->window_ < n_windows )
+      {
+        count_sum += s->window_count_;
+        count_sq_sum +=
+          static_cast< double >( s->window_count_ ) * s->window_count_;
+      }
+      double fano = nan;
+      if ( n_windows > 0 && count_sum > 0.0 )
+      {
+        const double mean = count_sum / n_windows;
+        fano = ( count_sq_sum / n_windows - mean * mean ) / mean;
+      }
+
+      local.push_back( s->gid_ );
+      local.push_back( s->n_spikes_ );
+      local.push_back( rate );
+      local.push_back( cv );
+      local.push_back( fano );
+    }
+  }
+
+  // each sender is only connected on one process, histograms are summed
+  std::vector< double > global;
+  if ( kernel().mpi_manager.get_num_processes() > 1 )
+  {
+    std::vector< int > displacements;
+    kernel().mpi_manager.communicate( local, global, displacements );
+    kernel().mpi_manager.communicate_Allreduce_sum_in_place( histogram );
+    std::vector< double > n_events_global( 1, n_events );
+    kernel().mpi_manager.communicate_Allreduce_sum_in_place( n_events_global );
+    n_events = n_events_global[ 0 ];
+  }
+  else
+  {
+    global.swap( local );
+  }
+
+  const size_t n_senders = global.size() / n_fields;
+  std::vector< std::pair< index, size_t > > order( n_senders );
+  for ( size_t i = 0; i < n_senders; ++i )
+  {
+    order[ i ] = std::make_pair(
+      static_cast< index >( global[ i * n_fields ] ), i * n_fields );
+  }
+  std::sort( order.begin(), order.end() );
+
+  std::vector< long >* senders = new std::vector< long >( n_senders );
+  std::vector< long >* n_spikes = new std::vector< long >( n_senders );
+  std::vector< double >* rates = new std::vector< double >( n_senders );
+  std::vector< double >* cv_isi = new std::vector< double >( n_senders );
+  std::vector< double >* fano = new std::vector< double >( n_senders );
+  for ( size_t i = 0; i < n_senders; ++i )
+  {
+    const double* const f = &global[ order[ i ].second ];
+    ( *senders )[ i ] = order[ i ].first;
+    ( *n_spikes )[ i ] = static_cast< long >( f[ 1 ] );
+    ( *rates )[ i ] = f[ 2 ];
+    ( *cv_isi )[ i ] = f[ 3 ];
+    ( *fano )[ i ] = f[ 4 ];
+  }
+
+  ArrayDatum hist;
+  for ( long p = 0; p < P_.N_channels_; ++p )
+  {
+    hist.push_back( new IntVectorDatum(
+      new std::vector< long >( histogram.begin() + p * P_.n_bins_,
+        histogram.begin() + ( p + 1 ) * P_.n_bins_ ) ) );
+  }
+
+  ( *d )[ names::n_events ] = static_cast< long >( n_events );
+  ( *d )[ names::senders ] = IntVectorDatum( senders );
+  ( *d )[ names::n_spikes ] = IntVectorDatum( n_spikes );
+  ( *d )[ names::rates ] = DoubleVectorDatum( rates );
+  ( *d )[ names::cv_isi ] = DoubleVectorDatum( cv_isi );
+  ( *d )[ names::fano_factor ] = DoubleVectorDatum( fano );
+  ( *d )[ names::histogram ] = hist;
+}
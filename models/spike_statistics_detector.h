@@ -0,0 +1,294 @@
+/*
+ *  spike_statistics_detector.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef SPIKE_STATISTICS_DETECTOR_H
+#define SPIKE_STATISTICS_DETECTOR_H
+
+
+// C++ includes:
+#include <map>
+#include <vector>
+
+// Includes from nestkernel:
+#include "event.h"
+#include "exceptions.h"
+#include "nest_types.h"
+#include "node.h"
+#include "pseudo_recording_device.h"
+
+/* BeginDocumentation
+
+   Name: spike_statistics_detector - Device for computing spike train
+   statistics during simulation
+
+   Description: The spike_statistics_detector accumulates statistics of the
+   spike trains of all nodes connected to it, instead of recording the
+   spikes themselves. Its memory use only depends on the number of
+   connected nodes and histogram bins, not on the duration of the
+   simulation.
+
+   For each connected node, it counts spikes and keeps the running mean and
+   variance of inter-spike intervals, as well as the mean and variance of
+   spike counts in consecutive windows of duration count_window. For each
+   of the N_channels populations, selected via the receptor_type of the
+   connections as for the correlomatrix_detector, it counts spikes in a
+   time histogram with n_bins bins of width bin_width, starting at
+   origin + start. Spikes after the last bin are not counted in the
+   histograms.
+
+   Spikes with a multiplicity m count as m spikes at the same time. The
+   precise spike times are used for inter-spike intervals, while counts in
+   windows and bins are based on time stamps, as for the activity interval
+   of the device: bin k contains spikes with stamps in
+   (origin + start + k * bin_width, origin + start + (k+1) * bin_width].
+
+   Each thread and MPI process keeps the statistics of the nodes that send
+   spikes to it, and GetStatus merges them. With more than one MPI
+   process, GetStatus therefore requires communication and must be called
+   on all processes.
+
+   Parameters:
+   N_channels   long   - Number of populations. This defines the range of
+                         receptor_type. Default is 1. Cannot be changed after
+                         nodes have been connected.
+   bin_width    double - Width of the bins of the population histograms in
+                         ms. Default is 1.0.
+   n_bins       long   - Number of bins of each population histogram.
+                         Default is 1000.
+   count_window double - Duration of the windows for the Fano factor in ms.
+                         Default is 100.0.
+   Changing bin_width, n_bins or count_window clears all statistics.
+
+   Statistics (read-only):
+   n_events     long         - Number of spikes recorded. Setting n_events
+                                to 0 clears all statistics.
+   senders      int vector   - GIDs of the connected nodes, in ascending
+                                order. The following vectors contain one
+                                entry per sender.
+   n_spikes     int vector   - Number of spikes of each sender.
+   rates        double vector - Firing rates in spikes/s, the number of spikes
+                                divided by the time elapsed in the activity
+                                interval of the device.
+   cv_isi       double vector - Coefficient of variation of the inter-spike
+                                intervals, i.e., their standard deviation
+                                divided by their mean. NaN for senders with
+                                less than two spikes.
+   fano_factor  double vector - Variance of the spike counts in all completed
+                                count windows divided by their mean. NaN if
+                                no window is completed or there are no spikes
+                                in completed windows.
+   histogram    array         - Spike counts of each population in each bin,
+                                one int vector per population.
+
+   Example:
+   /iaf_psc_alpha 100 Create pop
+   /nrns [ 1 100 ] Range def
+   nrns { << /I_e 400.0 >> SetStatus } forall
+   /ssd /spike_statistics_detector << /bin_width 5.0 /n_bins 200 >> Create def
+   nrns [ ssd ] Connect
+   1000 Simulate
+   ssd /rates get cva Mean ==
+
+   Receives: SpikeEvent
+
+   FirstVersion: October 2026
+   SeeAlso: spike_detector, correlomatrix_detector, Device,
+   PseudoRecordingDevice
+   Availability: NEST
+*/
+
+
+namespace nest
+{
+/**
+ * Online spike train statistics.
+ *
+ * The device has one instance per thread, like the spike_detector, and
+ * each node sends its spikes only to the instance on its thread. Each
+ * instance thus holds the statistics of a disjoint set of nodes, which
+ * are registered in handles_test_event() when the nodes are connected.
+ * handle() updates the accumulators of the sender directly. GetStatus
+ * merges the statistics of all threads and MPI processes.
+ *
+ * @note Spike statistics detectors IGNORE any connection delays.
+ */
+class spike_statistics_detector : public Node
+{
+
+public:
+  spike_statistics_detector();
+  spike_statistics_detector( const spike_statistics_detector& );
+
+  bool
+  has_proxies() const
+  {
+    return false;
+  }
+
+  bool
+  local_receiver() const
+  {
+    return true;
+  }
+
+  /**
+   * Import sets of overloaded virtual functions.
+   * @see Technical Issues / Virtual Functions: Overriding, Overloading, and
+   * Hiding
+   */
+  using Node::handle;
+  using Node::handles_test_event;
+
+  void handle( SpikeEvent& );
+
+  port handles_test_event( SpikeEvent&, rport );
+
+  void get_status( DictionaryDatum& ) const;
+  void set_status( const DictionaryDatum& );
+
+private:
+  void init_state_( Node const& );
+  void init_buffers_();
+  void calibrate();
+
+  void
+  update( Time const&, const long, const long )
+  {
+  }
+
+  /**
+   * Merge the statistics of all threads and processes and store them in
+   * the dictionary.
+   */
+  void add_statistics_( DictionaryDatum& ) const;
+
+  // ------------------------------------------------------------
+
+  /**
+   * Accumulators of a single sender.
+   */
+  struct Sender_
+  {
+    index gid_;
+    long population_;
+    long n_spikes_;
+    double last_spike_; //!< precise time of last spike, in ms
+    double isi_mean_;   //!< running mean of inter-spike intervals
+    double isi_m2_;     //!< running sum of squared deviations from the mean
+    long window_;       //!< index of current count window
+    long window_count_; //!< spikes in current count window
+    double count_sum_;  //!< sum of spike counts in earlier windows
+    double count_sq_sum_; //!< sum of squared spike counts in earlier windows
+
+    Sender_( index gid, long population );
+
+    void clear();
+  };
+
+  // ------------------------------------------------------------
+
+  struct Parameters_
+  {
+    long N_channels_;   //!< number of populations
+    Time bin_width_;    //!< width of histogram bins
+    long n_bins_;       //!< number of histogram bins per population
+    Time count_window_; //!< duration of windows for Fano factor
+
+    Parameters_(); //!< Sets default parameter values
+
+    void get( DictionaryDatum& ) const; //!< Store current values in dictionary
+
+    /**
+     * Set values from dictionary.
+     * @returns true if the statistics need to be cleared.
+     */
+    bool set( const DictionaryDatum&, const spike_statistics_detector& );
+  };
+
+  // ------------------------------------------------------------
+
+  struct State_
+  {
+    long n_events_; //!< number of spikes recorded on this thread
+
+    //! accumulators, one per sender connected on this thread
+    std::vector< Sender_ > senders_;
+
+    //! population histograms, N_channels_ x n_bins_
+    std::vector< long > histogram_;
+
+    State_();
+
+    void clear( const Parameters_& );
+  };
+
+  // ------------------------------------------------------------
+
+  struct Buffers_
+  {
+    //! index of sender in S_.senders_ by gid
+    std::map< index, size_t > sender_index_;
+
+    //! gids of senders, sorted, for lookup during simulation
+    std::vector< index > gids_;
+
+    //! index in S_.senders_ for each entry of gids_
+    std::vector< size_t > indices_;
+  };
+
+  // ------------------------------------------------------------
+
+  PseudoRecordingDevice device_;
+  Parameters_ P_;
+  State_ S_;
+  Buffers_ B_;
+};
+
+inline void
+spike_statistics_detector::set_status( const DictionaryDatum& d )
+{
+  Parameters_ ptmp = P_;
+  bool clear = ptmp.set( d, *this );
+
+  long n_events;
+  if ( updateValue< long >( d, names::n_events, n_events ) )
+  {
+    if ( n_events != 0 )
+    {
+      throw BadProperty(
+        "Property n_events can only be set to 0 (which clears all "
+        "statistics)." );
+    }
+    clear = true;
+  }
+
+  device_.set_status( d );
+  P_ = ptmp;
+  if ( clear )
+  {
+    S_.clear( P_ );
+  }
+}
+
+} // namespace
+
+#endif /* #ifndef SPIKE_STATISTICS_DETECTOR_H */
@@ -129,6 +129,7 @@ nest::spin_detector::update( Time const&, const long, const long )
   // do not use swap here to clear, since we want to keep the reserved()
   // memory for the next round
   B_.spikes_[ kernel().event_delivery_manager.read_toggle() ].clear();
+  device_.publish_records();
 }
 
 void
@@ -93,6 +93,12 @@ public:
     return false;
   }
 
+  bool
+  independent_of_delivery() const
+  {
+    return true;
+  }
+
   port send_test_event( Node&, rport, synindex, bool );
 
   using Node::handle;
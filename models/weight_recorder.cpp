@@ -163,6 +163,7 @@ nest::weight_recorder::update( Time const&, const long from, const long to )
   // do not use swap here to clear, since we want to keep the reserved()
   // memory for the next round
   B_.events_.clear();
+  device_.publish_records();
 }
 
 void
@@ -32,6 +32,7 @@
 // Includes from libnestutil:
 #include "logging.h"
 #include "logging_event.h"
+#include "stopwatch.h"
 
 // Includes from librandom:
 #include "random_numbers.h"
@@ -55,6 +56,8 @@
 #include "oosupport.h"
 #include "processes.h"
 #include "sliarray.h"
+#include "sliexceptions.h"
+#include "slifunction.h"
 #include "sligraphics.h"
 #include "sliregexp.h"
 #include "slistartup.h"
@@ -80,6 +83,29 @@ sli_logging( const nest::LoggingEvent& e )
     static_cast< int >( e.severity ), e.function.c_str(), e.message.c_str() );
 }
 
+/*
+ * The SLI startup runs the module initializers and then directly the
+ * commands given on the command line, so the end of the SLI initialization
+ * is marked by a module initializer calling this function.
+ */
+class SLIInitDoneFunction : public SLIFunction
+{
+public:
+  void
+  execute( SLIInterpreter* i ) const
+  {
+    sli_init_timer.stop();
+    nest::kernel().set_startup_time(
+      nest::names::sli_init, sli_init_timer.elapsed() );
+    i->EStack.pop();
+  }
+
+  static nest::Stopwatch sli_init_timer;
+};
+
+nest::Stopwatch SLIInitDoneFunction::sli_init_timer;
+SLIInitDoneFunction sliinitdonefunction;
+
 #ifndef _IS_PYNEST
 int
 neststartup( int* argc, char*** argv, SLIInterpreter& engine )
@@ -113,6 +139,9 @@ neststartup( int* argc,
   std::ios::sync_with_stdio( false );
 #endif
 
+  nest::Stopwatch module_init_timer;
+  module_init_timer.start();
+
   addmodule< OOSupportModule >( engine );
   addmodule< RandomNumbers >( engine );
 
@@ -175,15 +204,26 @@ neststartup( int* argc,
 #endif
 #endif
 
-#ifdef _IS_PYNEST
-  // add the init-script to the list of module initializers
+  module_init_timer.stop();
+  nest::kernel().set_startup_time(
+    nest::names::module_init, module_init_timer.elapsed() );
+
   ArrayDatum* ad = dynamic_cast< ArrayDatum* >(
     engine.baselookup( engine.commandstring_name ).datum() );
   assert( ad != NULL );
+
+#ifdef _IS_PYNEST
+  // add the init-script to the list of module initializers
   ad->push_back(
     new StringDatum( "(" + modulepath + "/pynest-init.sli) run" ) );
 #endif
 
+  // record the duration of the SLI initialization after all other
+  // module initializers have run
+  engine.createcommand( ":sli_init_done", &sliinitdonefunction );
+  ad->push_back( new StringDatum( ":sli_init_done" ) );
+
+  SLIInitDoneFunction::sli_init_timer.start();
   return engine.startup();
 }
 
@@ -194,6 +234,34 @@ nestshutdown( int exitcode )
   nest::KernelManager::destroy_kernel_manager();
 }
 
+#ifdef _IS_PYNEST
+void
+CYTHON_currentException( std::string& name, std::string& message )
+{
+  // rethrow the exception to inspect its type, as the interpreter does
+  // in SLIInterpreter::raiseerror()
+  try
+  {
+    throw;
+  }
+  catch ( SLIException& e )
+  {
+    name = e.what();
+    message = e.message();
+  }
+  catch ( std::exception& e )
+  {
+    name = "C++Exception";
+    message = e.what();
+  }
+  catch ( ... )
+  {
+    name = "UnknownException";
+    message = "";
+  }
+}
+#endif
+
 #if defined( HAVE_LIBNEUROSIM ) && defined( _IS_PYNEST )
 Datum*
 CYTHON_unpackConnectionGeneratorDatum( PyObject* obj )
@@ -52,11 +52,22 @@ class SLIInterpreter;
 #define CYTHON_DEREF( x ) ( *x )
 #define CYTHON_ADDR( x ) ( &x )
 
+// Entry of a dictionary, throws UndefinedName if the key is not known
+#define CYTHON_DICT_LOOKUP( d, key ) ( ( *d )->lookup2( key ).datum() )
+
 #include <string>
 int neststartup( int* argc,
   char*** argv,
   SLIInterpreter& engine,
   std::string modulepath = "" );
+
+/**
+ * Retrieve error name and message of the exception currently handled.
+ * PyNEST calls this from the handler for exceptions thrown by kernel
+ * functions it calls directly, i.e., not through the interpreter. Must
+ * only be called inside a catch block.
+ */
+void CYTHON_currentException( std::string& name, std::string& message );
 #else  // #ifdef _IS_PYNEST
 int neststartup( int* argc, char*** argv, SLIInterpreter& engine );
 #endif // #ifdef _IS_PYNEST
@@ -70,6 +70,15 @@ public:
    * Copy Constructor.
    */
   Archiving_Node( const Archiving_Node& );
+  /**
+   * Return the number of entries in the spike history.
+   */
+  size_t
+  get_history_size() const
+  {
+    return history_.size();
+  }
+
   /**
 
    * \fn double get_Ca_minus()
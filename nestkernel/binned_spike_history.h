@@ -0,0 +1,198 @@
+/*
+ *  binned_spike_history.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef BINNED_SPIKE_HISTORY_H
+#define BINNED_SPIKE_HISTORY_H
+
+// C++ includes:
+#include <algorithm>
+#include <deque>
+#include <vector>
+
+namespace nest
+{
+
+/**
+ * Spike trains of several channels, aggregated per time step.
+ *
+ * Used by the correlation devices in binned mode: handle() only appends
+ * incoming spikes with add(), and update() obtains all spikes delivered
+ * since the last update, merged into one bin per time step and channel
+ * and sorted by step and channel, from collect(). After the bins have
+ * been correlated with each other and with the history, commit() moves
+ * them to the history. The history is kept sorted by step and channel and
+ * is pruned to the steps that can still be correlated with later spikes.
+ *
+ * Since all spikes of a bin have the same time stamp, a pair of bins
+ * stands for all pairs of their spikes, whence the cost of correlating
+ * spike trains depends on the number of occupied bins instead of the
+ * number of spikes.
+ */
+class BinnedSpikeHistory
+{
+public:
+  struct Bin
+  {
+    long step;
+    long channel;
+    double weight;      //!< sum of multiplicity * weight of all spikes
+    long multiplicity;  //!< sum of multiplicities of all spikes
+    long n_spikes;      //!< number of spike events
+    double self_weight; //!< sum of weight products of pairs within the bin
+    long self_multiplicity; //!< pairs within the bin, counted on arrival
+
+    bool operator<( const Bin& rhs ) const
+    {
+      return step < rhs.step || ( step == rhs.step && channel < rhs.channel );
+    }
+  };
+
+  typedef std::deque< Bin >::const_iterator const_iterator;
+
+  /**
+   * Add a spike with the given weight, which includes the multiplicity.
+   */
+  void
+  add( const long step,
+    const long channel,
+    const double weight,
+    const long multiplicity )
+  {
+    Spike_ s = { step, channel, weight, multiplicity };
+    pending_.push_back( s );
+  }
+
+  bool
+  has_pending() const
+  {
+    return not pending_.empty();
+  }
+
+  /**
+   * Merge all spikes added since the last commit into bins.
+   *
+   * Spikes of a bin keep their order of arrival, so that the pairs within
+   * the bin, including the pair of each spike with itself, are counted as
+   * if each spike was correlated with the spikes of the bin that arrived
+   * before it.
+   */
+  const std::vector< Bin >&
+  collect()
+  {
+    std::stable_sort( pending_.begin(), pending_.end() );
+    block_.clear();
+    for ( std::vector< Spike_ >::const_iterator s = pending_.begin();
+          s != pending_.end();
+          ++s )
+    {
+      if ( block_.empty() or block_.back().step != s->step
+        or block_.back().channel != s->channel )
+      {
+        Bin b = { s->step, s->channel, 0.0, 0, 0, 0.0, 0 };
+        block_.push_back( b );
+      }
+      Bin& b = block_.back();
+      b.weight += s->weight;
+      b.multiplicity += s->multiplicity;
+      ++b.n_spikes;
+      b.self_weight += s->weight * b.weight;
+      b.self_multiplicity += s->multiplicity * b.n_spikes;
+    }
+    pending_.clear();
+    return block_;
+  }
+
+  //! First bin of the history with a step not before the given one.
+  const_iterator
+  lower_bound( const long step ) const
+  {
+    const Bin b = { step, 0, 0.0, 0, 0, 0.0, 0 };
+    return std::lower_bound( history_.begin(), history_.end(), b );
+  }
+
+  const_iterator
+  end() const
+  {
+    return history_.end();
+  }
+
+  /**
+   * Move the collected bins to the history and drop all bins from the
+   * history with a step before first_step.
+   */
+  void
+  commit( const long first_step )
+  {
+    if ( not history_.empty() and not block_.empty()
+      and block_.front() < history_.back() )
+    {
+      // late spikes, which must be merged into the history
+      std::deque< Bin > merged( history_.size() + block_.size() );
+      std::merge( history_.begin(),
+        history_.end(),
+        block_.begin(),
+        block_.end(),
+        merged.begin() );
+      history_.swap( merged );
+    }
+    else
+    {
+      history_.insert( history_.end(), block_.begin(), block_.end() );
+    }
+    block_.clear();
+
+    while ( not history_.empty() and history_.front().step < first_step )
+    {
+      history_.pop_front();
+    }
+  }
+
+  void
+  clear()
+  {
+    pending_.clear();
+    block_.clear();
+    history_.clear();
+  }
+
+private:
+  struct Spike_
+  {
+    long step;
+    long channel;
+    double weight;
+    long multiplicity;
+
+    bool operator<( const Spike_& rhs ) const
+    {
+      return step < rhs.step || ( step == rhs.step && channel < rhs.channel );
+    }
+  };
+
+  std::vector< Spike_ > pending_; //!< spikes added since the last commit
+  std::vector< Bin > block_;      //!< bins of the pending spikes
+  std::deque< Bin > history_;     //!< committed bins, sorted
+};
+
+} // namespace nest
+
+#endif /* #ifndef BINNED_SPIKE_HISTORY_H */
@@ -26,8 +26,11 @@
 #include "config.h"
 
 // C++ includes:
+#include <algorithm>
 #include <cassert>
 #include <cmath>
+#include <deque>
+#include <iterator>
 #include <set>
 #include <vector>
 
@@ -52,13 +55,13 @@
 #include "vp_manager_impl.h"
 
 // Includes from sli:
+#include "allocator.h"
 #include "dictutils.h"
 #include "sliexceptions.h"
 #include "token.h"
 #include "tokenutils.h"
 
 #ifdef USE_PMA
-#include "allocator.h"
 #ifdef IS_K
 extern PaddedPMA poormansallocpool[];
 #else // not IS_K
@@ -102,10 +105,30 @@ nest::ConnectionManager::initialize()
   tVVCounter tmp3( kernel().vp_manager.get_num_threads(), tVCounter() );
   vv_num_connections_.swap( tmp3 );
 
+  std::vector< std::vector< std::vector< index > > > tmp4(
+    kernel().vp_manager.get_num_threads() );
+  neuromod_sources_.swap( tmp4 );
+
+  std::vector< std::vector< size_t > > tmp5(
+    kernel().vp_manager.get_num_threads() );
+  neuromod_sorted_.swap( tmp5 );
+
   // The following line is executed by all processes, no need to communicate
   // this change in delays.
   min_delay_ = max_delay_ = 1;
 
+#ifndef USE_PMA
+  // each thread creates its own arena, so that it lies in local memory
+  std::vector< sli::arena* > tmp6(
+    kernel().vp_manager.get_num_threads(), static_cast< sli::arena* >( 0 ) );
+  connector_arenas_.swap( tmp6 );
+#pragma omp parallel
+  {
+    connector_arenas_[ kernel().vp_manager.get_thread_id() ] =
+      new sli::arena();
+  }
+#endif
+
 #ifdef _OPENMP
 #ifdef USE_PMA
 // initialize the memory pools
@@ -128,6 +151,17 @@ void
 nest::ConnectionManager::finalize()
 {
   delete_connections_();
+
+  // Connectors may have been freed to the arena of another thread than
+  // the one they were allocated from, so arenas can only release their
+  // memory once all connectors are gone.
+  for ( std::vector< sli::arena* >::iterator it = connector_arenas_.begin();
+        it != connector_arenas_.end();
+        ++it )
+  {
+    delete *it;
+  }
+  connector_arenas_.clear();
 }
 
 void
@@ -210,6 +244,63 @@ nest::ConnectionManager::get_status( DictionaryDatum& d )
 
   size_t n = get_num_connections();
   def< long >( d, names::num_connections, n );
+
+  // Memory of connector objects per thread. Connections beyond the
+  // connector cutoff are stored in std::vector and not included.
+  std::vector< long > allocated( connector_arenas_.size(), 0 );
+  std::vector< long > used( connector_arenas_.size(), 0 );
+  std::vector< long > fragmented( connector_arenas_.size(), 0 );
+  for ( size_t t = 0; t < connector_arenas_.size(); ++t )
+  {
+    allocated[ t ] = connector_arenas_[ t ]->get_allocated();
+    used[ t ] = connector_arenas_[ t ]->get_used();
+    fragmented[ t ] = connector_arenas_[ t ]->get_fragmented();
+  }
+  def< std::vector< long > >( d, names::connector_memory_allocated, allocated );
+  def< std::vector< long > >( d, names::connector_memory_used, used );
+  def< std::vector< long > >(
+    d, names::connector_memory_fragmented, fragmented );
+}
+
+void
+nest::ConnectionManager::get_memory_status( DictionaryDatum& d ) const
+{
+  // Connections are counted by their size, storage overhead of the
+  // containers holding them is reported for the connectors.
+  DictionaryDatum connections( new Dictionary );
+  const size_t n_syn = kernel().model_manager.get_num_synapse_prototypes();
+  for ( synindex syn_id = 0; syn_id < n_syn; ++syn_id )
+  {
+    std::vector< long > bytes( vv_num_connections_.size(), 0 );
+    bool has_connections = false;
+    for ( size_t t = 0; t < vv_num_connections_.size(); ++t )
+    {
+      // prototypes of unused synapse types may not have been created
+      if ( syn_id < vv_num_connections_[ t ].size()
+        && vv_num_connections_[ t ][ syn_id ] > 0 )
+      {
+        bytes[ t ] = vv_num_connections_[ t ][ syn_id ]
+          * kernel()
+              .model_manager.get_synapse_prototype( syn_id, t )
+              .get_connection_size();
+        has_connections |= bytes[ t ] > 0;
+      }
+    }
+    if ( has_connections )
+    {
+      def< std::vector< long > >( connections,
+        kernel().model_manager.get_synapse_prototype( syn_id ).get_name(),
+        bytes );
+    }
+  }
+  def< DictionaryDatum >( d, names::connections, connections );
+
+  std::vector< long > connectors( connector_arenas_.size(), 0 );
+  for ( size_t t = 0; t < connector_arenas_.size(); ++t )
+  {
+    connectors[ t ] = connector_arenas_[ t ]->get_allocated();
+  }
+  def< std::vector< long > >( d, names::connectors, connectors );
 }
 
 DictionaryDatum
@@ -688,6 +779,11 @@ nest::ConnectionManager::connect_( Node& s,
                        .model_manager.get_synapse_prototype( syn, tid )
                        .add_connection( s, r, conn, syn, d, w );
   connections_[ tid ].set( s_gid, c );
+  register_neuromodulated_source_( tid, syn, s_gid );
+  // called in parallel for targets on thread tid, sources may belong to
+  // other threads
+  kernel().node_manager.set_node_modified( s, tid );
+  kernel().node_manager.set_node_modified( r, tid );
   // TODO: set size of vv_num_connections in init
   if ( vv_num_connections_[ tid ].size() <= syn )
   {
@@ -712,6 +808,11 @@ nest::ConnectionManager::connect_( Node& s,
                        .model_manager.get_synapse_prototype( syn, tid )
                        .add_connection( s, r, conn, syn, p, d, w );
   connections_[ tid ].set( s_gid, c );
+  register_neuromodulated_source_( tid, syn, s_gid );
+  // called in parallel for targets on thread tid, sources may belong to
+  // other threads
+  kernel().node_manager.set_node_modified( s, tid );
+  kernel().node_manager.set_node_modified( r, tid );
   // TODO: set size of vv_num_connections in init
   if ( vv_num_connections_[ tid ].size() <= syn )
   {
@@ -720,6 +821,139 @@ nest::ConnectionManager::connect_( Node& s,
   ++vv_num_connections_[ tid ][ syn ];
 }
 
+void
+nest::ConnectionManager::register_neuromodulated_source_( const thread tid,
+  const index syn,
+  const index s_gid )
+{
+  if ( kernel().model_manager.get_synapse_prototype( syn, tid ).get_vt_gid()
+    < 0 )
+  {
+    return;
+  }
+
+  if ( neuromod_sources_[ tid ].size() <= syn )
+  {
+    neuromod_sources_[ tid ].resize( syn + 1 );
+    neuromod_sorted_[ tid ].resize( syn + 1, 0 );
+  }
+
+  // consecutive connections from the same source are common, avoid
+  // appending each of them
+  std::vector< index >& sources = neuromod_sources_[ tid ][ syn ];
+  if ( sources.empty() || sources.back() != s_gid )
+  {
+    sources.push_back( s_gid );
+  }
+}
+
+std::vector< nest::index >&
+nest::ConnectionManager::get_neuromodulated_sources_( const thread tid,
+  const index syn )
+{
+  std::vector< index >& sources = neuromod_sources_[ tid ][ syn ];
+  if ( neuromod_sorted_[ tid ][ syn ] < sources.size() )
+  {
+    std::sort( sources.begin(), sources.end() );
+    sources.erase(
+      std::unique( sources.begin(), sources.end() ), sources.end() );
+    neuromod_sorted_[ tid ][ syn ] = sources.size();
+  }
+  return sources;
+}
+
+void
+nest::ConnectionManager::replicate_connections( const index template_size,
+  const size_t n_instances )
+{
+  // collect the template connections before any copy is made
+  std::deque< ConnectionID > connectome;
+  for ( size_t syn_id = 0;
+        syn_id < kernel().model_manager.get_num_synapse_prototypes();
+        ++syn_id )
+  {
+    get_connections( connectome, 0, 0, syn_id, UNLABELED_CONNECTION );
+  }
+
+  // if all instances are laid out alike on the virtual processes, copies
+  // are created on the thread of the template connection
+  const bool same_threads =
+    template_size % kernel().vp_manager.get_num_virtual_processes() == 0;
+
+  for ( std::deque< ConnectionID >::const_iterator c = connectome.begin();
+        c != connectome.end();
+        ++c )
+  {
+    const index syn_id = c->get_synapse_model_id();
+    DictionaryDatum status = get_synapse_status(
+      c->get_source_gid(), syn_id, c->get_port(), c->get_target_thread() );
+
+    double weight = numerics::nan;
+    double delay = numerics::nan;
+    updateValue< double >( status, names::weight, weight );
+    if ( kernel().model_manager.get_synapse_prototype( syn_id ).has_delay() )
+    {
+      updateValue< double >( status, names::delay, delay );
+    }
+
+    // all other properties are passed on, except those fixed by the copy
+    DictionaryDatum params( new Dictionary );
+    for ( Dictionary::const_iterator it = status->begin(); it != status->end();
+          ++it )
+    {
+      if ( it->first != names::source and it->first != names::target
+        and it->first != names::synapse_model and it->first != names::size_of
+        and it->first != names::rport and it->first != names::weight
+        and it->first != names::delay )
+      {
+        ( *params )[ it->first ] = it->second;
+      }
+    }
+    if ( status->known( names::rport ) )
+    {
+      ( *params )[ names::receptor_type ] = ( *status )[ names::rport ];
+    }
+
+    for ( size_t k = 1; k < n_instances; ++k )
+    {
+      const index sgid = c->get_source_gid() + k * template_size;
+      const index tgid = c->get_target_gid() + k * template_size;
+      if ( not kernel().node_manager.is_local_gid( tgid ) )
+      {
+        continue;
+      }
+
+      thread tid = c->get_target_thread();
+      if ( not same_threads )
+      {
+        // only with a single process, see NodeManager::replicate_nodes()
+        const Node* target = kernel().node_manager.get_node( tgid );
+        const Node* source = kernel().node_manager.get_node( sgid );
+        if ( target->has_proxies() )
+        {
+          tid = target->get_thread();
+        }
+        else if ( target->local_receiver() )
+        {
+          tid = source->has_proxies()
+            ? source->get_thread()
+            : kernel().vp_manager.vp_to_thread(
+                kernel().vp_manager.suggest_vp( tgid ) );
+        }
+      }
+
+      connect_( *kernel().node_manager.get_node( sgid, tid ),
+        *kernel().node_manager.get_node( tgid, tid ),
+        sgid,
+        tid,
+        syn_id,
+        params,
+        delay,
+        weight );
+    }
+  }
+}
+
 /**
  * Works in a similar way to connect, same logic but removes a connection.
  * @param target target node
@@ -768,6 +1002,7 @@ nest::ConnectionManager::disconnect( Node& target,
       connections_[ target_thread ].set( sgid, c );
     }
     --vv_num_connections_[ target_thread ][ syn_id ];
+    kernel().node_manager.set_node_modified( target );
   }
 }
 
@@ -879,6 +1114,9 @@ nest::ConnectionManager::data_connect_single( const index source_id,
     return;
   }
 
+  // create the per-thread prototypes before connecting in parallel
+  kernel().model_manager.get_synapse_prototype( syn );
+
 #pragma omp parallel private( di_s )
   {
     thread tid = kernel().vp_manager.get_thread_id();
@@ -1043,16 +1281,59 @@ nest::ConnectionManager::trigger_update_weight( const long vt_id,
   const double t_trig )
 {
   const index t = kernel().vp_manager.get_thread_id();
-  for ( tSConnector::const_nonempty_iterator it =
-          connections_[ t ].nonempty_begin();
-        it != connections_[ t ].nonempty_end();
-        ++it )
+  const std::vector< ConnectorModel* >& cm =
+    kernel().model_manager.get_synapse_prototypes( t );
+
+  // find synapse models using this volume transmitter; the volume
+  // transmitter of a model may have been changed after connecting
+  std::vector< index > syn_ids;
+  for ( index syn = 0; syn < neuromod_sources_[ t ].size(); ++syn )
+  {
+    if ( not neuromod_sources_[ t ][ syn ].empty()
+      && cm[ syn ]->get_vt_gid() == vt_id )
+    {
+      syn_ids.push_back( syn );
+    }
+  }
+
+  if ( syn_ids.empty() )
   {
-    validate_pointer( *it )->trigger_update_weight( vt_id,
-      t,
-      dopa_spikes,
-      t_trig,
-      kernel().model_manager.get_synapse_prototypes( t ) );
+    return;
+  }
+
+  // A connector updates all its synapses using this volume transmitter,
+  // so each source must be visited only once.
+  std::vector< index > merged;
+  const std::vector< index >* sources =
+    &get_neuromodulated_sources_( t, syn_ids[ 0 ] );
+  for ( size_t i = 1; i < syn_ids.size(); ++i )
+  {
+    const std::vector< index >& other =
+      get_neuromodulated_sources_( t, syn_ids[ i ] );
+    std::vector< index > tmp;
+    std::set_union( sources->begin(),
+      sources->end(),
+      other.begin(),
+      other.end(),
+      std::back_inserter( tmp ) );
+    merged.swap( tmp );
+    sources = &merged;
+  }
+
+  for ( std::vector< index >::const_iterator sgid = sources->begin();
+        sgid != sources->end();
+        ++sgid )
+  {
+    if ( *sgid >= connections_[ t ].size() )
+    {
+      break;
+    }
+    ConnectorBase* conn = connections_[ t ].get( *sgid );
+    if ( conn != 0 )
+    {
+      validate_pointer( conn )->trigger_update_weight(
+        vt_id, t, dopa_spikes, t_trig, cm );
+    }
   }
 }
 
@@ -1371,6 +1652,23 @@ nest::ConnectionManager::get_connections(
 }
 
 
+void
+nest::ConnectionManager::get_secondary_sources( const thread t,
+  std::vector< index >& sources ) const
+{
+  sources.clear();
+  for ( tSConnector::const_nonempty_iterator it =
+          connections_[ t ].nonempty_begin();
+        it != connections_[ t ].nonempty_end();
+        ++it )
+  {
+    if ( has_secondary( *it ) )
+    {
+      sources.push_back( connections_[ t ].get_pos( it ) );
+    }
+  }
+}
+
 void
 nest::ConnectionManager::get_sources( std::vector< index > targets,
   std::vector< std::vector< index > >& sources,
@@ -44,6 +44,11 @@
 #include "dict.h"
 #include "dictdatum.h"
 
+namespace sli
+{
+class arena;
+}
+
 namespace nest
 {
 class ConnectorBase;
@@ -80,6 +85,12 @@ public:
   virtual void set_status( const DictionaryDatum& );
   virtual void get_status( DictionaryDatum& );
 
+  /**
+   * Report bytes of connections per synapse model and of connector
+   * objects, each for every thread.
+   */
+  void get_memory_status( DictionaryDatum& ) const;
+
   DictionaryDatum& get_connruledict();
 
   /**
@@ -172,6 +183,15 @@ public:
 
   void subnet_connect( Subnet&, Subnet&, int, index syn );
 
+  /**
+   * Copy all connections among the template nodes of an ensemble to the
+   * other instances, see NodeManager::replicate_nodes(). A connection from
+   * s to t is copied to s + k * template_size and t + k * template_size for
+   * each instance k, with the same synapse model and properties.
+   */
+  void replicate_connections( const index template_size,
+    const size_t n_instances );
+
   /**
    * Connect, using a dictionary with arrays.
    * The connection rule is based on the details of the dictionary entries
@@ -242,6 +262,12 @@ public:
     std::vector< std::vector< index > >& sources,
     index synapse_model );
 
+  /**
+   * Store the gids of all nodes with secondary connections on thread t in
+   * sources, in increasing order.
+   */
+  void get_secondary_sources( thread t, std::vector< index >& sources ) const;
+
   void get_targets( const std::vector< index >& sources,
     std::vector< std::vector< index > >& targets,
     const index synapse_model,
@@ -251,6 +277,8 @@ public:
    * Triggered by volume transmitter in update.
    * Triggeres updates for all connectors of dopamine synapses that
    * are registered with the volume transmitter with gid vt_gid.
+   * Only connectors of sources registered in neuromod_sources_ for a
+   * synapse model using this volume transmitter are visited.
    */
   void trigger_update_weight( const long vt_gid,
     const std::vector< spikecounter >& dopa_spikes,
@@ -313,6 +341,11 @@ public:
    */
   double get_large_connector_growth_factor() const;
 
+  /**
+   * Returns the arena from which thread tid allocates connectors.
+   */
+  sli::arena& get_connector_arena( thread tid );
+
 private:
   /**
    * Update delay extrema to current values.
@@ -335,7 +368,8 @@ private:
   const Time get_max_delay_time_() const;
 
   /**
-   * Deletes all connections and also frees the PMA.
+   * Deletes all connections and also frees the PMA or the connector
+   * arenas.
    */
   void delete_connections_();
 
@@ -376,6 +410,18 @@ private:
     double d = numerics::nan,
     double w = numerics::nan );
 
+  /**
+   * Register source of a new connection in neuromod_sources_, if the
+   * synapse model is neuromodulated.
+   */
+  void register_neuromodulated_source_( thread tid, index syn, index s_gid );
+
+  /**
+   * Sort and remove duplicates from registered sources of given synapse
+   * model on given thread.
+   */
+  std::vector< index >& get_neuromodulated_sources_( thread tid, index syn );
+
   /**
    * A 3-dim structure to hold the Connector objects which in turn hold the
    * connection information.
@@ -386,6 +432,20 @@ private:
    */
   tVSConnector connections_;
 
+  /**
+   * Sources of connections of neuromodulated synapse models, i.e.,
+   * models with a volume transmitter.
+   * - First dim: A std::vector for each local thread
+   * - Second dim: A std::vector for each synapse prototype
+   * - Third dim: GIDs of sources, sorted and unique up to the position
+   *   stored in neuromod_sorted_; later entries have been appended by
+   *   connect_() since the last call to trigger_update_weight().
+   * Entries are not removed when connections are deleted, visiting a
+   * connector without matching synapses is harmless.
+   */
+  std::vector< std::vector< std::vector< index > > > neuromod_sources_;
+  std::vector< std::vector< size_t > > neuromod_sorted_;
+
   tVDelayChecker delay_checkers_;
 
   tVVCounter vv_num_connections_;
@@ -419,6 +479,9 @@ private:
 
   //! Capacity growth factor to use beyond the limit
   double large_connector_growth_factor_;
+
+  //! Connector memory of each thread, unused if compiled with USE_PMA
+  std::vector< sli::arena* > connector_arenas_;
 };
 
 inline DictionaryDatum&
@@ -457,6 +520,12 @@ ConnectionManager::get_large_connector_growth_factor() const
   return large_connector_growth_factor_;
 }
 
+inline sli::arena&
+ConnectionManager::get_connector_arena( thread tid )
+{
+  return *connector_arenas_[ tid ];
+}
+
 } // namespace nest
 
 #endif /* CONNECTION_MANAGER_H */
@@ -46,6 +46,7 @@
 #include "spikecounter.h"
 
 // Includes from sli:
+#include "allocator.h"
 #include "dictutils.h"
 
 #ifdef USE_PMA
@@ -195,6 +196,31 @@ public:
   // destructor needed to delete connections
   virtual ~ConnectorBase(){};
 
+#ifndef USE_PMA
+  /**
+   * Connectors are allocated from the arena of the calling thread. The
+   * sized delete receives the size of the dynamic type, since the
+   * destructor is virtual.
+   */
+  static void*
+  operator new( size_t size )
+  {
+    return kernel()
+      .connection_manager.get_connector_arena(
+        kernel().vp_manager.get_thread_id() )
+      .alloc( size );
+  }
+
+  static void
+  operator delete( void* p, size_t size )
+  {
+    kernel()
+      .connection_manager.get_connector_arena(
+        kernel().vp_manager.get_thread_id() )
+      .free( p, size );
+  }
+#endif
+
   double
   get_t_lastspike() const
   {
@@ -150,6 +150,17 @@ public:
 
   virtual const CommonSynapseProperties& get_common_properties() const = 0;
 
+  /**
+   * Return GID of the volume transmitter of neuromodulated synapse models,
+   * -1 for all other models.
+   */
+  virtual long get_vt_gid() const = 0;
+
+  /**
+   * Return the size of one connection of this model in bytes.
+   */
+  virtual size_t get_connection_size() const = 0;
+
   /**
    * Checks to see if illegal parameters are given in syn_spec.
    */
@@ -267,6 +278,18 @@ public:
     return cp_;
   }
 
+  long
+  get_vt_gid() const
+  {
+    return cp_.get_vt_gid();
+  }
+
+  size_t
+  get_connection_size() const
+  {
+    return sizeof( ConnectionT );
+  }
+
   void set_syn_id( synindex syn_id );
 
   virtual typename ConnectionT::EventType*
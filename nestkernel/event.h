@@ -45,6 +45,7 @@ namespace nest
 {
 
 class Node;
+class PopulationDataBuffer;
 
 /**
  * Encapsulates information which is sent between Nodes.
@@ -581,6 +582,14 @@ public:
    *  and vector of recordables. */
   DataLoggingRequest( const Time&, const Time&, const std::vector< Name >& );
 
+  /** Create event requesting that data be written directly into the given
+   *  column of a PopulationDataBuffer. */
+  DataLoggingRequest( const Time&,
+    const Time&,
+    const std::vector< Name >&,
+    PopulationDataBuffer&,
+    size_t );
+
   DataLoggingRequest* clone() const;
 
   void operator()();
@@ -594,6 +603,12 @@ public:
   /** Access to vector of recordables. */
   const std::vector< Name >& record_from() const;
 
+  /** Access to buffer for population recording, 0 for ordinary requests. */
+  PopulationDataBuffer* get_population_buffer() const;
+
+  /** Access to column in buffer for population recording. */
+  size_t get_population_column() const;
+
 private:
   //! Interval between two recordings, first is step 1
   Time recording_interval_;
@@ -606,6 +621,12 @@ private:
    * routine.
    */
   std::vector< Name > const* const record_from_;
+
+  //! Buffer into which data is written directly, if given
+  PopulationDataBuffer* population_buffer_;
+
+  //! Column of recorded node in population_buffer_
+  size_t population_column_;
 };
 
 inline DataLoggingRequest::DataLoggingRequest()
@@ -613,6 +634,8 @@ inline DataLoggingRequest::DataLoggingRequest()
   , recording_interval_( Time::neg_inf() )
   , recording_offset_( Time::ms( 0. ) )
   , record_from_( 0 )
+  , population_buffer_( 0 )
+  , population_column_( 0 )
 {
 }
 
@@ -621,6 +644,8 @@ inline DataLoggingRequest::DataLoggingRequest( const Time& rec_int,
   : Event()
   , recording_interval_( rec_int )
   , record_from_( &recs )
+  , population_buffer_( 0 )
+  , population_column_( 0 )
 {
 }
 
@@ -631,6 +656,22 @@ inline DataLoggingRequest::DataLoggingRequest( const Time& rec_int,
   , recording_interval_( rec_int )
   , recording_offset_( rec_offset )
   , record_from_( &recs )
+  , population_buffer_( 0 )
+  , population_column_( 0 )
+{
+}
+
+inline DataLoggingRequest::DataLoggingRequest( const Time& rec_int,
+  const Time& rec_offset,
+  const std::vector< Name >& recs,
+  PopulationDataBuffer& buffer,
+  size_t column )
+  : Event()
+  , recording_interval_( rec_int )
+  , recording_offset_( rec_offset )
+  , record_from_( &recs )
+  , population_buffer_( &buffer )
+  , population_column_( column )
 {
 }
 
@@ -668,6 +709,18 @@ DataLoggingRequest::record_from() const
   return *record_from_;
 }
 
+inline PopulationDataBuffer*
+DataLoggingRequest::get_population_buffer() const
+{
+  return population_buffer_;
+}
+
+inline size_t
+DataLoggingRequest::get_population_column() const
+{
+  return population_column_;
+}
+
 /**
  * Provide logged data through request transmitting reference.
  * @see DataLoggingRequest
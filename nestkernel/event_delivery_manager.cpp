@@ -23,7 +23,7 @@
 #include "event_delivery_manager.h"
 
 // C++ includes:
-#include <algorithm> // rotate
+#include <algorithm> // find, rotate
 
 // Includes from libnestutil:
 #include "logging.h"
@@ -41,6 +41,12 @@ namespace nest
 {
 EventDeliveryManager::EventDeliveryManager()
   : off_grid_spiking_( false )
+  , compact_off_grid_spiking_( false )
+  , pipelined_communication_( false )
+  , use_rate_engine_( false )
+  , rate_engine_()
+  , exchange_pending_( false )
+  , split_delivery_( false )
   , moduli_()
   , slice_moduli_()
   , spike_register_()
@@ -49,11 +55,22 @@ EventDeliveryManager::EventDeliveryManager()
   , global_grid_spikes_()
   , local_offgrid_spikes_()
   , global_offgrid_spikes_()
+  , local_compact_offgrid_spikes_()
+  , global_compact_offgrid_spikes_()
   , displacements_()
   , comm_marker_( 0 )
   , time_collocate_( 0.0 )
   , time_communicate_( 0.0 )
+  , time_exchange_( 0.0 )
+  , time_exchange_hidden_( 0.0 )
+  , stw_exchange_()
   , local_spike_counter_( 0U )
+  , spike_stream_subscribers_()
+  , time_spike_stream_()
+  , exchanged_slice_origin_()
+  , stream_gids_()
+  , stream_lags_()
+  , stream_offsets_()
 {
 }
 
@@ -64,6 +81,8 @@ EventDeliveryManager::~EventDeliveryManager()
   global_grid_spikes_.clear();
   local_offgrid_spikes_.clear();
   global_offgrid_spikes_.clear();
+  local_compact_offgrid_spikes_.clear();
+  global_compact_offgrid_spikes_.clear();
 }
 
 void
@@ -71,6 +90,10 @@ EventDeliveryManager::initialize()
 {
   // ensures that ResetKernel resets off_grid_spiking_
   off_grid_spiking_ = false;
+  compact_off_grid_spiking_ = false;
+  pipelined_communication_ = false;
+  use_rate_engine_ = false;
+  rate_engine_.reset();
   init_moduli();
   reset_timers_counters();
 }
@@ -83,34 +106,153 @@ EventDeliveryManager::finalize()
   global_grid_spikes_.clear();
   local_offgrid_spikes_.clear();
   global_offgrid_spikes_.clear();
+  local_compact_offgrid_spikes_.clear();
+  global_compact_offgrid_spikes_.clear();
+  rate_engine_.reset();
 }
 
 void
 EventDeliveryManager::set_status( const DictionaryDatum& dict )
 {
   updateValue< bool >( dict, names::off_grid_spiking, off_grid_spiking_ );
+  updateValue< bool >(
+    dict, names::compact_off_grid_spiking, compact_off_grid_spiking_ );
+  updateValue< bool >(
+    dict, names::pipelined_communication, pipelined_communication_ );
+
+  bool use_rate_engine = use_rate_engine_;
+  updateValue< bool >( dict, names::use_rate_engine, use_rate_engine );
+  if ( use_rate_engine != use_rate_engine_ )
+  {
+    if ( kernel().simulation_manager.has_been_simulated() )
+    {
+      throw KernelException(
+        "The rate network engine can only be enabled or disabled before the "
+        "first simulation. Please call ResetKernel first." );
+    }
+    use_rate_engine_ = use_rate_engine;
+  }
 }
 
 void
 EventDeliveryManager::get_status( DictionaryDatum& dict )
 {
   def< bool >( dict, names::off_grid_spiking, off_grid_spiking_ );
+  def< bool >(
+    dict, names::compact_off_grid_spiking, compact_off_grid_spiking_ );
   def< double >( dict, names::time_collocate, time_collocate_ );
   def< double >( dict, names::time_communicate, time_communicate_ );
+  def< bool >(
+    dict, names::pipelined_communication, pipelined_communication_ );
+  def< double >( dict,
+    names::communication_overlap,
+    time_exchange_ > 0.0 ? time_exchange_hidden_ / time_exchange_ : 0.0 );
   def< unsigned long >(
     dict, names::local_spike_counter, local_spike_counter_ );
+  def< bool >( dict, names::use_rate_engine, use_rate_engine_ );
+  def< bool >( dict, names::rate_engine_active, rate_engine_.is_active() );
+
+  DictionaryDatum spike_stream_times( new Dictionary );
+  for ( size_t i = 0; i < spike_stream_subscribers_.size(); ++i )
+  {
+    def< double >( spike_stream_times,
+      spike_stream_subscribers_[ i ]->get_name(),
+      time_spike_stream_[ i ] );
+  }
+  def< DictionaryDatum >( dict, names::spike_stream_times, spike_stream_times );
+}
+
+void
+EventDeliveryManager::register_spike_stream_subscriber(
+  SpikeStreamSubscriber& subscriber )
+{
+  if ( std::find( spike_stream_subscribers_.begin(),
+         spike_stream_subscribers_.end(),
+         &subscriber ) != spike_stream_subscribers_.end() )
+  {
+    throw KernelException( "Spike stream subscriber "
+      + subscriber.get_name() + " is already registered." );
+  }
+  spike_stream_subscribers_.push_back( &subscriber );
+  time_spike_stream_.push_back( 0.0 );
+}
+
+void
+EventDeliveryManager::unregister_spike_stream_subscriber(
+  SpikeStreamSubscriber& subscriber )
+{
+  std::vector< SpikeStreamSubscriber* >::iterator it =
+    std::find( spike_stream_subscribers_.begin(),
+      spike_stream_subscribers_.end(),
+      &subscriber );
+  if ( it != spike_stream_subscribers_.end() )
+  {
+    time_spike_stream_.erase( time_spike_stream_.begin()
+      + ( it - spike_stream_subscribers_.begin() ) );
+    spike_stream_subscribers_.erase( it );
+  }
+}
+
+void
+EventDeliveryManager::get_memory_status( DictionaryDatum& dict ) const
+{
+  std::vector< long > registers( spike_register_.size(), 0 );
+  for ( size_t t = 0; t < spike_register_.size(); ++t )
+  {
+    for ( size_t lag = 0; lag < spike_register_[ t ].size(); ++lag )
+    {
+      registers[ t ] +=
+        spike_register_[ t ][ lag ].capacity() * sizeof( unsigned int );
+    }
+    if ( t < offgrid_spike_register_.size() )
+    {
+      for ( size_t lag = 0; lag < offgrid_spike_register_[ t ].size(); ++lag )
+      {
+        registers[ t ] +=
+          offgrid_spike_register_[ t ][ lag ].capacity() * sizeof( OffGridSpike );
+      }
+    }
+    if ( t < secondary_events_buffer_.size() )
+    {
+      registers[ t ] +=
+        secondary_events_buffer_[ t ].capacity() * sizeof( unsigned int );
+    }
+  }
+  def< std::vector< long > >( dict, names::event_registers, registers );
+
+  const size_t communication_buffers =
+    ( local_grid_spikes_.capacity() + global_grid_spikes_.capacity() )
+      * sizeof( unsigned int )
+    + ( local_offgrid_spikes_.capacity() + global_offgrid_spikes_.capacity() )
+      * sizeof( OffGridSpike )
+    + ( local_compact_offgrid_spikes_.capacity()
+        + global_compact_offgrid_spikes_.capacity() )
+      * sizeof( CompactOffGridSpike )
+    + displacements_.capacity() * sizeof( int );
+  def< long >( dict, names::communication_buffers, communication_buffers );
 }
 
 void
 EventDeliveryManager::clear_pending_spikes()
 {
   configure_spike_buffers();
+  rate_engine_.clear_buffers();
+}
+
+void
+EventDeliveryManager::configure_rate_engine()
+{
+  rate_engine_.prepare( use_rate_engine_ );
 }
 
 void
 EventDeliveryManager::configure_spike_buffers()
 {
   assert( kernel().connection_manager.get_min_delay() != 0 );
+  assert( not exchange_pending_ );
+
+  // the initial receive buffers contain the events of all processes
+  split_delivery_ = false;
 
   spike_register_.clear();
   // the following line does not compile with gcc <= 3.3.5
@@ -166,6 +308,9 @@ EventDeliveryManager::configure_spike_buffers()
   local_grid_spikes_.resize( send_buffer_size, 0U );
   local_offgrid_spikes_.clear();
   local_offgrid_spikes_.resize( send_buffer_size, OffGridSpike( 0, 0.0 ) );
+  local_compact_offgrid_spikes_.clear();
+  local_compact_offgrid_spikes_.resize(
+    send_buffer_size, CompactOffGridSpike( 0, 0.0 ) );
 
   global_grid_spikes_.clear();
   global_grid_spikes_.resize( recv_buffer_size, 0U );
@@ -185,6 +330,9 @@ EventDeliveryManager::configure_spike_buffers()
 
   global_offgrid_spikes_.clear();
   global_offgrid_spikes_.resize( recv_buffer_size, OffGridSpike( 0, 0.0 ) );
+  global_compact_offgrid_spikes_.clear();
+  global_compact_offgrid_spikes_.resize(
+    recv_buffer_size, CompactOffGridSpike( 0, 0.0 ) );
 
   displacements_.clear();
   displacements_.resize( kernel().mpi_manager.get_num_processes(), 0 );
@@ -267,7 +415,10 @@ EventDeliveryManager::reset_timers_counters()
 {
   time_collocate_ = 0.0;
   time_communicate_ = 0.0;
+  time_exchange_ = 0.0;
+  time_exchange_hidden_ = 0.0;
   local_spike_counter_ = 0U;
+  std::fill( time_spike_stream_.begin(), time_spike_stream_.end(), 0.0 );
 }
 
 void
@@ -417,91 +568,267 @@ EventDeliveryManager::collocate_buffers_( bool done )
     // append the boolean value indicating whether we are done here
     write_to_comm_buffer( done, pos );
   }
-  else // off_grid_spiking
+  else if ( not compact_off_grid_spiking_ ) // off_grid_spiking
   {
-    // make sure buffers are correctly sized
-    if ( global_offgrid_spikes_.size()
-      != static_cast< unsigned int >(
-           kernel().mpi_manager.get_recv_buffer_size() ) )
-    {
-      global_offgrid_spikes_.resize(
-        kernel().mpi_manager.get_recv_buffer_size(), OffGridSpike( 0, 0.0 ) );
-    }
-    if ( num_spikes + ( kernel().vp_manager.get_num_threads()
-                        * kernel().connection_manager.get_min_delay() )
-      > static_cast< unsigned int >(
-           kernel().mpi_manager.get_send_buffer_size() ) )
-    {
-      local_offgrid_spikes_.resize(
-        ( num_spikes + ( kernel().connection_manager.get_min_delay()
-                         * kernel().vp_manager.get_num_threads() ) ),
-        OffGridSpike( 0, 0.0 ) );
-    }
-    else if ( local_offgrid_spikes_.size()
-      < static_cast< unsigned int >(
-                kernel().mpi_manager.get_send_buffer_size() ) )
+    collocate_offgrid_buffers_( local_offgrid_spikes_,
+      global_offgrid_spikes_,
+      num_spikes,
+      num_grid_spikes );
+  }
+  else // compact off_grid_spiking
+  {
+    collocate_offgrid_buffers_( local_compact_offgrid_spikes_,
+      global_compact_offgrid_spikes_,
+      num_spikes,
+      num_grid_spikes );
+  }
+}
+
+template < typename SpikeT >
+typename std::vector< SpikeT >::iterator
+EventDeliveryManager::copy_offgrid_spikes_(
+  const std::vector< OffGridSpike >& spikes,
+  typename std::vector< SpikeT >::iterator pos )
+{
+  for ( std::vector< OffGridSpike >::const_iterator n = spikes.begin();
+        n != spikes.end();
+        ++n )
+  {
+    *pos = SpikeT( n->get_gid(), n->get_offset() );
+    ++pos;
+  }
+  return pos;
+}
+
+template < typename SpikeT >
+void
+EventDeliveryManager::collocate_offgrid_buffers_(
+  std::vector< SpikeT >& local_offgrid_spikes,
+  std::vector< SpikeT >& global_offgrid_spikes,
+  int num_spikes,
+  int num_grid_spikes )
+{
+  std::vector< std::vector< std::vector< unsigned int > > >::iterator i;
+  std::vector< std::vector< unsigned int > >::iterator j;
+  std::vector< std::vector< std::vector< OffGridSpike > > >::iterator it;
+  std::vector< std::vector< OffGridSpike > >::iterator jt;
+
+  // make sure buffers are correctly sized
+  if ( global_offgrid_spikes.size()
+    != static_cast< unsigned int >(
+         kernel().mpi_manager.get_recv_buffer_size() ) )
+  {
+    global_offgrid_spikes.resize(
+      kernel().mpi_manager.get_recv_buffer_size(), SpikeT( 0, 0.0 ) );
+  }
+  if ( num_spikes + ( kernel().vp_manager.get_num_threads()
+                      * kernel().connection_manager.get_min_delay() )
+    > static_cast< unsigned int >(
+         kernel().mpi_manager.get_send_buffer_size() ) )
+  {
+    local_offgrid_spikes.resize(
+      ( num_spikes + ( kernel().connection_manager.get_min_delay()
+                       * kernel().vp_manager.get_num_threads() ) ),
+      SpikeT( 0, 0.0 ) );
+  }
+  else if ( local_offgrid_spikes.size()
+    < static_cast< unsigned int >(
+              kernel().mpi_manager.get_send_buffer_size() ) )
+  {
+    local_offgrid_spikes.resize(
+      kernel().mpi_manager.get_send_buffer_size(), SpikeT( 0, 0.0 ) );
+  }
+
+  // collocate the entries of spike_registers into local_offgrid_spikes
+  typename std::vector< SpikeT >::iterator pos = local_offgrid_spikes.begin();
+  if ( num_grid_spikes == 0 )
+  {
+    for ( it = offgrid_spike_register_.begin();
+          it != offgrid_spike_register_.end();
+          ++it )
     {
-      local_offgrid_spikes_.resize(
-        kernel().mpi_manager.get_send_buffer_size(), OffGridSpike( 0, 0.0 ) );
+      for ( jt = it->begin(); jt != it->end(); ++jt )
+      {
+        pos = copy_offgrid_spikes_< SpikeT >( *jt, pos );
+        pos->set_gid( comm_marker_ );
+        ++pos;
+      }
     }
-
-    // collocate the entries of spike_registers into local_offgrid_spikes__
-    std::vector< OffGridSpike >::iterator pos = local_offgrid_spikes_.begin();
-    if ( num_grid_spikes == 0 )
+  }
+  else
+  {
+    std::vector< unsigned int >::iterator n;
+    i = spike_register_.begin();
+    for ( it = offgrid_spike_register_.begin();
+          it != offgrid_spike_register_.end();
+          ++it )
     {
-      for ( it = offgrid_spike_register_.begin();
-            it != offgrid_spike_register_.end();
-            ++it )
+      j = i->begin();
+      for ( jt = it->begin(); jt != it->end(); ++jt )
       {
-        for ( jt = it->begin(); jt != it->end(); ++jt )
+        pos = copy_offgrid_spikes_< SpikeT >( *jt, pos );
+        for ( n = j->begin(); n != j->end(); ++n )
         {
-          pos = std::copy( jt->begin(), jt->end(), pos );
-          pos->set_gid( comm_marker_ );
+          *pos = SpikeT( *n, 0 );
           ++pos;
         }
+        pos->set_gid( comm_marker_ );
+        ++pos;
+        ++j;
       }
+      ++i;
     }
-    else
+    for ( i = spike_register_.begin(); i != spike_register_.end(); ++i )
     {
-      std::vector< unsigned int >::iterator n;
-      i = spike_register_.begin();
-      for ( it = offgrid_spike_register_.begin();
-            it != offgrid_spike_register_.end();
-            ++it )
+      for ( j = i->begin(); j != i->end(); ++j )
       {
-        j = i->begin();
-        for ( jt = it->begin(); jt != it->end(); ++jt )
-        {
-          pos = std::copy( jt->begin(), jt->end(), pos );
-          for ( n = j->begin(); n != j->end(); ++n )
-          {
-            *pos = OffGridSpike( *n, 0 );
-            ++pos;
-          }
-          pos->set_gid( comm_marker_ );
-          ++pos;
-          ++j;
-        }
-        ++i;
+        j->clear();
       }
-      for ( i = spike_register_.begin(); i != spike_register_.end(); ++i )
+    }
+  }
+
+  // empty offgrid_spike_register_
+  for ( it = offgrid_spike_register_.begin();
+        it != offgrid_spike_register_.end();
+        ++it )
+  {
+    for ( jt = it->begin(); jt != it->end(); ++jt )
+    {
+      jt->clear();
+    }
+  }
+}
+
+index
+EventDeliveryManager::get_spike_gid_( unsigned int spike )
+{
+  return spike;
+}
+
+void
+EventDeliveryManager::set_spike_offset_( SpikeEvent&, unsigned int )
+{
+}
+
+template < typename SpikeT >
+index
+EventDeliveryManager::get_spike_gid_( const SpikeT& spike )
+{
+  return spike.get_gid();
+}
+
+template < typename SpikeT >
+void
+EventDeliveryManager::set_spike_offset_( SpikeEvent& se, const SpikeT& spike )
+{
+  se.set_offset( spike.get_offset() );
+}
+
+double
+EventDeliveryManager::get_spike_offset_( unsigned int )
+{
+  return 0.0;
+}
+
+template < typename SpikeT >
+double
+EventDeliveryManager::get_spike_offset_( const SpikeT& spike )
+{
+  return spike.get_offset();
+}
+
+template < typename SpikeT >
+int
+EventDeliveryManager::deliver_vp_spikes_( thread t,
+  const std::vector< SpikeT >& spikes,
+  int pos,
+  const std::vector< Time >& prepared_timestamps,
+  SpikeEvent& se )
+{
+  int lag = kernel().connection_manager.get_min_delay() - 1;
+  while ( lag >= 0 )
+  {
+    index nid = get_spike_gid_( spikes[ pos ] );
+    if ( nid != static_cast< index >( comm_marker_ ) )
+    {
+      // tell all local nodes about spikes on remote machines.
+      se.set_stamp( prepared_timestamps[ lag ] );
+      se.set_sender_gid( nid );
+      set_spike_offset_( se, spikes[ pos ] );
+      kernel().connection_manager.send( t, nid, se );
+    }
+    else
+    {
+      --lag;
+    }
+    ++pos;
+  }
+  return pos;
+}
+
+template < typename SpikeT >
+void
+EventDeliveryManager::deliver_spikes_( thread t,
+  const std::vector< SpikeT >& local_spikes,
+  const std::vector< SpikeT >& global_spikes,
+  std::vector< int >& pos )
+{
+  SpikeEvent se;
+
+  // prepare Time objects for every possible time stamp within min_delay_
+  std::vector< Time > prepared_timestamps(
+    kernel().connection_manager.get_min_delay() );
+  for ( size_t lag = 0;
+        lag < ( size_t ) kernel().connection_manager.get_min_delay();
+        lag++ )
+  {
+    prepared_timestamps[ lag ] =
+      kernel().simulation_manager.get_clock() - Time::step( lag );
+  }
+
+  const size_t num_vps = kernel().vp_manager.get_num_virtual_processes();
+  const thread rank = kernel().mpi_manager.get_rank();
+
+  // deliver the spikes of this process from the send buffer, while the
+  // exchange with the other processes may still be in progress
+  int local_pos = 0;
+  if ( split_delivery_ )
+  {
+    for ( size_t vp = 0; vp < num_vps; ++vp )
+    {
+      if ( kernel().mpi_manager.get_process_id( vp ) == rank )
       {
-        for ( j = i->begin(); j != i->end(); ++j )
-        {
-          j->clear();
-        }
+        local_pos = deliver_vp_spikes_(
+          t, local_spikes, local_pos, prepared_timestamps, se );
       }
     }
 
-    // empty offgrid_spike_register_
-    for ( it = offgrid_spike_register_.begin();
-          it != offgrid_spike_register_.end();
-          ++it )
+    // all threads have read exchange_pending_ before the master resets it
+    if ( exchange_pending_ )
     {
-      for ( jt = it->begin(); jt != it->end(); ++jt )
+#pragma omp barrier
+#pragma omp master
       {
-        jt->clear();
+        finish_gather_events();
       }
+#pragma omp barrier
+    }
+  }
+
+  pos = displacements_;
+  if ( split_delivery_ )
+  {
+    // the spikes of this process have been delivered already
+    pos[ rank ] += local_pos;
+  }
+
+  for ( size_t vp = 0; vp < num_vps; ++vp )
+  {
+    const thread pid = kernel().mpi_manager.get_process_id( vp );
+    if ( not split_delivery_ or pid != rank )
+    {
+      pos[ pid ] = deliver_vp_spikes_(
+        t, global_spikes, pos[ pid ], prepared_timestamps, se );
     }
   }
 }
@@ -518,48 +845,11 @@ EventDeliveryManager::deliver_events( thread t )
   {
     return done;
   }
-  SpikeEvent se;
-
-  std::vector< int > pos( displacements_ );
+  std::vector< int > pos;
 
   if ( not off_grid_spiking_ ) // on_grid_spiking
   {
-    // prepare Time objects for every possible time stamp within min_delay_
-    std::vector< Time > prepared_timestamps(
-      kernel().connection_manager.get_min_delay() );
-    for ( size_t lag = 0;
-          lag < ( size_t ) kernel().connection_manager.get_min_delay();
-          lag++ )
-    {
-      prepared_timestamps[ lag ] =
-        kernel().simulation_manager.get_clock() - Time::step( lag );
-    }
-
-    for ( size_t vp = 0;
-          vp < ( size_t ) kernel().vp_manager.get_num_virtual_processes();
-          ++vp )
-    {
-      size_t pid = kernel().mpi_manager.get_process_id( vp );
-      int pos_pid = pos[ pid ];
-      int lag = kernel().connection_manager.get_min_delay() - 1;
-      while ( lag >= 0 )
-      {
-        index nid = global_grid_spikes_[ pos_pid ];
-        if ( nid != static_cast< index >( comm_marker_ ) )
-        {
-          // tell all local nodes about spikes on remote machines.
-          se.set_stamp( prepared_timestamps[ lag ] );
-          se.set_sender_gid( nid );
-          kernel().connection_manager.send( t, nid, se );
-        }
-        else
-        {
-          --lag;
-        }
-        ++pos_pid;
-      }
-      pos[ pid ] = pos_pid;
-    }
+    deliver_spikes_( t, local_grid_spikes_, global_grid_spikes_, pos );
 
     // here we are done with the spiking events
     // pos[pid] for each pid now points to the first entry of
@@ -608,45 +898,16 @@ EventDeliveryManager::deliver_events( thread t )
       done = done && done_p;
     }
   }
-  else // off grid spiking
+  else if ( not compact_off_grid_spiking_ ) // off grid spiking
   {
-    // prepare Time objects for every possible time stamp within min_delay_
-    std::vector< Time > prepared_timestamps(
-      kernel().connection_manager.get_min_delay() );
-    for ( size_t lag = 0;
-          lag < ( size_t ) kernel().connection_manager.get_min_delay();
-          lag++ )
-    {
-      prepared_timestamps[ lag ] =
-        kernel().simulation_manager.get_clock() - Time::step( lag );
-    }
-
-    for ( size_t vp = 0;
-          vp < ( size_t ) kernel().vp_manager.get_num_virtual_processes();
-          ++vp )
-    {
-      size_t pid = kernel().mpi_manager.get_process_id( vp );
-      int pos_pid = pos[ pid ];
-      int lag = kernel().connection_manager.get_min_delay() - 1;
-      while ( lag >= 0 )
-      {
-        index nid = global_offgrid_spikes_[ pos_pid ].get_gid();
-        if ( nid != static_cast< index >( comm_marker_ ) )
-        {
-          // tell all local nodes about spikes on remote machines.
-          se.set_stamp( prepared_timestamps[ lag ] );
-          se.set_sender_gid( nid );
-          se.set_offset( global_offgrid_spikes_[ pos_pid ].get_offset() );
-          kernel().connection_manager.send( t, nid, se );
-        }
-        else
-        {
-          --lag;
-        }
-        ++pos_pid;
-      }
-      pos[ pid ] = pos_pid;
-    }
+    deliver_spikes_( t, local_offgrid_spikes_, global_offgrid_spikes_, pos );
+  }
+  else // compact off grid spiking
+  {
+    deliver_spikes_( t,
+      local_compact_offgrid_spikes_,
+      global_compact_offgrid_spikes_,
+      pos );
   }
 
   return done;
@@ -658,6 +919,12 @@ EventDeliveryManager::gather_events( bool done )
   // IMPORTANT: Ensure that gather_events(..) is called from a single thread and
   //            NOT from a parallel OpenMP region!!!
 
+  // rates stored in this pass become the instantaneous input of the next
+  if ( rate_engine_.is_active() )
+  {
+    rate_engine_.swap_buffers();
+  }
+
   // Stop watch for time measurements within this function
   static Stopwatch stw_local;
 
@@ -668,7 +935,13 @@ EventDeliveryManager::gather_events( bool done )
   time_collocate_ += stw_local.elapsed();
   stw_local.reset();
   stw_local.start();
-  if ( off_grid_spiking_ )
+  if ( off_grid_spiking_ and compact_off_grid_spiking_ )
+  {
+    kernel().mpi_manager.communicate( local_compact_offgrid_spikes_,
+      global_compact_offgrid_spikes_,
+      displacements_ );
+  }
+  else if ( off_grid_spiking_ )
   {
     kernel().mpi_manager.communicate(
       local_offgrid_spikes_, global_offgrid_spikes_, displacements_ );
@@ -680,5 +953,174 @@ EventDeliveryManager::gather_events( bool done )
   }
   stw_local.stop();
   time_communicate_ += stw_local.elapsed();
+
+  split_delivery_ = false;
+}
+
+void
+EventDeliveryManager::start_gather_events()
+{
+  exchanged_slice_origin_ = kernel().simulation_manager.get_slice_origin();
+
+  if ( not pipelined_communication_
+    or kernel().mpi_manager.get_num_processes() == 1 )
+  {
+    gather_events( true );
+    notify_spike_stream_subscribers_();
+    return;
+  }
+
+  // Stop watch for time measurements within this function
+  static Stopwatch stw_local;
+
+  stw_local.reset();
+  stw_local.start();
+  collocate_buffers_( true );
+  stw_local.stop();
+  time_collocate_ += stw_local.elapsed();
+  stw_local.reset();
+  stw_local.start();
+  if ( off_grid_spiking_ and compact_off_grid_spiking_ )
+  {
+    kernel().mpi_manager.communicate_start( local_compact_offgrid_spikes_,
+      global_compact_offgrid_spikes_,
+      displacements_ );
+  }
+  else if ( off_grid_spiking_ )
+  {
+    kernel().mpi_manager.communicate_start(
+      local_offgrid_spikes_, global_offgrid_spikes_, displacements_ );
+  }
+  else
+  {
+    kernel().mpi_manager.communicate_start(
+      local_grid_spikes_, global_grid_spikes_, displacements_ );
+  }
+  stw_local.stop();
+  time_communicate_ += stw_local.elapsed();
+  time_exchange_ += stw_local.elapsed();
+
+  exchange_pending_ = true;
+  split_delivery_ = true;
+  stw_exchange_.reset();
+  stw_exchange_.start();
+}
+
+void
+EventDeliveryManager::finish_gather_events()
+{
+  if ( not exchange_pending_ )
+  {
+    return;
+  }
+
+  stw_exchange_.stop();
+  time_exchange_ += stw_exchange_.elapsed();
+  time_exchange_hidden_ += stw_exchange_.elapsed();
+
+  // Stop watch for time measurements within this function
+  static Stopwatch stw_local;
+
+  stw_local.reset();
+  stw_local.start();
+  if ( off_grid_spiking_ and compact_off_grid_spiking_ )
+  {
+    kernel().mpi_manager.communicate_finish( local_compact_offgrid_spikes_,
+      global_compact_offgrid_spikes_,
+      displacements_ );
+  }
+  else if ( off_grid_spiking_ )
+  {
+    kernel().mpi_manager.communicate_finish(
+      local_offgrid_spikes_, global_offgrid_spikes_, displacements_ );
+  }
+  else
+  {
+    kernel().mpi_manager.communicate_finish(
+      local_grid_spikes_, global_grid_spikes_, displacements_ );
+  }
+  stw_local.stop();
+  time_communicate_ += stw_local.elapsed();
+  time_exchange_ += stw_local.elapsed();
+
+  exchange_pending_ = false;
+
+  notify_spike_stream_subscribers_();
+}
+
+template < typename SpikeT >
+void
+EventDeliveryManager::decode_spike_stream_(
+  const std::vector< SpikeT >& global_spikes )
+{
+  stream_gids_.clear();
+  stream_lags_.clear();
+  stream_offsets_.clear();
+
+  // same traversal as deliver_spikes_(), lag 0 comes first
+  const long min_delay = kernel().connection_manager.get_min_delay();
+  std::vector< int > pos = displacements_;
+  for ( thread vp = 0; vp < kernel().vp_manager.get_num_virtual_processes();
+        ++vp )
+  {
+    const thread pid = kernel().mpi_manager.get_process_id( vp );
+    int p = pos[ pid ];
+    long lag = 0;
+    while ( lag < min_delay )
+    {
+      const index nid = get_spike_gid_( global_spikes[ p ] );
+      if ( nid != static_cast< index >( comm_marker_ ) )
+      {
+        stream_gids_.push_back( nid );
+        stream_lags_.push_back( lag );
+        stream_offsets_.push_back( get_spike_offset_( global_spikes[ p ] ) );
+      }
+      else
+      {
+        ++lag;
+      }
+      ++p;
+    }
+    pos[ pid ] = p;
+  }
+}
+
+void
+EventDeliveryManager::notify_spike_stream_subscribers_()
+{
+  if ( spike_stream_subscribers_.empty() )
+  {
+    return;
+  }
+
+  if ( not off_grid_spiking_ )
+  {
+    decode_spike_stream_( global_grid_spikes_ );
+  }
+  else if ( not compact_off_grid_spiking_ )
+  {
+    decode_spike_stream_( global_offgrid_spikes_ );
+  }
+  else
+  {
+    decode_spike_stream_( global_compact_offgrid_spikes_ );
+  }
+
+  SpikeBatch batch;
+  batch.slice_origin = exchanged_slice_origin_;
+  batch.size = stream_gids_.size();
+  batch.gids = batch.size > 0 ? &stream_gids_[ 0 ] : 0;
+  batch.lags = batch.size > 0 ? &stream_lags_[ 0 ] : 0;
+  batch.offsets = batch.size > 0 ? &stream_offsets_[ 0 ] : 0;
+
+  static Stopwatch stw_local;
+  for ( size_t i = 0; i < spike_stream_subscribers_.size(); ++i )
+  {
+    stw_local.reset();
+    stw_local.start();
+    spike_stream_subscribers_[ i ]->handle_spikes( batch );
+    stw_local.stop();
+    time_spike_stream_[ i ] += stw_local.elapsed();
+  }
 }
 }
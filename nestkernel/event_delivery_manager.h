@@ -37,6 +37,8 @@
 #include "nest_time.h"
 #include "nest_types.h"
 #include "node.h"
+#include "rate_network_engine.h"
+#include "spike_stream.h"
 
 // Includes from sli:
 #include "dictdatum.h"
@@ -44,6 +46,7 @@
 namespace nest
 {
 typedef MPIManager::OffGridSpike OffGridSpike;
+typedef MPIManager::CompactOffGridSpike CompactOffGridSpike;
 
 class EventDeliveryManager : public ManagerInterface
 {
@@ -57,6 +60,24 @@ public:
   virtual void set_status( const DictionaryDatum& );
   virtual void get_status( DictionaryDatum& );
 
+  /**
+   * Report bytes of the spike registers of each thread and of the
+   * communication buffers of this process.
+   */
+  void get_memory_status( DictionaryDatum& ) const;
+
+  /**
+   * Register subscriber, which receives the spikes of the whole network
+   * once per time slice, see SpikeStreamSubscriber.
+   * Subscribers must not register or unregister subscribers while
+   * handling spikes.
+   * @throws KernelException if the subscriber is already registered.
+   */
+  void register_spike_stream_subscriber( SpikeStreamSubscriber& );
+
+  //! Unregister subscriber; does nothing if it is not registered.
+  void unregister_spike_stream_subscriber( SpikeStreamSubscriber& );
+
   /**
    * Standard routine for sending events. This method decides if
    * the event has to be delivered locally or globally. It exists
@@ -121,6 +142,14 @@ public:
    */
   void send_offgrid_remote( thread p, SpikeEvent&, const long lag = 0 );
 
+  /**
+   * Add a spike of node gid to the spike_register, as if that node had
+   * spiked at the given lag. The spike is delivered to all targets of gid.
+   * Used by devices that replay recorded activity on behalf of other nodes.
+   * The offset is stored only if off-grid spiking is enabled.
+   */
+  void send_remote_as( thread t, index gid, const long lag, double offset );
+
   /**
    * Send event e directly to its target node. This should be
    * used only where necessary, e.g. if a node wants to reply
@@ -158,7 +187,8 @@ public:
   size_t read_toggle() const;
 
   /**
-   * Clear all pending spikes, but do not otherwise manipulate scheduler.
+   * Clear all pending spikes and rates held by the RateNetworkEngine, but
+   * do not otherwise manipulate scheduler.
    * @note This is used by Network::reset_network().
    */
   void clear_pending_spikes();
@@ -186,6 +216,15 @@ public:
    */
   void configure_spike_buffers();
 
+  /**
+   * Set up the RateNetworkEngine if it is enabled, see use_rate_engine.
+   * This is done at each call to prepare().
+   */
+  void configure_rate_engine();
+
+  //! Engine that delivers rate connections, see RateNetworkEngine.
+  RateNetworkEngine& get_rate_engine();
+
   /**
    * Read all event buffers for thread t and send the corresponding
    * Events to the Nodes that are targeted.
@@ -202,6 +241,33 @@ public:
    */
   void gather_events( bool );
 
+  /**
+   * Collocate buffers and start exchanging events with other MPI
+   * processes at the end of a slice.
+   *
+   * If pipelined communication is enabled and there are several
+   * processes, the exchange continues while the threads proceed to the
+   * next slice. deliver_events() then delivers the events of this process
+   * from the send buffer before it waits for the exchange to complete.
+   * The structural plasticity update and nodes whose update does not
+   * depend on delivered events, see Node::independent_of_delivery(), run
+   * before deliver_events() and so overlap with the exchange, too.
+   * Otherwise, the exchange is completed before returning.
+   */
+  void start_gather_events();
+
+  /**
+   * Wait for the exchange started by start_gather_events() to complete,
+   * if it is still in progress. Must be called by the master thread.
+   */
+  void finish_gather_events();
+
+  /**
+   * Return true while an exchange started by start_gather_events() is in
+   * progress.
+   */
+  bool is_exchange_pending() const;
+
   /**
    * Update table of fixed modulos, including slice-based.
    */
@@ -221,6 +287,18 @@ public:
   virtual void reset_timers_counters();
 
 private:
+  /**
+   * Pass the spikes received in the last exchange to all spike stream
+   * subscribers. Must be called after the exchange is complete.
+   */
+  void notify_spike_stream_subscribers_();
+
+  /**
+   * Decode receive buffer into the arrays of the spike stream batch.
+   */
+  template < typename SpikeT >
+  void decode_spike_stream_( const std::vector< SpikeT >& global_spikes );
+
   /**
    * Rearrange the spike_register into a 2-dim structure. This is
    * done by collecting the spikes from all threads in each slice of
@@ -228,11 +306,92 @@ private:
    */
   void collocate_buffers_( bool );
 
+  /**
+   * Collocate the off-grid spike registers into the given send buffer.
+   * SpikeT is either OffGridSpike or CompactOffGridSpike.
+   */
+  template < typename SpikeT >
+  void collocate_offgrid_buffers_( std::vector< SpikeT >& local_offgrid_spikes,
+    std::vector< SpikeT >& global_offgrid_spikes,
+    int num_spikes,
+    int num_grid_spikes );
+
+  /**
+   * Copy off-grid spikes to a send buffer, converting them to SpikeT.
+   * @returns position after the last spike copied
+   */
+  template < typename SpikeT >
+  typename std::vector< SpikeT >::iterator copy_offgrid_spikes_(
+    const std::vector< OffGridSpike >& spikes,
+    typename std::vector< SpikeT >::iterator pos );
+
+  /**
+   * Deliver the spikes from the receive buffer, or, if the exchange was
+   * pipelined, the spikes of this process from the send buffer and the
+   * spikes of all other processes from the receive buffer. Completes a
+   * pending exchange and must thus be called by all threads.
+   * SpikeT is unsigned int for on-grid spikes, and OffGridSpike or
+   * CompactOffGridSpike for off-grid spikes.
+   * @param pos set to the position after the spikes of each process in
+   *            the receive buffer
+   */
+  template < typename SpikeT >
+  void deliver_spikes_( thread t,
+    const std::vector< SpikeT >& local_spikes,
+    const std::vector< SpikeT >& global_spikes,
+    std::vector< int >& pos );
+
+  /**
+   * Deliver the spikes of one virtual process, starting at position pos
+   * in the given buffer.
+   * @returns position after the spikes of the virtual process
+   */
+  template < typename SpikeT >
+  int deliver_vp_spikes_( thread t,
+    const std::vector< SpikeT >& spikes,
+    int pos,
+    const std::vector< Time >& prepared_timestamps,
+    SpikeEvent& se );
+
+  /**
+   * Read GID and offset of a spike from a communication buffer entry.
+   */
+  static index get_spike_gid_( unsigned int spike );
+  static void set_spike_offset_( SpikeEvent& se, unsigned int spike );
+  template < typename SpikeT >
+  static index get_spike_gid_( const SpikeT& spike );
+  template < typename SpikeT >
+  static void set_spike_offset_( SpikeEvent& se, const SpikeT& spike );
+  static double get_spike_offset_( unsigned int spike );
+  template < typename SpikeT >
+  static double get_spike_offset_( const SpikeT& spike );
+
 
 private:
   bool off_grid_spiking_; //!< indicates whether spikes are not constrained to
                           //!< the grid
 
+  //! indicates whether off-grid spikes are communicated with offsets in
+  //! single precision, see CompactOffGridSpike
+  bool compact_off_grid_spiking_;
+
+  //! indicates whether the exchange of events at the end of a slice
+  //! overlaps with delivery at the beginning of the next slice
+  bool pipelined_communication_;
+
+  //! indicates whether rate connections are delivered by rate_engine_
+  //! instead of secondary events, if the network permits
+  bool use_rate_engine_;
+
+  RateNetworkEngine rate_engine_;
+
+  //! true while an exchange started by start_gather_events() is pending
+  bool exchange_pending_;
+
+  //! true if the events of this process are delivered from the send
+  //! buffer, because the last exchange was pipelined
+  bool split_delivery_;
+
   /**
    * Table of pre-computed modulos.
    * This table is used to map time steps, given as offset from now,
@@ -308,6 +467,14 @@ private:
    */
   std::vector< OffGridSpike > global_offgrid_spikes_;
 
+  /**
+   * Send and receive buffers as local_offgrid_spikes_ and
+   * global_offgrid_spikes_, used instead of them for compact off-grid
+   * spiking.
+   */
+  std::vector< CompactOffGridSpike > local_compact_offgrid_spikes_;
+  std::vector< CompactOffGridSpike > global_compact_offgrid_spikes_;
+
   /**
    * Buffer containing the starting positions for the spikes from
    * each process within the global_(off)grid_spikes_ buffer.
@@ -332,14 +499,48 @@ private:
    */
   double time_communicate_;
 
+  /**
+   * Total duration of pipelined exchanges, from their start until their
+   * completion, during the last call to simulate.
+   */
+  double time_exchange_;
+
+  /**
+   * Part of time_exchange_ during which the threads proceeded with local
+   * work instead of waiting for the exchange to complete.
+   */
+  double time_exchange_hidden_;
+
+  //! measures local work during a pipelined exchange
+  Stopwatch stw_exchange_;
+
   /**
    * Number of generated spike events (both off- and on-grid) during the last
    * call to simulate.
    */
   unsigned long local_spike_counter_;
+
+  std::vector< SpikeStreamSubscriber* > spike_stream_subscribers_;
+
+  //! time spent in each subscriber during the last call to simulate
+  std::vector< double > time_spike_stream_;
+
+  //! beginning of the slice whose spikes are in the receive buffers
+  Time exchanged_slice_origin_;
+
+  //! arrays of the batch passed to subscribers, see SpikeBatch
+  std::vector< index > stream_gids_;
+  std::vector< long > stream_lags_;
+  std::vector< double > stream_offsets_;
 };
 
 
+inline RateNetworkEngine&
+EventDeliveryManager::get_rate_engine()
+{
+  return rate_engine_;
+}
+
 inline void
 EventDeliveryManager::send_to_node( Event& e )
 {
@@ -369,6 +570,23 @@ EventDeliveryManager::send_offgrid_remote( thread t,
   }
 }
 
+inline void
+EventDeliveryManager::send_remote_as( thread t,
+  index gid,
+  const long lag,
+  double offset )
+{
+  if ( off_grid_spiking_ )
+  {
+    offgrid_spike_register_[ t ][ lag ].push_back(
+      OffGridSpike( gid, offset ) );
+  }
+  else
+  {
+    spike_register_[ t ][ lag ].push_back( gid );
+  }
+}
+
 inline bool
 EventDeliveryManager::get_off_grid_communication() const
 {
@@ -381,6 +599,12 @@ EventDeliveryManager::set_off_grid_communication( bool off_grid_spiking )
   off_grid_spiking_ = off_grid_spiking;
 }
 
+inline bool
+EventDeliveryManager::is_exchange_pending() const
+{
+  return exchange_pending_;
+}
+
 inline size_t
 EventDeliveryManager::read_toggle() const
 {
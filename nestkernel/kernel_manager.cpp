@@ -22,6 +22,13 @@
 
 #include "kernel_manager.h"
 
+// Includes from nestkernel:
+#include "memory_accounting.h"
+#include "nest_names.h"
+
+// Includes from sli:
+#include "dictutils.h"
+
 nest::KernelManager* nest::KernelManager::kernel_manager_instance_ = 0;
 
 void
@@ -60,6 +67,7 @@ nest::KernelManager::KernelManager()
   , music_manager()
   , node_manager()
   , initialized_( false )
+  , startup_times_( new Dictionary )
 {
 }
 
@@ -75,6 +83,7 @@ nest::KernelManager::initialize()
 
   mpi_manager.initialize(); // set up inter-process communication
   vp_manager.initialize();  // set up threads
+  MemoryAccounting::set_num_threads( vp_manager.get_num_threads() );
 
   // invariant: process infrastructure (MPI, threads) in place
 
@@ -140,6 +149,8 @@ nest::KernelManager::reset()
 void
 nest::KernelManager::num_threads_changed_reset()
 {
+  MemoryAccounting::set_num_threads( vp_manager.get_num_threads() );
+
   node_manager.finalize();
   model_manager.finalize();
   connection_manager.finalize();
@@ -200,4 +211,16 @@ nest::KernelManager::get_status( DictionaryDatum& dict )
   music_manager.get_status( dict );
 
   node_manager.get_status( dict );
+
+  DictionaryDatum startup_times( new Dictionary( *startup_times_ ) );
+  def< double >( startup_times,
+    names::model_registration,
+    model_manager.get_registration_time() );
+  def< DictionaryDatum >( dict, names::startup_times, startup_times );
+}
+
+void
+nest::KernelManager::set_startup_time( const Name& phase, double seconds )
+{
+  def< double >( startup_times_, phase, seconds );
 }
@@ -71,6 +71,17 @@
  num_sim_processes             integertype - The number of MPI processes reserved for simulating neurons
  off_grid_spiking              booltype    - Whether to transmit precise spike times in MPI
                                              communication (read only)
+ compact_off_grid_spiking      booltype    - Whether to transmit offsets of precise spike times
+                                             in single precision, which halves the size of
+                                             the communication buffers (default: false)
+ pipelined_communication       booltype    - Whether to overlap the exchange of spikes at the
+                                             end of a time slice with delivering the spikes of
+                                             the local process at the beginning of the next
+                                             (default: false)
+ communication_overlap         doubletype  - Fraction of the duration of pipelined spike
+                                             exchanges during which the threads proceeded with
+                                             local work, since the last call to simulate
+                                             (read only)
 
  Connector configuration
  initial_connector_capacity    integertype - When a connector is first created, it starts with this
@@ -110,6 +121,17 @@
 
  Miscellaneous
  dict_miss_is_error            booltype    - Whether missed dictionary entries are treated as errors
+ materialized_node_models      integertype - The number of node models which have been used and
+                                             thus created since the last reset (read only)
+ materialized_synapse_models   integertype - The number of synapse models which have been used
+                                             and thus created since the last reset (read only)
+ startup_times                 dictionarytype - Time in seconds spent during startup in
+                                             sli_init, the SLI initialization up to and
+                                             including all module initializers, module_init,
+                                             the initialization of C++ modules, and
+                                             model_registration, the registration of node
+                                             and synapse models, which is part of module_init
+                                             (read only)
 
  SeeAlso: Simulate, Node
  */
@@ -177,6 +199,12 @@ public:
   void set_status( const DictionaryDatum& );
   void get_status( DictionaryDatum& );
 
+  /**
+   * Record the duration of a startup phase in seconds, reported in
+   * startup_times by get_status().
+   */
+  void set_startup_time( const Name& phase, double seconds );
+
   //! Returns true if kernel is initialized
   bool is_initialized() const;
 
@@ -196,6 +224,9 @@ public:
 
 private:
   bool initialized_; //!< true if all sub-managers initialized
+
+  //! Durations of startup phases, kept across resets
+  DictionaryDatum startup_times_;
 };
 
 KernelManager& kernel();
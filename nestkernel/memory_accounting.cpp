@@ -0,0 +1,64 @@
+/*
+ *  memory_accounting.cpp
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "memory_accounting.h"
+
+// C++ includes:
+#include <cassert>
+
+// Includes from nestkernel:
+#include "kernel_manager.h"
+#include "vp_manager_impl.h"
+
+std::vector< std::vector< long > > nest::MemoryAccounting::bytes_(
+  MEM_N_CATEGORIES,
+  std::vector< long >( 1, 0 ) );
+
+void
+nest::MemoryAccounting::add( MemoryCategory c, long n )
+{
+  const thread t = kernel().vp_manager.get_thread_id();
+  assert( static_cast< size_t >( t ) < bytes_[ c ].size() );
+  bytes_[ c ][ t ] += n;
+}
+
+long
+nest::MemoryAccounting::get( MemoryCategory c, thread t )
+{
+  return static_cast< size_t >( t ) < bytes_[ c ].size() ? bytes_[ c ][ t ]
+                                                         : 0;
+}
+
+void
+nest::MemoryAccounting::set_num_threads( thread n_threads )
+{
+  for ( size_t c = 0; c < bytes_.size(); ++c )
+  {
+    long sum = 0;
+    for ( size_t t = 0; t < bytes_[ c ].size(); ++t )
+    {
+      sum += bytes_[ c ][ t ];
+    }
+    bytes_[ c ].assign( n_threads, 0 );
+    bytes_[ c ][ 0 ] = sum;
+  }
+}
@@ -0,0 +1,149 @@
+/*
+ *  memory_accounting.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef MEMORY_ACCOUNTING_H
+#define MEMORY_ACCOUNTING_H
+
+// C++ includes:
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+// Includes from nestkernel:
+#include "nest_types.h"
+
+namespace nest
+{
+
+/**
+ * Categories of memory that is counted while it is allocated, because
+ * it is owned by objects the kernel cannot enumerate.
+ */
+enum MemoryCategory
+{
+  MEM_RING_BUFFERS = 0, //!< RingBuffer, SliceRingBuffer and relatives
+  MEM_RECORDERS,        //!< event vectors of RecordingDevice
+  MEM_TOPOLOGY,         //!< position caches of topology layers
+  MEM_N_CATEGORIES
+};
+
+/**
+ * Bytes of memory allocated per category and thread.
+ *
+ * Bytes are counted for the thread that allocates or frees them. Memory
+ * freed by another thread than the one that allocated it is thus
+ * credited to the freeing thread, so that only the sum over all threads
+ * is exact. The counters are shared by all instances of the kernel.
+ */
+class MemoryAccounting
+{
+public:
+  /**
+   * Count n bytes, which may be negative, for the calling thread.
+   */
+  static void add( MemoryCategory c, long n );
+
+  /**
+   * Return bytes counted for category c on thread t.
+   */
+  static long get( MemoryCategory c, thread t );
+
+  /**
+   * Adapt counters to a new number of threads. Sums over threads are
+   * kept and assigned to thread 0. Must be called outside of parallel
+   * regions.
+   */
+  static void set_num_threads( thread n_threads );
+
+private:
+  static std::vector< std::vector< long > > bytes_;
+};
+
+/**
+ * Allocator for standard containers which counts all memory of the
+ * container in category C of MemoryAccounting.
+ */
+template < typename T, MemoryCategory C >
+class accounting_allocator : public std::allocator< T >
+{
+public:
+  typedef T value_type;
+  typedef T* pointer;
+  typedef std::size_t size_type;
+
+  template < typename U >
+  struct rebind
+  {
+    typedef accounting_allocator< U, C > other;
+  };
+
+  accounting_allocator()
+    : std::allocator< T >()
+  {
+  }
+
+  accounting_allocator( const accounting_allocator& a )
+    : std::allocator< T >( a )
+  {
+  }
+
+  template < typename U >
+  accounting_allocator( const accounting_allocator< U, C >& a )
+    : std::allocator< T >( a )
+  {
+  }
+
+  pointer
+  allocate( size_type n, const void* = 0 )
+  {
+    pointer p = std::allocator< T >::allocate( n );
+    MemoryAccounting::add( C, n * sizeof( T ) );
+    return p;
+  }
+
+  void
+  deallocate( pointer p, size_type n )
+  {
+    MemoryAccounting::add( C, -static_cast< long >( n * sizeof( T ) ) );
+    std::allocator< T >::deallocate( p, n );
+  }
+};
+
+template < typename T, typename U, MemoryCategory C >
+inline bool
+operator==( const accounting_allocator< T, C >&,
+  const accounting_allocator< U, C >& )
+{
+  return true;
+}
+
+template < typename T, typename U, MemoryCategory C >
+inline bool
+operator!=( const accounting_allocator< T, C >&,
+  const accounting_allocator< U, C >& )
+{
+  return false;
+}
+
+} // namespace nest
+
+#endif /* MEMORY_ACCOUNTING_H */
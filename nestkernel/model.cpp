@@ -110,6 +110,12 @@ Model::mem_capacity()
   return result;
 }
 
+size_t
+Model::mem_capacity( thread t ) const
+{
+  return memory_.at( t ).get_total();
+}
+
 void
 Model::set_status( DictionaryDatum d )
 {
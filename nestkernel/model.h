@@ -131,6 +131,11 @@ public:
    */
   size_t mem_capacity();
 
+  /**
+   * Return the memory capacity on thread t in number of elements.
+   */
+  size_t mem_capacity( thread t ) const;
+
   virtual bool has_proxies() = 0;
   virtual bool potential_global_receiver() = 0;
   virtual bool one_node_per_process() = 0;
@@ -44,6 +44,7 @@ namespace nest
 
 ModelManager::ModelManager()
   : pristine_models_()
+  , node_model_factories_()
   , models_()
   , pristine_prototypes_()
   , prototypes_()
@@ -55,6 +56,7 @@ ModelManager::ModelManager()
   , proxy_nodes_()
   , dummy_spike_sources_()
   , model_defaults_modified_( false )
+  , registration_timer_()
 {
 }
 
@@ -98,6 +100,8 @@ ModelManager::initialize()
     subnet_model_->set_type_id( 0 );
     pristine_models_.push_back(
       std::pair< Model*, bool >( subnet_model_, false ) );
+    node_model_factories_.push_back(
+      NodeModelFactory_( subnet_model_->get_name() ) );
 
     siblingcontainer_model_ =
       new GenericModel< SiblingContainer >( std::string( "siblingcontainer" ),
@@ -105,31 +109,39 @@ ModelManager::initialize()
     siblingcontainer_model_->set_type_id( 1 );
     pristine_models_.push_back(
       std::pair< Model*, bool >( siblingcontainer_model_, true ) );
+    node_model_factories_.push_back(
+      NodeModelFactory_( siblingcontainer_model_->get_name() ) );
 
     proxynode_model_ =
       new GenericModel< proxynode >( "proxynode", /* deprecation_info */ "" );
     proxynode_model_->set_type_id( 2 );
     pristine_models_.push_back(
       std::pair< Model*, bool >( proxynode_model_, true ) );
+    node_model_factories_.push_back(
+      NodeModelFactory_( proxynode_model_->get_name() ) );
   }
 
-  // Re-create the model list from the clean prototypes
+  // Re-create the model list from the clean prototypes. Models registered
+  // for deferred creation are only entered into the modeldict and
+  // materialized again on first use.
   for ( index i = 0; i < pristine_models_.size(); ++i )
   {
-    if ( pristine_models_[ i ].first != 0 )
+    Model* model = 0;
+    if ( node_model_factories_[ i ].create == 0 )
     {
       // set the num of threads for the number of sli pools
       pristine_models_[ i ].first->set_threads();
-      std::string name = pristine_models_[ i ].first->get_name();
-      models_.push_back( pristine_models_[ i ].first->clone( name ) );
-      if ( not pristine_models_[ i ].second )
-      {
-        modeldict_->insert( name, i );
-      }
+      model = pristine_models_[ i ].first->clone(
+        pristine_models_[ i ].first->get_name() );
+    }
+    models_.push_back( model );
+    if ( not pristine_models_[ i ].second )
+    {
+      modeldict_->insert( node_model_factories_[ i ].name, i );
     }
   }
 
-  // create proxy nodes, one for each thread and model
+  // create proxy nodes, one for each thread and materialized model
   proxy_nodes_.resize( kernel().vp_manager.get_num_threads() );
   int proxy_model_id = get_model_id( "proxynode" );
   for ( thread t = 0;
@@ -138,12 +150,13 @@ ModelManager::initialize()
   {
     for ( index i = 0; i < pristine_models_.size(); ++i )
     {
-      if ( pristine_models_[ i ].first != 0 )
+      Node* newnode = 0;
+      if ( models_[ i ] != 0 )
       {
-        Node* newnode = proxynode_model_->allocate( t );
+        newnode = proxynode_model_->allocate( t );
         newnode->set_model_id( i );
-        proxy_nodes_[ t ].push_back( newnode );
       }
+      proxy_nodes_[ t ].push_back( newnode );
     }
     Node* newnode = proxynode_model_->allocate( t );
     newnode->set_model_id( proxy_model_id );
@@ -157,7 +170,8 @@ ModelManager::initialize()
     kernel().vp_manager.get_num_threads() );
   prototypes_.swap( tmp_proto );
 
-  // (re-)append all synapse prototypes
+  // (re-)register all synapse prototypes, the per-thread copies are
+  // created on first use
   for (
     std::vector< ConnectorModel* >::iterator i = pristine_prototypes_.begin();
     i != pristine_prototypes_.end();
@@ -165,14 +179,13 @@ ModelManager::initialize()
   {
     if ( *i != 0 )
     {
-      std::string name = ( *i )->get_name();
       for ( thread t = 0;
             t < static_cast< thread >( kernel().vp_manager.get_num_threads() );
             ++t )
       {
-        prototypes_[ t ].push_back( ( *i )->clone( name ) );
+        prototypes_[ t ].push_back( 0 );
       }
-      synapsedict_->insert( name, prototypes_[ 0 ].size() - 1 );
+      synapsedict_->insert( ( *i )->get_name(), prototypes_[ 0 ].size() - 1 );
     }
   }
 }
@@ -189,7 +202,10 @@ ModelManager::finalize()
   for ( m = pristine_models_.begin(); m != pristine_models_.end(); ++m )
   {
     // delete all nodes, because cloning the model may have created instances.
-    ( *m ).first->clear();
+    if ( ( *m ).first != 0 )
+    {
+      ( *m ).first->clear();
+    }
   }
 }
 
@@ -199,8 +215,22 @@ ModelManager::set_status( const DictionaryDatum& )
 }
 
 void
-ModelManager::get_status( DictionaryDatum& )
+ModelManager::get_status( DictionaryDatum& d )
 {
+  long n_node_models = 0;
+  for ( index i = 0; i < models_.size(); ++i )
+  {
+    n_node_models += models_[ i ] != 0;
+  }
+
+  long n_synapse_models = 0;
+  for ( synindex syn_id = 0; syn_id < prototypes_[ 0 ].size(); ++syn_id )
+  {
+    n_synapse_models += prototypes_[ 0 ][ syn_id ] != 0;
+  }
+
+  def< long >( d, names::materialized_node_models, n_node_models );
+  def< long >( d, names::materialized_synapse_models, n_synapse_models );
 }
 
 index
@@ -246,6 +276,7 @@ ModelManager::register_node_model_( Model* model, bool private_model )
 
   pristine_models_.push_back(
     std::pair< Model*, bool >( model, private_model ) );
+  node_model_factories_.push_back( NodeModelFactory_( name ) );
   models_.push_back( model->clone( name ) );
   int proxy_model_id = get_model_id( "proxynode" );
   assert( proxy_model_id > 0 );
@@ -268,6 +299,105 @@ ModelManager::register_node_model_( Model* model, bool private_model )
   return id;
 }
 
+index
+ModelManager::register_node_model_( const NodeModelFactory_& factory,
+  bool private_model )
+{
+  const index id = models_.size();
+
+  pristine_models_.push_back( std::pair< Model*, bool >( 0, private_model ) );
+  node_model_factories_.push_back( factory );
+  models_.push_back( 0 );
+
+  for ( thread t = 0;
+        t < static_cast< thread >( kernel().vp_manager.get_num_threads() );
+        ++t )
+  {
+    proxy_nodes_[ t ].push_back( 0 );
+  }
+  if ( not private_model )
+  {
+    modeldict_->insert( factory.name, id );
+  }
+
+  return id;
+}
+
+void
+ModelManager::materialize_node_model_( index model_id )
+{
+  assert( model_id < pristine_models_.size() );
+
+// Nodes may be created from within parallel regions
+#pragma omp critical( materialize_model )
+  {
+    if ( models_[ model_id ] == 0 )
+    {
+      Model*& pristine = pristine_models_[ model_id ].first;
+      if ( pristine == 0 )
+      {
+        const NodeModelFactory_& factory = node_model_factories_[ model_id ];
+        assert( factory.create != 0 );
+        pristine = factory.create( factory.name, factory.deprecation_info );
+        pristine->set_model_id( model_id );
+        pristine->set_type_id( model_id );
+      }
+      else
+      {
+        // set the num of threads for the number of sli pools
+        pristine->set_threads();
+      }
+
+      for ( thread t = 0;
+            t < static_cast< thread >( kernel().vp_manager.get_num_threads() );
+            ++t )
+      {
+        Node* newnode = proxynode_model_->allocate( t );
+        newnode->set_model_id( model_id );
+        proxy_nodes_[ t ][ model_id ] = newnode;
+      }
+
+      // published last, get_model() reads it without lock
+      __atomic_store_n( &models_[ model_id ],
+        pristine->clone( pristine->get_name() ),
+        __ATOMIC_RELEASE );
+    }
+  }
+}
+
+void
+ModelManager::materialize_synapse_model_( synindex syn_id )
+{
+  assert( syn_id < pristine_prototypes_.size() );
+
+#pragma omp critical( materialize_model )
+  {
+    for ( thread t = 0;
+          t < static_cast< thread >( kernel().vp_manager.get_num_threads() );
+          ++t )
+    {
+      if ( prototypes_[ t ][ syn_id ] == 0 )
+      {
+        ConnectorModel* cm = pristine_prototypes_[ syn_id ]->clone(
+          pristine_prototypes_[ syn_id ]->get_name() );
+        cm->set_syn_id( syn_id );
+        // get_synapse_prototype() reads it without lock
+        __atomic_store_n( &prototypes_[ t ][ syn_id ], cm, __ATOMIC_RELEASE );
+      }
+    }
+  }
+}
+
+std::string
+ModelManager::get_node_model_name_( index model_id ) const
+{
+  if ( models_[ model_id ] != 0 )
+  {
+    return models_[ model_id ]->get_name();
+  }
+  return node_model_factories_[ model_id ].name;
+}
+
 index
 ModelManager::copy_node_model_( index old_id, Name new_name )
 {
@@ -374,6 +504,7 @@ ModelManager::set_synapse_defaults_( index model_id,
 {
   params->clear_access_flags();
   assert_valid_syn_id( model_id );
+  get_synapse_prototype( model_id );
 
   std::vector< lockPTR< WrappedThreadException > > exceptions_raised_(
     kernel().vp_manager.get_num_threads() );
@@ -421,8 +552,7 @@ ModelManager::get_model_id( const Name name ) const
   const Name model_name( name );
   for ( int i = 0; i < ( int ) models_.size(); ++i )
   {
-    assert( models_[ i ] != NULL );
-    if ( model_name == models_[ i ]->get_name() )
+    if ( model_name == get_node_model_name_( i ) )
     {
       return i;
     }
@@ -432,9 +562,10 @@ ModelManager::get_model_id( const Name name ) const
 
 
 DictionaryDatum
-ModelManager::get_connector_defaults( synindex syn_id ) const
+ModelManager::get_connector_defaults( synindex syn_id )
 {
   assert_valid_syn_id( syn_id );
+  get_synapse_prototype( syn_id );
 
   DictionaryDatum dict( new Dictionary() );
 
@@ -453,11 +584,9 @@ ModelManager::get_connector_defaults( synindex syn_id ) const
 }
 
 bool
-ModelManager::connector_requires_symmetric( synindex syn_id ) const
+ModelManager::connector_requires_symmetric( synindex syn_id )
 {
-  assert_valid_syn_id( syn_id );
-
-  return prototypes_[ 0 ][ syn_id ]->requires_symmetric();
+  return get_synapse_prototype( syn_id ).requires_symmetric();
 }
 
 void
@@ -517,6 +646,16 @@ ModelManager::clear_prototypes_()
 void
 ModelManager::calibrate( const TimeConverter& tc )
 {
+  // Pristine prototypes are kept in the default representation of time, so
+  // all synapse types must be materialized before their delays change.
+  for ( synindex syn_id = 0; syn_id < prototypes_[ 0 ].size(); ++syn_id )
+  {
+    if ( prototypes_[ 0 ][ syn_id ] == 0 )
+    {
+      materialize_synapse_model_( syn_id );
+    }
+  }
+
   for ( thread t = 0;
         t < static_cast< thread >( kernel().vp_manager.get_num_threads() );
         ++t )
@@ -538,8 +677,8 @@ ModelManager::calibrate( const TimeConverter& tc )
 bool
 ModelManager::compare_model_by_id_( const int a, const int b )
 {
-  return kernel().model_manager.get_model( a )->get_name()
-    < kernel().model_manager.get_model( b )->get_name();
+  return kernel().model_manager.get_node_model_name_( a )
+    < kernel().model_manager.get_node_model_name_( b );
 }
 
 void
@@ -566,7 +705,7 @@ ModelManager::memory_info() const
   for ( index i = 0; i < get_num_node_models(); ++i )
   {
     Model* mod = models_[ idx[ i ] ];
-    if ( mod->mem_capacity() != 0 )
+    if ( mod != 0 && mod->mem_capacity() != 0 )
     {
       std::cout << std::setw( 25 ) << mod->get_name() << std::setw( 13 )
                 << mod->mem_capacity() * mod->get_element_size()
@@ -624,12 +763,12 @@ ModelManager::register_connection_model_( ConnectorModel* cf )
   const synindex syn_id = prototypes_.at( 0 ).size();
   pristine_prototypes_.at( syn_id )->set_syn_id( syn_id );
 
+  // per-thread copies are created on first use
   for ( thread t = 0;
         t < static_cast< thread >( kernel().vp_manager.get_num_threads() );
         ++t )
   {
-    prototypes_[ t ].push_back( cf->clone( cf->get_name() ) );
-    prototypes_[ t ][ syn_id ]->set_syn_id( syn_id );
+    prototypes_[ t ].push_back( 0 );
   }
 
   synapsedict_->insert( cf->get_name(), syn_id );
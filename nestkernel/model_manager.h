@@ -26,6 +26,9 @@
 // C++ includes:
 #include <string>
 
+// Includes from libnestutil:
+#include "stopwatch.h"
+
 // Includes from nestkernel:
 #include "connector_model.h"
 #include "genericmodel.h"
@@ -121,6 +124,10 @@ public:
    * This function must be called exactly once for each model class to make
    * it known in the simulator. The natural place for a call to this function
    * is in a *module.cpp file.
+   *
+   * Registration only enters the name into the modeldict. The prototype,
+   * its clone and the proxy nodes are created on first use of the model,
+   * see get_model().
    * @param name of the new node model.
    * @param private_model if true, don't add model to modeldict.
    * @param deprecation_info  If non-empty string, deprecation warning will
@@ -209,16 +216,22 @@ public:
   int get_model_id( const Name ) const;
 
   /**
-   * @return The Model of a given model ID
+   * @return The Model of a given model ID, created if not yet in use
+   */
+  Model* get_model( index );
+
+  /**
+   * Check, if the model with the given ID has been created.
+   * @see register_node_model
    */
-  Model* get_model( index ) const;
+  bool is_model_materialized( index ) const;
 
-  DictionaryDatum get_connector_defaults( synindex syn_id ) const;
+  DictionaryDatum get_connector_defaults( synindex syn_id );
 
   /**
    * Checks, whether synapse type requires symmetric connections
    */
-  bool connector_requires_symmetric( synindex syn_id ) const;
+  bool connector_requires_symmetric( synindex syn_id );
 
   void set_connector_defaults( synindex syn_id, const DictionaryDatum& d );
 
@@ -278,7 +291,39 @@ public:
   SecondaryEvent& get_secondary_event_prototype( synindex syn_id,
     thread t = 0 );
 
+  /**
+   * Return time spent in registering node and synapse models in seconds,
+   * accumulated since the start of the process.
+   */
+  double get_registration_time() const;
+
 private:
+  /**
+   * Deferred creation of a pristine node model. A null create function
+   * marks models which are created at registration.
+   */
+  struct NodeModelFactory_
+  {
+    typedef Model* ( *Create )( const std::string&, const std::string& );
+
+    NodeModelFactory_( const std::string& name,
+      Create create = 0,
+      const std::string& deprecation_info = std::string() )
+      : create( create )
+      , name( name )
+      , deprecation_info( deprecation_info )
+    {
+    }
+
+    Create create;
+    std::string name;
+    std::string deprecation_info;
+  };
+
+  template < class ModelT >
+  static Model* create_node_model_( const std::string& name,
+    const std::string& deprecation_info );
+
   /**  */
   void clear_models_( bool called_from_destructor = false );
 
@@ -288,6 +333,25 @@ private:
   /**  */
   index register_node_model_( Model* model, bool private_model = false );
 
+  /**
+   * Register a node model to be created on first use.
+   */
+  index register_node_model_( const NodeModelFactory_& factory,
+    bool private_model );
+
+  /**
+   * Create pristine node model, clone and proxy nodes for model_id.
+   */
+  void materialize_node_model_( index model_id );
+
+  /**
+   * Clone the pristine synapse model for syn_id on all threads.
+   */
+  void materialize_synapse_model_( synindex syn_id );
+
+  //! Name of a node model, also if it has not been created yet
+  std::string get_node_model_name_( index model_id ) const;
+
   synindex register_connection_model_( ConnectorModel* );
 
   /**
@@ -335,6 +399,9 @@ private:
    */
   std::vector< std::pair< Model*, bool > > pristine_models_;
 
+  //! Factories for pristine_models_, one per entry
+  std::vector< NodeModelFactory_ > node_model_factories_;
+
   std::vector< Model* > models_; //!< List of available models
 
 
@@ -348,7 +415,8 @@ private:
 
   /**
    * The list of available synapse prototypes: first dimension one
-   * entry per thread, second dimension for each synapse type
+   * entry per thread, second dimension for each synapse type. Entries
+   * for synapse types which have not been used yet are null.
    */
   std::vector< std::vector< ConnectorModel* > > prototypes_;
 
@@ -393,18 +461,40 @@ private:
   std::vector< Node* > dummy_spike_sources_;
   //! True if any model defaults have been modified
   bool model_defaults_modified_;
+
+  //! Time spent in register_* functions, kept across kernel resets
+  Stopwatch registration_timer_;
 };
 
 
 inline Model*
-ModelManager::get_model( index m ) const
+ModelManager::get_model( index m )
 {
-  if ( m >= models_.size() || models_[ m ] == 0 )
+  if ( m >= models_.size() )
   {
     throw UnknownModelID( m );
   }
 
-  return models_[ m ];
+  // nodes may be created in parallel, see materialize_node_model_()
+  Model* model = __atomic_load_n( &models_[ m ], __ATOMIC_ACQUIRE );
+  if ( model == 0 )
+  {
+    if ( m >= pristine_models_.size() )
+    {
+      throw UnknownModelID( m );
+    }
+    materialize_node_model_( m );
+    model = models_[ m ];
+  }
+
+  return model;
+}
+
+inline bool
+ModelManager::is_model_materialized( index m ) const
+{
+  return m < models_.size()
+    && __atomic_load_n( &models_[ m ], __ATOMIC_ACQUIRE ) != 0;
 }
 
 inline Model*
@@ -453,7 +543,16 @@ inline ConnectorModel&
 ModelManager::get_synapse_prototype( synindex syn_id, thread t )
 {
   assert_valid_syn_id( syn_id );
-  return *( prototypes_[ t ][ syn_id ] );
+  // prototypes of all threads are written by materialize_synapse_model_(),
+  // which may run on another thread
+  ConnectorModel* cm =
+    __atomic_load_n( &prototypes_[ t ][ syn_id ], __ATOMIC_ACQUIRE );
+  if ( cm == 0 )
+  {
+    materialize_synapse_model_( syn_id );
+    cm = prototypes_[ t ][ syn_id ];
+  }
+  return *cm;
 }
 
 inline const std::vector< ConnectorModel* >&
@@ -477,7 +576,10 @@ ModelManager::get_num_synapse_prototypes() const
 inline void
 ModelManager::assert_valid_syn_id( synindex syn_id, thread t ) const
 {
-  if ( syn_id >= prototypes_[ t ].size() || prototypes_[ t ][ syn_id ] == 0 )
+  // null entries of registered synapse types are created on first use
+  if ( syn_id >= prototypes_[ t ].size()
+    || ( prototypes_[ t ][ syn_id ] == 0
+         && syn_id >= pristine_prototypes_.size() ) )
   {
     throw UnknownSynapseType( syn_id );
   }
@@ -517,6 +619,12 @@ ModelManager::get_secondary_event_prototype( synindex syn_id, thread t )
   return *secondary_events_prototypes_[ t ][ syn_id ];
 }
 
+inline double
+ModelManager::get_registration_time() const
+{
+  return registration_timer_.elapsed();
+}
+
 } // namespace nest
 
 #endif /* MODEL_MANAGER_H */
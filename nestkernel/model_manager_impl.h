@@ -52,9 +52,13 @@ ModelManager::register_node_model( const Name& name,
     throw NamingConflict( msg );
   }
 
-  Model* model =
-    new GenericModel< ModelT >( name.toString(), deprecation_info );
-  return register_node_model_( model, private_model );
+  registration_timer_.start();
+  const index id = register_node_model_(
+    NodeModelFactory_(
+      name.toString(), &create_node_model_< ModelT >, deprecation_info ),
+    private_model );
+  registration_timer_.stop();
+  return id;
 }
 
 template < class ModelT >
@@ -73,6 +77,7 @@ ModelManager::register_preconf_node_model( const Name& name,
     throw NamingConflict( msg );
   }
 
+  registration_timer_.start();
   Model* model =
     new GenericModel< ModelT >( name.toString(), deprecation_info );
   conf->clear_access_flags();
@@ -80,7 +85,17 @@ ModelManager::register_preconf_node_model( const Name& name,
   std::string missed;
   // we only get here from C++ code, no need for exception
   assert( conf->all_accessed( missed ) );
-  return register_node_model_( model, private_model );
+  const index id = register_node_model_( model, private_model );
+  registration_timer_.stop();
+  return id;
+}
+
+template < class ModelT >
+Model*
+ModelManager::create_node_model_( const std::string& name,
+  const std::string& deprecation_info )
+{
+  return new GenericModel< ModelT >( name, deprecation_info );
 }
 
 template < typename ConnectionT, template < typename > class ConnectorModelT >
@@ -88,6 +103,7 @@ void
 ModelManager::register_connection_model( const std::string& name,
   bool requires_symmetric )
 {
+  registration_timer_.start();
   ConnectorModel* cf = new ConnectorModelT< ConnectionT >(
     name, /*is_primary=*/true, /*has_delay=*/true, requires_symmetric );
   register_connection_model_( cf );
@@ -100,6 +116,7 @@ ModelManager::register_connection_model( const std::string& name,
       requires_symmetric );
     register_connection_model_( cf );
   }
+  registration_timer_.stop();
 }
 
 template < typename ConnectionT >
@@ -120,6 +137,7 @@ ModelManager::register_secondary_connection_model( const std::string& name,
   bool has_delay,
   bool requires_symmetric )
 {
+  registration_timer_.start();
   ConnectorModel* cm = new GenericSecondaryConnectorModel< ConnectionT >(
     name, has_delay, requires_symmetric );
 
@@ -154,6 +172,7 @@ ModelManager::register_secondary_connection_model( const std::string& name,
   secondary_connector_models_[ synid ] = cm;
 
   ConnectionT::EventType::set_syn_id( synid );
+  registration_timer_.stop();
 }
 
 inline Node*
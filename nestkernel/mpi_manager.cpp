@@ -68,6 +68,9 @@ nest::MPIManager::MPIManager()
   , COMM_OVERFLOW_ERROR( std::numeric_limits< unsigned int >::max() )
   , comm( 0 )
   , MPI_OFFGRID_SPIKE( 0 )
+  , MPI_COMPACT_OFFGRID_SPIKE( 0 )
+  , comm_request_( MPI_REQUEST_NULL )
+  , comm_pending_( false )
 #endif
 {
 }
@@ -123,6 +126,11 @@ nest::MPIManager::init_mpi( int* argc, char** argv[] )
     2, blockcounts, offsets, source_types, &MPI_OFFGRID_SPIKE );
   MPI_Type_commit( &MPI_OFFGRID_SPIKE );
 
+  // create compact off-grid-spike type, two unsigned ints
+  CompactOffGridSpike::assert_datatype_compatibility_();
+  MPI_Type_contiguous( 2, MPI_UNSIGNED, &MPI_COMPACT_OFFGRID_SPIKE );
+  MPI_Type_commit( &MPI_COMPACT_OFFGRID_SPIKE );
+
   use_mpi_ = true;
 #endif /* #ifdef HAVE_MPI */
 }
@@ -190,6 +198,7 @@ nest::MPIManager::mpi_finalize( int exitcode )
 {
 #ifdef HAVE_MPI
   MPI_Type_free( &MPI_OFFGRID_SPIKE );
+  MPI_Type_free( &MPI_COMPACT_OFFGRID_SPIKE );
 
   int finalized;
   MPI_Finalized( &finalized );
@@ -396,6 +405,77 @@ nest::MPIManager::communicate_Allgather( std::vector< T >& send_buffer,
   }
 }
 
+template < typename SpikeT >
+void
+nest::MPIManager::communicate_offgrid_Allgather_(
+  std::vector< SpikeT >& send_buffer,
+  std::vector< SpikeT >& recv_buffer,
+  std::vector< int >& displacements,
+  MPI_Datatype spike_type )
+{
+  std::vector< int > recv_counts( get_num_processes(), send_buffer_size_ );
+  // attempt Allgather
+  if ( send_buffer.size() == static_cast< unsigned int >( send_buffer_size_ ) )
+  {
+    MPI_Allgather( &send_buffer[ 0 ],
+      send_buffer_size_,
+      spike_type,
+      &recv_buffer[ 0 ],
+      send_buffer_size_,
+      spike_type,
+      comm );
+  }
+  else
+  {
+    std::vector< SpikeT > overflow_buffer( send_buffer_size_ );
+    overflow_buffer[ 0 ] = SpikeT( COMM_OVERFLOW_ERROR, 0.0 );
+    overflow_buffer[ 1 ] = SpikeT( send_buffer.size(), 0.0 );
+    MPI_Allgather( &overflow_buffer[ 0 ],
+      send_buffer_size_,
+      spike_type,
+      &recv_buffer[ 0 ],
+      send_buffer_size_,
+      spike_type,
+      comm );
+  }
+
+  // check for overflow condition
+  int disp = 0;
+  unsigned int max_recv_count = send_buffer_size_;
+  bool overflow = false;
+  for ( int pid = 0; pid < get_num_processes(); ++pid )
+  {
+    unsigned int block_disp = pid * send_buffer_size_;
+    displacements[ pid ] = disp;
+    if ( ( recv_buffer[ block_disp ] ).get_gid() == COMM_OVERFLOW_ERROR )
+    {
+      overflow = true;
+      recv_counts[ pid ] = ( recv_buffer[ block_disp + 1 ] ).get_gid();
+      if ( static_cast< unsigned int >( recv_counts[ pid ] ) > max_recv_count )
+      {
+        max_recv_count = recv_counts[ pid ];
+      }
+    }
+    disp += recv_counts[ pid ];
+  }
+
+  // do Allgatherv if necessary
+  if ( overflow )
+  {
+    recv_buffer.resize( disp );
+    MPI_Allgatherv( &send_buffer[ 0 ],
+      send_buffer.size(),
+      spike_type,
+      &recv_buffer[ 0 ],
+      &recv_counts[ 0 ],
+      &displacements[ 0 ],
+      spike_type,
+      comm );
+    send_buffer_size_ = max_recv_count;
+    recv_buffer_size_ = send_buffer_size_ * get_num_processes();
+  }
+}
+
 void
 nest::MPIManager::communicate( std::vector< OffGridSpike >& send_buffer,
   std::vector< OffGridSpike >& recv_buffer,
@@ -418,39 +498,130 @@ nest::MPIManager::communicate( std::vector< OffGridSpike >& send_buffer,
   }
 }
 
+void
+nest::MPIManager::communicate(
+  std::vector< CompactOffGridSpike >& send_buffer,
+  std::vector< CompactOffGridSpike >& recv_buffer,
+  std::vector< int >& displacements )
+{
+  displacements.resize( num_processes_, 0 );
+  if ( get_num_processes() == 1 ) // purely thread-based
+  {
+    displacements[ 0 ] = 0;
+    if ( static_cast< unsigned int >( recv_buffer_size_ ) < send_buffer.size() )
+    {
+      recv_buffer_size_ = send_buffer_size_ = send_buffer.size();
+      recv_buffer.resize( recv_buffer_size_ );
+    }
+    recv_buffer.swap( send_buffer );
+  }
+  else
+  {
+    communicate_Allgather( send_buffer, recv_buffer, displacements );
+  }
+}
+
 void
 nest::MPIManager::communicate_Allgather(
   std::vector< OffGridSpike >& send_buffer,
   std::vector< OffGridSpike >& recv_buffer,
   std::vector< int >& displacements )
 {
-  std::vector< int > recv_counts( get_num_processes(), send_buffer_size_ );
+  communicate_offgrid_Allgather_(
+    send_buffer, recv_buffer, displacements, MPI_OFFGRID_SPIKE );
+}
+
+void
+nest::MPIManager::communicate_Allgather(
+  std::vector< CompactOffGridSpike >& send_buffer,
+  std::vector< CompactOffGridSpike >& recv_buffer,
+  std::vector< int >& displacements )
+{
+  communicate_offgrid_Allgather_(
+    send_buffer, recv_buffer, displacements, MPI_COMPACT_OFFGRID_SPIKE );
+}
+
+void
+nest::MPIManager::set_comm_header_( unsigned int& entry, unsigned int value )
+{
+  entry = value;
+}
+
+unsigned int
+nest::MPIManager::get_comm_header_( unsigned int entry )
+{
+  return entry;
+}
+
+template < typename SpikeT >
+void
+nest::MPIManager::set_comm_header_( SpikeT& entry, unsigned int value )
+{
+  entry = SpikeT( value, 0.0 );
+}
+
+template < typename SpikeT >
+unsigned int
+nest::MPIManager::get_comm_header_( const SpikeT& entry )
+{
+  return entry.get_gid();
+}
+
+#if MPI_VERSION >= 3
+
+template < typename T >
+void
+nest::MPIManager::communicate_Iallgather_start_( std::vector< T >& send_buffer,
+  std::vector< T >& recv_buffer,
+  MPI_Datatype type )
+{
+  assert( not comm_pending_ );
+  comm_pending_ = true;
+
   // attempt Allgather
   if ( send_buffer.size() == static_cast< unsigned int >( send_buffer_size_ ) )
   {
-    MPI_Allgather( &send_buffer[ 0 ],
+    MPI_Iallgather( &send_buffer[ 0 ],
       send_buffer_size_,
-      MPI_OFFGRID_SPIKE,
+      type,
       &recv_buffer[ 0 ],
       send_buffer_size_,
-      MPI_OFFGRID_SPIKE,
-      comm );
+      type,
+      comm,
+      &comm_request_ );
   }
   else
   {
-    std::vector< OffGridSpike > overflow_buffer( send_buffer_size_ );
-    overflow_buffer[ 0 ] = OffGridSpike( COMM_OVERFLOW_ERROR, 0.0 );
-    overflow_buffer[ 1 ] = OffGridSpike( send_buffer.size(), 0.0 );
-    MPI_Allgather( &overflow_buffer[ 0 ],
+    // The overflow message only lives in this function, so we have to
+    // wait for its exchange here. Other processes need not wait.
+    std::vector< T > overflow_buffer( send_buffer_size_ );
+    set_comm_header_( overflow_buffer[ 0 ], COMM_OVERFLOW_ERROR );
+    set_comm_header_( overflow_buffer[ 1 ], send_buffer.size() );
+    MPI_Iallgather( &overflow_buffer[ 0 ],
       send_buffer_size_,
-      MPI_OFFGRID_SPIKE,
+      type,
       &recv_buffer[ 0 ],
       send_buffer_size_,
-      MPI_OFFGRID_SPIKE,
-      comm );
+      type,
+      comm,
+      &comm_request_ );
+    MPI_Wait( &comm_request_, MPI_STATUS_IGNORE );
   }
+}
+
+template < typename T >
+void
+nest::MPIManager::communicate_Iallgather_finish_( std::vector< T >& send_buffer,
+  std::vector< T >& recv_buffer,
+  std::vector< int >& displacements,
+  MPI_Datatype type )
+{
+  assert( comm_pending_ );
+  MPI_Wait( &comm_request_, MPI_STATUS_IGNORE );
+  comm_pending_ = false;
 
   // check for overflow condition
+  std::vector< int > recv_counts( get_num_processes(), send_buffer_size_ );
   int disp = 0;
   unsigned int max_recv_count = send_buffer_size_;
   bool overflow = false;
@@ -458,10 +629,10 @@ nest::MPIManager::communicate_Allgather(
   {
     unsigned int block_disp = pid * send_buffer_size_;
     displacements[ pid ] = disp;
-    if ( ( recv_buffer[ block_disp ] ).get_gid() == COMM_OVERFLOW_ERROR )
+    if ( get_comm_header_( recv_buffer[ block_disp ] ) == COMM_OVERFLOW_ERROR )
     {
       overflow = true;
-      recv_counts[ pid ] = ( recv_buffer[ block_disp + 1 ] ).get_gid();
+      recv_counts[ pid ] = get_comm_header_( recv_buffer[ block_disp + 1 ] );
       if ( static_cast< unsigned int >( recv_counts[ pid ] ) > max_recv_count )
       {
         max_recv_count = recv_counts[ pid ];
@@ -476,17 +647,113 @@ nest::MPIManager::communicate_Allgather(
     recv_buffer.resize( disp );
     MPI_Allgatherv( &send_buffer[ 0 ],
       send_buffer.size(),
-      MPI_OFFGRID_SPIKE,
+      type,
       &recv_buffer[ 0 ],
       &recv_counts[ 0 ],
       &displacements[ 0 ],
-      MPI_OFFGRID_SPIKE,
+      type,
       comm );
     send_buffer_size_ = max_recv_count;
     recv_buffer_size_ = send_buffer_size_ * get_num_processes();
   }
 }
 
+#endif /* #if MPI_VERSION >= 3 */
+
+void
+nest::MPIManager::communicate_start( std::vector< unsigned int >& send_buffer,
+  std::vector< unsigned int >& recv_buffer,
+  std::vector< int >& displacements )
+{
+#if MPI_VERSION >= 3
+  if ( get_num_processes() > 1 )
+  {
+    displacements.resize( num_processes_, 0 );
+    communicate_Iallgather_start_( send_buffer, recv_buffer, MPI_UNSIGNED );
+    return;
+  }
+#endif
+  communicate( send_buffer, recv_buffer, displacements );
+}
+
+void
+nest::MPIManager::communicate_start( std::vector< OffGridSpike >& send_buffer,
+  std::vector< OffGridSpike >& recv_buffer,
+  std::vector< int >& displacements )
+{
+#if MPI_VERSION >= 3
+  if ( get_num_processes() > 1 )
+  {
+    displacements.resize( num_processes_, 0 );
+    communicate_Iallgather_start_(
+      send_buffer, recv_buffer, MPI_OFFGRID_SPIKE );
+    return;
+  }
+#endif
+  communicate( send_buffer, recv_buffer, displacements );
+}
+
+void
+nest::MPIManager::communicate_start(
+  std::vector< CompactOffGridSpike >& send_buffer,
+  std::vector< CompactOffGridSpike >& recv_buffer,
+  std::vector< int >& displacements )
+{
+#if MPI_VERSION >= 3
+  if ( get_num_processes() > 1 )
+  {
+    displacements.resize( num_processes_, 0 );
+    communicate_Iallgather_start_(
+      send_buffer, recv_buffer, MPI_COMPACT_OFFGRID_SPIKE );
+    return;
+  }
+#endif
+  communicate( send_buffer, recv_buffer, displacements );
+}
+
+void
+nest::MPIManager::communicate_finish( std::vector< unsigned int >& send_buffer,
+  std::vector< unsigned int >& recv_buffer,
+  std::vector< int >& displacements )
+{
+#if MPI_VERSION >= 3
+  if ( comm_pending_ )
+  {
+    communicate_Iallgather_finish_(
+      send_buffer, recv_buffer, displacements, MPI_UNSIGNED );
+  }
+#endif
+}
+
+void
+nest::MPIManager::communicate_finish( std::vector< OffGridSpike >& send_buffer,
+  std::vector< OffGridSpike >& recv_buffer,
+  std::vector< int >& displacements )
+{
+#if MPI_VERSION >= 3
+  if ( comm_pending_ )
+  {
+    communicate_Iallgather_finish_(
+      send_buffer, recv_buffer, displacements, MPI_OFFGRID_SPIKE );
+  }
+#endif
+}
+
+void
+nest::MPIManager::communicate_finish(
+  std::vector< CompactOffGridSpike >& send_buffer,
+  std::vector< CompactOffGridSpike >& recv_buffer,
+  std::vector< int >& displacements )
+{
+#if MPI_VERSION >= 3
+  if ( comm_pending_ )
+  {
+    communicate_Iallgather_finish_(
+      send_buffer, recv_buffer, displacements, MPI_COMPACT_OFFGRID_SPIKE );
+  }
+#endif
+}
+
 void
 nest::MPIManager::communicate( std::vector< double >& send_buffer,
   std::vector< double >& recv_buffer,
@@ -1061,6 +1328,75 @@ nest::MPIManager::communicate( std::vector< OffGridSpike >& send_buffer,
   recv_buffer.swap( send_buffer );
 }
 
+/**
+ * communicate (compact off-grid) if compiled without MPI
+ */
+void
+nest::MPIManager::communicate(
+  std::vector< CompactOffGridSpike >& send_buffer,
+  std::vector< CompactOffGridSpike >& recv_buffer,
+  std::vector< int >& displacements )
+{
+  displacements.resize( num_processes_, 0 );
+  displacements[ 0 ] = 0;
+  if ( static_cast< size_t >( recv_buffer_size_ ) < send_buffer.size() )
+  {
+    recv_buffer_size_ = send_buffer_size_ = send_buffer.size();
+    recv_buffer.resize( recv_buffer_size_ );
+  }
+  recv_buffer.swap( send_buffer );
+}
+
+/**
+ * start exchange of spike buffers if compiled without MPI, which
+ * completes the exchange at once
+ */
+void
+nest::MPIManager::communicate_start( std::vector< unsigned int >& send_buffer,
+  std::vector< unsigned int >& recv_buffer,
+  std::vector< int >& displacements )
+{
+  communicate( send_buffer, recv_buffer, displacements );
+}
+
+void
+nest::MPIManager::communicate_start( std::vector< OffGridSpike >& send_buffer,
+  std::vector< OffGridSpike >& recv_buffer,
+  std::vector< int >& displacements )
+{
+  communicate( send_buffer, recv_buffer, displacements );
+}
+
+void
+nest::MPIManager::communicate_start(
+  std::vector< CompactOffGridSpike >& send_buffer,
+  std::vector< CompactOffGridSpike >& recv_buffer,
+  std::vector< int >& displacements )
+{
+  communicate( send_buffer, recv_buffer, displacements );
+}
+
+void
+nest::MPIManager::communicate_finish( std::vector< unsigned int >&,
+  std::vector< unsigned int >&,
+  std::vector< int >& )
+{
+}
+
+void
+nest::MPIManager::communicate_finish( std::vector< OffGridSpike >&,
+  std::vector< OffGridSpike >&,
+  std::vector< int >& )
+{
+}
+
+void
+nest::MPIManager::communicate_finish( std::vector< CompactOffGridSpike >&,
+  std::vector< CompactOffGridSpike >&,
+  std::vector< int >& )
+{
+}
+
 void
 nest::MPIManager::communicate( std::vector< double >& send_buffer,
   std::vector< double >& recv_buffer,
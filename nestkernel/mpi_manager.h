@@ -34,6 +34,7 @@
 
 // C++ includes:
 #include <cassert>
+#include <cstring>
 #include <iostream>
 #include <limits>
 #include <numeric>
@@ -56,6 +57,7 @@ class MPIManager : public ManagerInterface
 public:
   // forward declaration of internal classes
   class OffGridSpike;
+  class CompactOffGridSpike;
   class NodeAddressingData;
 
   MPIManager();
@@ -141,6 +143,48 @@ public:
     std::vector< OffGridSpike >& recv_buffer,
     std::vector< int >& displacements );
 
+  void communicate( std::vector< CompactOffGridSpike >& send_buffer,
+    std::vector< CompactOffGridSpike >& recv_buffer,
+    std::vector< int >& displacements );
+
+  /**
+   * Start exchanging spike buffers with all other processes, as done by
+   * communicate(), but return without waiting for the exchange to
+   * complete. Neither buffer may be modified, and the receive buffer may
+   * not be read, before communicate_finish() has been called with the
+   * same buffers. Reading the send buffer is permitted. If non-blocking
+   * collectives are not available, or if there is only one process, the
+   * exchange is completed before returning.
+   */
+  void communicate_start( std::vector< unsigned int >& send_buffer,
+    std::vector< unsigned int >& recv_buffer,
+    std::vector< int >& displacements );
+
+  void communicate_start( std::vector< OffGridSpike >& send_buffer,
+    std::vector< OffGridSpike >& recv_buffer,
+    std::vector< int >& displacements );
+
+  void communicate_start( std::vector< CompactOffGridSpike >& send_buffer,
+    std::vector< CompactOffGridSpike >& recv_buffer,
+    std::vector< int >& displacements );
+
+  /**
+   * Wait for the exchange started by communicate_start() to complete.
+   * Enlarges the receive buffer and repeats the exchange if the send
+   * buffer of any process was too large.
+   */
+  void communicate_finish( std::vector< unsigned int >& send_buffer,
+    std::vector< unsigned int >& recv_buffer,
+    std::vector< int >& displacements );
+
+  void communicate_finish( std::vector< OffGridSpike >& send_buffer,
+    std::vector< OffGridSpike >& recv_buffer,
+    std::vector< int >& displacements );
+
+  void communicate_finish( std::vector< CompactOffGridSpike >& send_buffer,
+    std::vector< CompactOffGridSpike >& recv_buffer,
+    std::vector< int >& displacements );
+
   void communicate( std::vector< double >& send_buffer,
     std::vector< double >& recv_buffer,
     std::vector< int >& displacements );
@@ -234,6 +278,7 @@ private:
   MPI_Comm comm;
 #endif /* #ifdef HAVE_MUSIC */
   MPI_Datatype MPI_OFFGRID_SPIKE;
+  MPI_Datatype MPI_COMPACT_OFFGRID_SPIKE;
 
   void communicate_Allgather( std::vector< unsigned int >& send_buffer,
     std::vector< unsigned int >& recv_buffer,
@@ -243,6 +288,20 @@ private:
     std::vector< OffGridSpike >& recv_buffer,
     std::vector< int >& displacements );
 
+  void communicate_Allgather( std::vector< CompactOffGridSpike >& send_buffer,
+    std::vector< CompactOffGridSpike >& recv_buffer,
+    std::vector< int >& displacements );
+
+  /**
+   * Allgather for off-grid spikes of either encoding, with MPI type
+   * spike_type describing SpikeT.
+   */
+  template < typename SpikeT >
+  void communicate_offgrid_Allgather_( std::vector< SpikeT >& send_buffer,
+    std::vector< SpikeT >& recv_buffer,
+    std::vector< int >& displacements,
+    MPI_Datatype spike_type );
+
   void communicate_Allgather( std::vector< int >& );
   void communicate_Allgather( std::vector< long >& );
 
@@ -257,6 +316,38 @@ private:
     std::vector< T >& recv_buffer,
     std::vector< int >& displacements );
 
+  //! request of the exchange started by communicate_start()
+  MPI_Request comm_request_;
+
+  //! true while an exchange started by communicate_start() is pending
+  bool comm_pending_;
+
+  /**
+   * Non-blocking Allgather of spike buffers, with MPI type type
+   * describing T, completed by communicate_Iallgather_finish_().
+   */
+  template < typename T >
+  void communicate_Iallgather_start_( std::vector< T >& send_buffer,
+    std::vector< T >& recv_buffer,
+    MPI_Datatype type );
+
+  template < typename T >
+  void communicate_Iallgather_finish_( std::vector< T >& send_buffer,
+    std::vector< T >& recv_buffer,
+    std::vector< int >& displacements,
+    MPI_Datatype type );
+
+  /**
+   * Write and read the GID field of a buffer entry, which holds the
+   * header of an overflow message.
+   */
+  static void set_comm_header_( unsigned int& entry, unsigned int value );
+  static unsigned int get_comm_header_( unsigned int entry );
+  template < typename SpikeT >
+  static void set_comm_header_( SpikeT& entry, unsigned int value );
+  template < typename SpikeT >
+  static unsigned int get_comm_header_( const SpikeT& entry );
+
 #endif /* #ifdef HAVE_MPI */
 
 public:
@@ -324,6 +415,77 @@ public:
     }
   };
 
+  /**
+   * Compact storage of GID and offset information for off-grid spikes.
+   *
+   * The GID is stored as 32-bit unsigned integer and the offset in
+   * single precision, so that a spike takes 8 instead of 16 bytes in the
+   * communication buffers. Offsets representable in single precision are
+   * transmitted exactly, all others are rounded to the nearest single
+   * precision value.
+   *
+   * @note The offset is stored as the bit pattern of a float in an
+   *       unsigned int, so that the user-defined MPI type
+   *       MPI_COMPACT_OFFGRID_SPIKE is homogeneous, see OffGridSpike.
+   */
+  class CompactOffGridSpike
+  {
+    friend void MPIManager::init_mpi( int*, char*** );
+
+  public:
+    typedef unsigned int gid_external_type;
+
+    CompactOffGridSpike()
+      : gid_( 0 )
+      , offset_( 0 )
+    {
+    }
+    CompactOffGridSpike( gid_external_type gidv, double offsetv )
+      : gid_( gidv )
+      , offset_( encode_offset_( offsetv ) )
+    {
+    }
+
+    unsigned int
+    get_gid() const
+    {
+      return gid_;
+    }
+    void
+    set_gid( gid_external_type gid )
+    {
+      gid_ = gid;
+    }
+    double
+    get_offset() const
+    {
+      float offset;
+      std::memcpy( &offset, &offset_, sizeof( float ) );
+      return offset;
+    }
+
+  private:
+    unsigned int gid_;    //!< GID of neuron that spiked
+    unsigned int offset_; //!< offset of spike from grid, as float bits
+
+    static unsigned int
+    encode_offset_( double offset )
+    {
+      const float offset_f = static_cast< float >( offset );
+      unsigned int bits;
+      std::memcpy( &bits, &offset_f, sizeof( float ) );
+      return bits;
+    }
+
+    //! This function asserts that an unsigned int can hold a float
+    static void
+    assert_datatype_compatibility_()
+    {
+      assert( sizeof( float ) == sizeof( unsigned int ) );
+      assert( sizeof( CompactOffGridSpike ) == 2 * sizeof( unsigned int ) );
+    }
+  };
+
   class NodeAddressingData
   {
   public:
@@ -28,11 +28,13 @@
 // Includes from nestkernel:
 #include "exceptions.h"
 #include "kernel_manager.h"
+#include "memory_accounting.h"
 #include "mpi_manager_impl.h"
 #include "nodelist.h"
 #include "subnet.h"
 
 // Includes from sli:
+#include "namedatum.h"
 #include "sliexceptions.h"
 #include "token.h"
 
@@ -147,6 +149,33 @@ get_kernel_status()
   return d;
 }
 
+DictionaryDatum
+get_memory_status()
+{
+  assert( kernel().is_initialized() );
+
+  DictionaryDatum d( new Dictionary );
+  kernel().node_manager.get_memory_status( d );
+  kernel().connection_manager.get_memory_status( d );
+  kernel().event_delivery_manager.get_memory_status( d );
+
+  const thread n_threads = kernel().vp_manager.get_num_threads();
+  std::vector< long > ring_buffers( n_threads );
+  std::vector< long > recorders( n_threads );
+  std::vector< long > topology_caches( n_threads );
+  for ( thread t = 0; t < n_threads; ++t )
+  {
+    ring_buffers[ t ] = MemoryAccounting::get( MEM_RING_BUFFERS, t );
+    recorders[ t ] = MemoryAccounting::get( MEM_RECORDERS, t );
+    topology_caches[ t ] = MemoryAccounting::get( MEM_TOPOLOGY, t );
+  }
+  def< std::vector< long > >( d, names::ring_buffers, ring_buffers );
+  def< std::vector< long > >( d, names::recorders, recorders );
+  def< std::vector< long > >( d, names::topology_caches, topology_caches );
+
+  return d;
+}
+
 void
 set_node_status( const index node_id, const DictionaryDatum& dict )
 {
@@ -159,6 +188,20 @@ get_node_status( const index node_id )
   return kernel().node_manager.get_status( node_id );
 }
 
+void
+set_node_status_columns( const std::vector< long >& node_ids,
+  const DictionaryDatum& columns )
+{
+  kernel().node_manager.set_status_columns( node_ids, columns );
+}
+
+DictionaryDatum
+get_node_status_columns( const std::vector< long >& node_ids,
+  const std::vector< Name >& keys )
+{
+  return kernel().node_manager.get_status_columns( node_ids, keys );
+}
+
 void
 set_connection_status( const ConnectionDatum& conn,
   const DictionaryDatum& dict )
@@ -238,6 +281,106 @@ get_connections( const DictionaryDatum& dict )
   return array;
 }
 
+ArrayDatum
+create_ensemble( const long n_instances, const DictionaryDatum& params )
+{
+  if ( n_instances < 1 )
+  {
+    throw BadParameter( "An ensemble needs at least one instance." );
+  }
+
+  // check the per-instance properties before the network is changed
+  for ( Dictionary::const_iterator it = params->begin(); it != params->end();
+        ++it )
+  {
+    if ( kernel().model_manager.get_modeldict()->lookup( it->first ).empty()
+      and kernel()
+            .model_manager.get_synapsedict()
+            ->lookup( it->first )
+            .empty() )
+    {
+      throw UnknownModelName( it->first );
+    }
+    const DictionaryDatum props = getValue< DictionaryDatum >( it->second );
+    for ( Dictionary::const_iterator p = props->begin(); p != props->end();
+          ++p )
+    {
+      const ArrayDatum values = getValue< ArrayDatum >( p->second );
+      if ( values.size() != static_cast< size_t >( n_instances ) )
+      {
+        throw DimensionMismatch( n_instances, values.size() );
+      }
+    }
+  }
+
+  kernel().node_manager.replicate_nodes( n_instances );
+  const index template_size =
+    kernel().node_manager.get_ensemble_template_size();
+  kernel().connection_manager.replicate_connections(
+    template_size, n_instances );
+
+  for ( Dictionary::const_iterator it = params->begin(); it != params->end();
+        ++it )
+  {
+    // split the arrays of values into one dictionary per instance
+    const DictionaryDatum props = getValue< DictionaryDatum >( it->second );
+    std::vector< DictionaryDatum > instance_props;
+    for ( long k = 0; k < n_instances; ++k )
+    {
+      DictionaryDatum d( new Dictionary );
+      for ( Dictionary::const_iterator p = props->begin(); p != props->end();
+            ++p )
+      {
+        ( *d )[ p->first ] = getValue< ArrayDatum >( p->second )[ k ];
+      }
+      instance_props.push_back( d );
+    }
+
+    const Token model = kernel().model_manager.get_modeldict()->lookup(
+      it->first );
+    if ( not model.empty() )
+    {
+      const index model_id = static_cast< index >( model );
+      for ( index gid = 1; gid <= template_size; ++gid )
+      {
+        if ( kernel().modelrange_manager.get_model_id( gid ) == model_id )
+        {
+          for ( long k = 0; k < n_instances; ++k )
+          {
+            set_node_status( gid + k * template_size, instance_props[ k ] );
+          }
+        }
+      }
+      continue;
+    }
+
+    DictionaryDatum selection( new Dictionary );
+    ( *selection )[ names::synapse_model ] = LiteralDatum( it->first );
+    const ArrayDatum conns =
+      kernel().connection_manager.get_connections( selection );
+    for ( Token* c = conns.begin(); c != conns.end(); ++c )
+    {
+      const ConnectionDatum conn = getValue< ConnectionDatum >( *c );
+      const index k = ( conn.get_target_gid() - 1 ) / template_size;
+      set_connection_status( conn, instance_props[ k ] );
+    }
+  }
+
+  ArrayDatum instances;
+  instances.reserve( n_instances );
+  for ( long k = 0; k < n_instances; ++k )
+  {
+    ArrayDatum gids;
+    gids.reserve( template_size );
+    for ( index gid = 1; gid <= template_size; ++gid )
+    {
+      gids.push_back( gid + k * template_size );
+    }
+    instances.push_back( gids );
+  }
+  return instances;
+}
+
 void
 simulate( const double& time )
 {
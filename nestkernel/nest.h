@@ -25,6 +25,7 @@
 
 // C++ includes:
 #include <ostream>
+#include <vector>
 
 // Includes from libnestutil:
 #include "logging.h"
@@ -64,9 +65,20 @@ librandom::RngPtr get_global_rng();
 void set_kernel_status( const DictionaryDatum& dict );
 DictionaryDatum get_kernel_status();
 
+/**
+ * Return the memory used by the subsystems of the kernel on this process,
+ * in bytes per thread.
+ */
+DictionaryDatum get_memory_status();
+
 void set_node_status( const index node_id, const DictionaryDatum& dict );
 DictionaryDatum get_node_status( const index node_id );
 
+void set_node_status_columns( const std::vector< long >& node_ids,
+  const DictionaryDatum& columns );
+DictionaryDatum get_node_status_columns( const std::vector< long >& node_ids,
+  const std::vector< Name >& keys );
+
 void set_connection_status( const ConnectionDatum& conn,
   const DictionaryDatum& dict );
 DictionaryDatum get_connection_status( const ConnectionDatum& conn );
@@ -80,6 +92,15 @@ void connect( const GIDCollection& sources,
 
 ArrayDatum get_connections( const DictionaryDatum& dict );
 
+/**
+ * Instantiate the network built so far n_instances times, see
+ * NodeManager::replicate_nodes(). The dictionary maps names of node and
+ * synapse models to dictionaries of properties with one value per
+ * instance. Returns an array with the GIDs of each instance.
+ */
+ArrayDatum create_ensemble( const long n_instances,
+  const DictionaryDatum& params );
+
 void simulate( const double& t );
 void resume_simulation();
 /**
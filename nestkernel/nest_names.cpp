@@ -63,7 +63,9 @@ const Name autapses( "autapses" );
 const Name b( "b" );
 const Name beta( "beta" );
 const Name beta_Ca( "beta_Ca" );
+const Name bin_width( "bin_width" );
 const Name binary( "binary" );
+const Name binned( "binned" );
 
 const Name c( "c" );
 const Name c_1( "c_1" );
@@ -79,10 +81,20 @@ const Name close_after_simulate( "close_after_simulate" );
 const Name close_on_reset( "close_on_reset" );
 const Name coeff_ex( "coeff_ex" );
 const Name coeff_in( "coeff_in" );
+const Name communication_buffers( "communication_buffers" );
+const Name connections( "connections" );
+const Name connectors( "connectors" );
+const Name count_window( "count_window" );
+const Name cv_isi( "cv_isi" );
 const Name coeff_m( "coeff_m" );
+const Name communication_overlap( "communication_overlap" );
+const Name compact_off_grid_spiking( "compact_off_grid_spiking" );
 const Name configbit_0( "configbit_0" );
 const Name configbit_1( "configbit_1" );
 const Name connection_count( "connection_count" );
+const Name connector_memory_allocated( "connector_memory_allocated" );
+const Name connector_memory_fragmented( "connector_memory_fragmented" );
+const Name connector_memory_used( "connector_memory_used" );
 const Name consistent_integration( "consistent_integration" );
 const Name continuous( "continuous" );
 const Name count_covariance( "count_covariance" );
@@ -90,6 +102,7 @@ const Name count_histogram( "count_histogram" );
 const Name covariance( "covariance" );
 const Name currents( "currents" );
 const Name customdict( "customdict" );
+const Name cycles( "cycles" );
 
 const Name d( "d" );
 const Name D_lower( "D_lower" );
@@ -104,6 +117,7 @@ const Name dead_time_random( "dead_time_random" );
 const Name dead_time_shape( "dead_time_shape" );
 const Name delay( "delay" );
 const Name delays( "delays" );
+const Name deliver( "deliver" );
 const Name deliver_interval( "deliver_interval" );
 const Name delta_P( "delta_P" );
 const Name Delta_T( "Delta_T" );
@@ -124,6 +138,7 @@ const Name distribution( "distribution" );
 const Name drift_factor( "drift_factor" );
 const Name driver_readout_time( "driver_readout_time" );
 const Name dt( "dt" );
+const Name dtlb_misses( "dtlb_misses" );
 const Name dU( "U" );
 
 const Name E_ahp( "E_ahp" );
@@ -145,11 +160,14 @@ const Name E_rr( "E_rr" );
 const Name E_sfa( "E_sfa" );
 const Name element_type( "element_type" );
 const Name elementsize( "elementsize" );
+const Name ensemble_size( "ensemble_size" );
+const Name ensemble_template_size( "ensemble_template_size" );
 const Name epoch( "epoch" );
 const Name eps( "eps" );
 const Name equilibrate( "equilibrate" );
 const Name error( "error" );
 const Name eta( "eta" );
+const Name event_registers( "event_registers" );
 const Name events( "events" );
 const Name ex_spikes( "ex_spikes" );
 
@@ -157,6 +175,8 @@ const Name F_lower( "F_lower" );
 const Name F_mean( "F_mean" );
 const Name F_std( "F_std" );
 const Name F_upper( "F_upper" );
+const Name fano_factor( "fano_factor" );
+const Name fast_forward( "fast_forward" );
 const Name fbuffer_size( "fbuffer_size" );
 const Name file( "file" );
 const Name file_extension( "file_extension" );
@@ -198,7 +218,9 @@ const Name GABA_A( "GABA_A" );
 const Name GABA_B( "GABA_B" );
 const Name gamma( "gamma" );
 const Name gamma_shape( "gamma_shape" );
+const Name gather( "gather" );
 const Name gaussian( "gaussian" );
+const Name gid_offset( "gid_offset" );
 const Name global_id( "global_id" );
 const Name grng( "grng" );
 const Name grng_seed( "grng_seed" );
@@ -241,6 +263,7 @@ const Name init_flag( "init_flag" );
 const Name initial_connector_capacity( "initial_connector_capacity" );
 const Name instant_unblock_NMDA( "instant_unblock_NMDA" );
 const Name instantiations( "instantiations" );
+const Name instructions( "instructions" );
 const Name Interpol_Order( "Interpol_Order" );
 const Name interval( "interval" );
 const Name is_refractory( "is_refractory" );
@@ -256,6 +279,7 @@ const Name large_connector_limit( "large_connector_limit" );
 const Name len_kernel( "len_kernel" );
 const Name linear( "linear" );
 const Name linear_summation( "linear_summation" );
+const Name llc_misses( "llc_misses" );
 const Name local( "local" );
 const Name local_id( "local_id" );
 const Name local_num_threads( "local_num_threads" );
@@ -265,6 +289,8 @@ const Name lookuptable_1( "lookuptable_1" );
 const Name lookuptable_2( "lookuptable_2" );
 
 const Name make_symmetric( "make_symmetric" );
+const Name materialized_node_models( "materialized_node_models" );
+const Name materialized_synapse_models( "materialized_synapse_models" );
 const Name max_delay( "max_delay" );
 const Name MAXERR( "MAXERR" );
 const Name mean( "mean" );
@@ -273,6 +299,8 @@ const Name message_times( "messages_times" );
 const Name messages( "messages" );
 const Name min_delay( "min_delay" );
 const Name model( "model" );
+const Name model_registration( "model_registration" );
+const Name module_init( "module_init" );
 const Name mother_rng( "mother_rng" );
 const Name mother_seed( "mother_seed" );
 const Name ms_per_tic( "ms_per_tic" );
@@ -287,15 +315,18 @@ const Name n( "n" );
 const Name N( "N" );
 const Name N_channels( "N_channels" );
 const Name n_events( "n_events" );
+const Name n_bins( "n_bins" );
 const Name n_messages( "n_messages" );
 const Name n_proc( "n_proc" );
 const Name n_receptors( "n_receptors" );
+const Name n_spikes( "n_spikes" );
 const Name n_synapses( "n_synapses" );
 const Name neuron( "neuron" );
 const Name network_size( "network_size" );
 const Name next_readout_time( "next_readout_time" );
 const Name NMDA( "NMDA" );
 const Name node_uses_wfr( "node_uses_wfr" );
+const Name nodes( "nodes" );
 const Name noise( "noise" );
 const Name noisy_rate( "noisy_rate" );
 const Name no_synapses( "no_synapses" );
@@ -318,9 +349,13 @@ const Name P( "P" );
 const Name p_copy( "p_copy" );
 const Name p_transmit( "p_transmit" );
 const Name parent( "parent" );
+const Name perf_counters( "perf_counters" );
+const Name perf_counters_available( "perf_counters_available" );
+const Name perf_counts( "perf_counts" );
 const Name phase( "phase" );
 const Name phi( "phi" );
 const Name phi_th( "phi_th" );
+const Name pipelined_communication( "pipelined_communication" );
 const Name port( "port" );
 const Name ports( "ports" );
 const Name port_name( "port_name" );
@@ -345,6 +380,8 @@ const Name q_sfa( "q_sfa" );
 const Name q_stc( "q_stc" );
 
 const Name rate( "rate" );
+const Name rate_engine_active( "rate_engine_active" );
+const Name rates( "rates" );
 const Name readout_cycle_duration( "readout_cycle_duration" );
 const Name receive_buffer_size( "receive_buffer_size" );
 const Name receptor_type( "receptor_type" );
@@ -354,6 +391,7 @@ const Name record_from( "record_from" );
 const Name record_to( "record_to" );
 const Name recordables( "recordables" );
 const Name recorder( "recorder" );
+const Name recorders( "recorders" );
 const Name rectify_output( "rectify_output" );
 const Name refractory_input( "refractory_input" );
 const Name registered( "registered" );
@@ -362,6 +400,7 @@ const Name reset_pattern( "reset_pattern" );
 const Name resolution( "resolution" );
 const Name requires_symmetric( "requires_symmetric" );
 const Name rho_0( "rho_0" );
+const Name ring_buffers( "ring_buffers" );
 const Name rms( "rms" );
 const Name rng_seeds( "rng_seeds" );
 const Name root_finding_epsilon( "root_finding_epsilon" );
@@ -377,18 +416,26 @@ const Name sdev( "sdev" );
 const Name send_buffer_size( "send_buffer_size" );
 const Name senders( "senders" );
 const Name shift_now_spikes( "shift_now_spikes" );
+const Name shm( "shm" );
+const Name shm_buffer_size( "shm_buffer_size" );
+const Name shm_name( "shm_name" );
+const Name shm_names( "shm_names" );
 const Name sigma( "sigma" );
 const Name sigmoid( "sigmoid" );
 const Name size_of( "sizeof" );
+const Name sli_init( "sli_init" );
 const Name soma_curr( "soma_curr" );
 const Name soma_exc( "soma_exc" );
 const Name soma_inh( "soma_inh" );
 const Name source( "source" );
 const Name spike( "spike" );
+const Name spike_histories( "spike_histories" );
 const Name spike_multiplicities( "spike_multiplicities" );
+const Name spike_stream_times( "spike_stream_times" );
 const Name spike_times( "spike_times" );
 const Name spike_weights( "spike_weights" );
 const Name start( "start" );
+const Name startup_times( "startup_times" );
 const Name state( "state" );
 const Name std( "std" );
 const Name std_mod( "std_mod" );
@@ -472,6 +519,8 @@ const Name theta_eq( "theta_eq" );
 const Name theta_ex( "theta_ex" );
 const Name theta_in( "theta_in" );
 const Name thread( "thread" );
+const Name thread_binding( "thread_binding" );
+const Name thread_cpus( "thread_cpus" );
 const Name thread_local_id( "thread_local_id" );
 const Name tics_per_ms( "tics_per_ms" );
 const Name tics_per_step( "tics_per_step" );
@@ -485,6 +534,8 @@ const Name to_do( "to_do" );
 const Name to_file( "to_file" );
 const Name to_memory( "to_memory" );
 const Name to_screen( "to_screen" );
+const Name to_shm( "to_shm" );
+const Name topology_caches( "topology_caches" );
 const Name total_num_virtual_procs( "total_num_virtual_procs" );
 const Name Tstart( "Tstart" );
 const Name Tstop( "Tstop" );
@@ -500,6 +551,7 @@ const Name U_upper( "U_upper" );
 const Name update( "update" );
 const Name update_node( "update_node" );
 const Name use_gid_in_filename( "use_gid_in_filename" );
+const Name use_rate_engine( "use_rate_engine" );
 const Name use_wfr( "use_wfr" );
 const Name update_synaptic_elements( "update_synaptic_elements" );
 
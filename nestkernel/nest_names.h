@@ -77,7 +77,9 @@ extern const Name b;    //!< Specific to Brette & Gerstner 2005 (aeif_cond-*)
 extern const Name beta; //!< Specific to amat2_*
 extern const Name
   beta_Ca; //!< Increment in calcium concentration with each spike
+extern const Name bin_width; //!< Used by spike_statistics_detector
 extern const Name binary; //!< Recorder parameter
+extern const Name binned; //!< Used by correlation devices
 
 extern const Name c;         //!< Specific to Izhikevich 2003
 extern const Name c_1;       //!< Specific to stochastic neuron pp_psc_delta
@@ -96,11 +98,21 @@ extern const Name
   coeff_ex; //!< tau_lcm=coeff_ex*tau_ex (precise timing neurons (Brette 2007))
 extern const Name
   coeff_in; //!< tau_lcm=coeff_in*tau_in (precise timing neurons (Brette 2007))
+extern const Name communication_buffers; //!< Memory accounting
+extern const Name connections;  //!< Memory accounting
+extern const Name connectors;   //!< Memory accounting
+extern const Name count_window; //!< Used by spike_statistics_detector
+extern const Name cv_isi;       //!< Used by spike_statistics_detector
 extern const Name
   coeff_m; //!< tau_lcm=coeff_m*tau_m (precise timing neurons (Brette 2007))
+extern const Name communication_overlap; //!< Used by event_delivery_manager
+extern const Name compact_off_grid_spiking; //!< Used by event_delivery_manager
 extern const Name configbit_0;      //!< Used in stdp_connection_facetshw_hom
 extern const Name configbit_1;      //!< Used in stdp_connection_facetshw_hom
 extern const Name connection_count; //!< Parameters for MUSIC devices
+extern const Name connector_memory_allocated;  //!< Connector arena statistics
+extern const Name connector_memory_fragmented; //!< Connector arena statistics
+extern const Name connector_memory_used;       //!< Connector arena statistics
 extern const Name consistent_integration; //!< Specific to Izhikevich 2003
 extern const Name continuous;             //!< Parameter for MSP dynamics
 extern const Name count_covariance; //!< Specific to correlomatrix_detector
@@ -108,6 +120,7 @@ extern const Name count_histogram;  //!< Specific to correlation_detector
 extern const Name covariance;       //!< Specific to correlomatrix_detector
 extern const Name currents;         //!< Recorder parameter
 extern const Name customdict;       //!< Used by Subnet
+extern const Name cycles;           //!< Used by PerfCounters
 
 extern const Name d; //!< Specific to Izhikevich 2003
 extern const Name D_lower;
@@ -125,6 +138,7 @@ extern const Name dead_time_shape;  //!< Shape parameter of the dead time
 //!< distribution (stochastic neuron pp_psc_delta)
 extern const Name delay;            //!< Connection parameters
 extern const Name delays;           //!< Connection parameters
+extern const Name deliver;          //!< Used by PerfCounters
 extern const Name deliver_interval; //!< Used by volume_transmitter
 extern const Name delta_P;          //!< specific to Hill & Tononi 2005
 extern const Name Delta_T; //!< Specific to Brette & Gerstner 2005 (aeif_cond-*)
@@ -147,6 +161,7 @@ extern const Name distribution;        //!< Connectivity-related
 extern const Name drift_factor;        //!< Specific to diffusion connection
 extern const Name driver_readout_time; //!< Used by stdp_connection_facetshw_hom
 extern const Name dt;                  //!< Miscellaneous parameters
+extern const Name dtlb_misses;          //!< Used by PerfCounters
 extern const Name
   dU; //!< Unit increment of the utilization for a facilitating synapse [0...1]
       //!< (Tsodyks2_connection)
@@ -170,11 +185,14 @@ extern const Name E_rr;         //!< Other adaptation
 extern const Name E_sfa;        //!< Other adaptation
 extern const Name element_type; //!< Node type
 extern const Name elementsize;  //!< Used in genericmodel
+extern const Name ensemble_size;          //!< Instances of an ensemble
+extern const Name ensemble_template_size; //!< Nodes per instance
 extern const Name epoch;
 extern const Name eps;         //!< MSP growth curve parameter
 extern const Name equilibrate; //!< specific to ht_neuron
 extern const Name error;       //!< Indicates an error (sli_neuron)
 extern const Name eta;         //!< MSP growth curve parameter
+extern const Name event_registers; //!< Memory accounting
 extern const Name events;      //!< Recorder parameter
 extern const Name
   ex_spikes; //!< Number of arriving excitatory spikes (sli_neuron)
@@ -183,6 +201,8 @@ extern const Name F_lower;
 extern const Name F_mean;
 extern const Name F_std;
 extern const Name F_upper;
+extern const Name fano_factor;    //!< Used by spike_statistics_detector
+extern const Name fast_forward;   //!< Used by iaf_psc_* models
 extern const Name fbuffer_size;   //!< Recorder parameter
 extern const Name file;           //!< Recorder parameter
 extern const Name file_extension; //!< Recorder parameter
@@ -226,7 +246,9 @@ extern const Name GABA_B;
 extern const Name gamma;         //!< Specific to mirollo_strogatz_ps
 extern const Name gamma_shape;   //!< Specific to ppd_sup_generator and
                                  //!< gamma_sup_generator
+extern const Name gather;        //!< Used by PerfCounters
 extern const Name gaussian;      //!< Parameter for MSP growth curves
+extern const Name gid_offset;    //!< Used by spike_replay_generator
 extern const Name global_id;     //!< Node parameter
 extern const Name grng;          //!< Used in rng_manager
 extern const Name grng_seed;     //!< Seed
@@ -280,6 +302,7 @@ extern const Name instant_unblock_NMDA;       //!< specific to Hill-Tononi
 extern const Name instantiations;             //!< model paramater
 extern const Name
   Interpol_Order;           //!< Interpolation order (precise timing neurons)
+extern const Name instructions; //!< Used by PerfCounters
 extern const Name interval; //!< Recorder parameter
 extern const Name is_refractory; //!< Neuron is in refractory period (debugging)
 
@@ -296,6 +319,7 @@ extern const Name len_kernel; //!< Specific to population point process model
                               //!< (pp_pop_psc_delta)
 extern const Name linear;     //!< Parameter for MSP growth curves
 extern const Name linear_summation;    //!< Specific to rate models
+extern const Name llc_misses;          //!< Used by PerfCounters
 extern const Name local;               //!< Node parameter
 extern const Name local_id;            //!< Node
 extern const Name local_num_threads;   //!< Local number of threads
@@ -305,6 +329,8 @@ extern const Name lookuptable_1;       //!< Used in stdp_connection_facetshw_hom
 extern const Name lookuptable_2;       //!< Used in stdp_connection_facetshw_hom
 
 extern const Name make_symmetric; //!< Connectivity-related
+extern const Name materialized_node_models;    //!< Kernel status
+extern const Name materialized_synapse_models; //!< Kernel status
 extern const Name max_delay;      //!< In ConnBuilder
 extern const Name MAXERR; //!< Largest permissible error for adaptive stepsize
                           //!< (Brette & Gerstner 2005)
@@ -314,6 +340,8 @@ extern const Name message_times; //!< Used in music_message_in_proxy
 extern const Name messages;      //!< Used in music_message_in_proxy
 extern const Name min_delay;     //!< In ConnBuilder
 extern const Name model;         //!< Node parameter
+extern const Name model_registration; //!< Startup time
+extern const Name module_init;        //!< Startup time
 extern const Name mother_rng;    //!< Specific to mip_generator
 extern const Name mother_seed;   //!< Specific to mip_generator
 extern const Name ms_per_tic;    //!< Simulation-related
@@ -331,16 +359,19 @@ extern const Name N;          //!< Specific to population point process model
                               //!< (pp_pop_psc_delta)
 extern const Name N_channels; //!< Specific to correlomatrix_detector
 extern const Name n_events;   //!< Recorder parameter
+extern const Name n_bins;     //!< Used by spike_statistics_detector
 extern const Name n_messages; //!< Used in music_message_in_proxy
 extern const Name
   n_proc; //!< Number of component processes of ppd_sup_/gamma_sup_generator
 extern const Name n_receptors; //!< number of receptor ports
+extern const Name n_spikes;    //!< Used by spike_statistics_detector
 extern const Name n_synapses;
 extern const Name neuron;            //!< Node type
 extern const Name network_size;      //!< Network size
 extern const Name next_readout_time; //!< Used by stdp_connection_facetshw_hom
 extern const Name NMDA;
 extern const Name node_uses_wfr;      //!< Node parameter
+extern const Name nodes;              //!< Memory accounting
 extern const Name noise;              //!< Specific to iaf_chs_2008 neuron
                                       //!< and rate models
 extern const Name noisy_rate;         //!< Specific to rate models
@@ -364,9 +395,13 @@ extern const Name p; //!< current release probability  (Tsodyks2_connection)
 extern const Name p_copy;                //!< Specific to mip_generator
 extern const Name p_transmit;            //!< Specific to bernoulli_synapse
 extern const Name parent;                //!< Node parameter
+extern const Name perf_counters;         //!< Used by simulation_manager
+extern const Name perf_counters_available; //!< Used by simulation_manager
+extern const Name perf_counts;           //!< Used by simulation_manager
 extern const Name phase;                 //!< Signal phase in degrees
 extern const Name phi;                   //!< Specific to mirollo_strogatz_ps
 extern const Name phi_th;                //!< Specific to mirollo_strogatz_ps
+extern const Name pipelined_communication; //!< Used by event_delivery_manager
 extern const Name port;                  //!< Connection parameters
 extern const Name ports;                 //!< Recorder parameter
 extern const Name port_name;             //!< Parameters for MUSIC devices
@@ -392,6 +427,8 @@ extern const Name q_stc; //!< Specific to gif models
 
 extern const Name rate; //!< Specific to ppd_sup_generator,
                         //!< gamma_sup_generator and rate models
+extern const Name rate_engine_active; //!< Used by event_delivery_manager
+extern const Name rates; //!< Used by spike_statistics_detector
 extern const Name readout_cycle_duration; //!< Used by
                                           //!< stdp_connection_facetshw_hom
 extern const Name receive_buffer_size;    //!< mpi-related
@@ -403,6 +440,7 @@ extern const Name record_to;              //!< Recorder parameter
 extern const Name
   recordables; //!< List of recordable state data (Device parameters)
 extern const Name recorder;       //!< Node type
+extern const Name recorders;      //!< Memory accounting
 extern const Name rectify_output; //!< Specific to rate models
 extern const Name
   refractory_input; //!< Spikes arriving during refractory period are counted
@@ -415,6 +453,7 @@ extern const Name resolution;         //!< Time resolution
 extern const Name requires_symmetric; //!< Used in connector_model_impl
 extern const Name rho_0;     //!< Specific to population point process model
                              //!< (pp_pop_psc_delta)
+extern const Name ring_buffers; //!< Memory accounting
 extern const Name rms;       //!< Root mean square
 extern const Name rng_seeds; //!< Used in rng_manager
 extern const Name root_finding_epsilon; //!< Accuracy of the root of the
@@ -431,20 +470,28 @@ extern const Name sdev;             //!< Used in pulsepacket_generator
 extern const Name send_buffer_size; //!< mpi-related
 extern const Name senders;          //!< Recorder parameter
 extern const Name shift_now_spikes; //!< Used by spike_generator
+extern const Name shm;              //!< Recorder parameter
+extern const Name shm_buffer_size;  //!< Recorder parameter
+extern const Name shm_name;         //!< Used by shm_*_generator
+extern const Name shm_names;        //!< Recorder parameter
 extern const Name
   sigma; //!< Specific to rate models (Gaussian gain function (tuning spread))
 extern const Name sigmoid;   //!< Sigmoid MSP growth curve
 extern const Name size_of;   //!< Connection parameters
+extern const Name sli_init;  //!< Startup time
 extern const Name soma_curr; //!< Used by iaf_cond_alpha_mc
 extern const Name soma_exc;  //!< Used by iaf_cond_alpha_mc
 extern const Name soma_inh;  //!< Used by iaf_cond_alpha_mc
 extern const Name source;    //!< Connection parameters
 extern const Name spike;     //!< true if the neuron spikes and false if not.
                              //!< (sli_neuron)
+extern const Name spike_histories;                //!< Memory accounting
 extern const Name spike_multiplicities;           //!x Used by spike_generator
+extern const Name spike_stream_times;             //!< Kernel status
 extern const Name spike_times;                    //!< Recorder parameter
 extern const Name spike_weights;                  //!< Used by spike_generator
 extern const Name start;                          //!< Device parameters
+extern const Name startup_times;                  //!< Kernel status
 extern const Name state;                          //!< Node parameter
 extern const Name std;                            //!< Miscellaneous parameters
 extern const Name std_mod;                        //!< Miscellaneous parameters
@@ -543,6 +590,8 @@ extern const Name theta_ex; //!< specific to rate neurons (offset excitatory
 extern const Name theta_in; //!< specific to rate neurons (offset inhibitory
 // multiplicative coupling)
 extern const Name thread;                  //!< Node parameter
+extern const Name thread_binding;          //!< OpenMP thread binding policy
+extern const Name thread_cpus;             //!< CPU each thread is running on
 extern const Name thread_local_id;         //!< Thead-local ID of node,
                                            //!< see Kunkel et al 2014, Sec 3.3.2
 extern const Name tics_per_ms;             //!< Simulation-related
@@ -557,6 +606,8 @@ extern const Name to_do;                   //!< Simulation-related
 extern const Name to_file;                 //!< Recorder parameter
 extern const Name to_memory;               //!< Recorder parameter
 extern const Name to_screen;               //!< Recorder parameter
+extern const Name to_shm;                  //!< Recorder parameter
+extern const Name topology_caches;         //!< Memory accounting
 extern const Name total_num_virtual_procs; //!< Total number virtual processes
 extern const Name Tstart;                  //!< Specific to correlation and
                                            //!< correlomatrix detector
@@ -572,7 +623,8 @@ extern const Name U_std;
 extern const Name U_upper;
 extern const Name update;      //!< Command to execute the neuron (sli_neuron)
 extern const Name update_node; //!< Command to execute the neuron (sli_neuron)
-extern const Name use_wfr;     //!< Simulation-related
+extern const Name use_rate_engine; //!< Used by event_delivery_manager
+extern const Name use_wfr;         //!< Simulation-related
 extern const Name use_gid_in_filename; //!< use gid in the filename
 
 extern const Name V_act_NMDA; //!< specific to Hill & Tononi 2005
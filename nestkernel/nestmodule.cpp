@@ -44,6 +44,7 @@
 #include "node.h"
 #include "nodelist.h"
 #include "sp_manager_impl.h"
+#include "spike_replay_file.h"
 #include "subnet.h"
 
 // Includes from sli:
@@ -280,6 +281,171 @@ NestModule::SetStatus_aaFunction::execute( SLIInterpreter* i ) const
   i->EStack.pop();
 }
 
+/* BeginDocumentation
+   Name: SetStatusColumns - set properties of many nodes from arrays of values
+
+   Synopsis:
+   [gids] << /key [values] ... >> SetStatusColumns -> -
+
+   Description:
+   For each key in the dictionary, SetStatusColumns sets the property of
+   the i-th node in the array of GIDs to the i-th value of the array
+   associated with the key. Value arrays must be homogeneous arrays of
+   integers or doubles, or IntVectors or DoubleVectors, and must have the
+   same length as the array of GIDs.
+
+   This is equivalent to calling SetStatus for each node with a dictionary
+   containing one value from each array, but the keys are checked only
+   once for each model and nodes are updated in parallel by the threads
+   they belong to. Nodes that are not local to the process are skipped.
+
+   Examples:
+   /iaf_psc_alpha 3 Create ;
+   [1 2 3] << /V_m [-70.0 -65.0 -60.0] /I_e [100.0 200.0 300.0] >>
+   SetStatusColumns
+
+   Availability: NEST
+   SeeAlso: GetStatusColumns, SetStatus
+*/
+void
+NestModule::SetStatusColumns_a_DFunction::execute( SLIInterpreter* i ) const
+{
+  i->assert_stack_load( 2 );
+
+  DictionaryDatum columns = getValue< DictionaryDatum >( i->OStack.top() );
+  const std::vector< long > gids =
+    getValue< std::vector< long > >( i->OStack.pick( 1 ) );
+
+  set_node_status_columns( gids, columns );
+
+  i->OStack.pop( 2 );
+  i->EStack.pop();
+}
+
+/* BeginDocumentation
+   Name: GetStatusColumns - get properties of many nodes as arrays of values
+
+   Synopsis:
+   [gids] [/key ...] GetStatusColumns -> << /key [values] ... >>
+
+   Description:
+   GetStatusColumns returns a dictionary that maps each of the given keys
+   to an array containing the value of this property for each node in the
+   array of GIDs. Properties that are doubles or integers on the first
+   node are returned as DoubleVector or IntVector, respectively, all other
+   properties as arrays. All nodes must be local to the process.
+
+   Examples:
+   /iaf_psc_alpha 3 Create ;
+   [1 2 3] [/V_m /t_ref] GetStatusColumns
+
+   Availability: NEST
+   SeeAlso: SetStatusColumns, GetStatus
+*/
+void
+NestModule::GetStatusColumns_a_aFunction::execute( SLIInterpreter* i ) const
+{
+  i->assert_stack_load( 2 );
+
+  ArrayDatum key_a = getValue< ArrayDatum >( i->OStack.top() );
+  const std::vector< long > gids =
+    getValue< std::vector< long > >( i->OStack.pick( 1 ) );
+
+  std::vector< Name > keys;
+  for ( Token* k = key_a.begin(); k != key_a.end(); ++k )
+  {
+    keys.push_back( Name( getValue< std::string >( *k ) ) );
+  }
+
+  DictionaryDatum columns = get_node_status_columns( gids, keys );
+
+  i->OStack.pop( 2 );
+  i->OStack.push( columns );
+  i->EStack.pop();
+}
+
+/* BeginDocumentation
+   Name: GetMemoryStatus - report memory used by the kernel
+
+   Synopsis:
+   GetMemoryStatus -> dict
+
+   Description:
+   GetMemoryStatus returns a dictionary with the number of bytes used by
+   the parts of the kernel on this process. Unless noted otherwise, each
+   entry is an array with one value per thread.
+
+   The following entries are reported:
+   nodes                 - dictionary with the memory pools of each node
+                           model, including space reserved for new nodes
+   spike_histories       - spike archives of neurons with STDP synapses
+   ring_buffers          - RingBuffer, SliceRingBuffer and relatives
+   recorders             - events stored in memory by recording devices
+   connections           - dictionary with the size of all connections of
+                           each synapse model
+   connectors            - memory held by the connector arenas
+   event_registers       - spikes registered for communication
+   communication_buffers - send and receive buffers of this process (integer)
+   topology_caches       - position caches of topology layers
+
+   Memory freed by another thread than the one that allocated it is
+   counted for the freeing thread, so that only the sums over threads of
+   ring_buffers, recorders and topology_caches are exact.
+
+   Examples:
+   GetMemoryStatus /connections get
+
+   Availability: NEST
+   SeeAlso: GetKernelStatus, memory_thisjob
+*/
+void
+NestModule::GetMemoryStatusFunction::execute( SLIInterpreter* i ) const
+{
+  i->OStack.push( get_memory_status() );
+  i->EStack.pop();
+}
+
+/* BeginDocumentation
+   Name: WriteSpikeReplayFile - write spikes to a file for replay
+
+   Synopsis:
+   (filename) [gids] [times] WriteSpikeReplayFile -> -
+
+   Description:
+   WriteSpikeReplayFile writes the spikes of the given senders at the given
+   times in ms to a binary file, which is replayed by the
+   spike_replay_generator. Times are converted to time steps and offsets
+   with the current resolution, and spikes are sorted by time. The arrays
+   are typically taken from the events of a spike_detector.
+
+   Examples:
+   sd /events get dup /senders get cva exch /times get cva
+   (spikes.rpl) rolld WriteSpikeReplayFile
+
+   Availability: NEST
+   SeeAlso: spike_replay_generator, spike_detector
+*/
+void
+NestModule::WriteSpikeReplayFileFunction::execute( SLIInterpreter* i ) const
+{
+  i->assert_stack_load( 3 );
+
+  const std::vector< double > times =
+    getValue< std::vector< double > >( i->OStack.top() );
+  const std::vector< long > gids =
+    getValue< std::vector< long > >( i->OStack.pick( 1 ) );
+  const std::string filename = getValue< std::string >( i->OStack.pick( 2 ) );
+
+  if ( gids.size() != times.size() )
+  {
+    throw DimensionMismatch( gids.size(), times.size() );
+  }
+  SpikeReplayFile::write( filename, gids, times );
+
+  i->OStack.pop( 3 );
+  i->EStack.pop();
+}
+
 /* BeginDocumentation
    Name: GetStatus - return the property dictionary of a node, connection,
    random deviate generator or object
@@ -638,6 +804,69 @@ NestModule::RestoreNodes_aFunction::execute( SLIInterpreter* i ) const
   i->EStack.pop();
 }
 
+/* BeginDocumentation
+   Name: CreateEnsemble - instantiate the network many times
+
+   Synopsis:
+   n        CreateEnsemble -> [[gids] ...]
+   n params CreateEnsemble -> [[gids] ...]
+
+   Parameters:
+   n      - number of instances
+   params - dictionary mapping names of node and synapse models to
+            dictionaries of properties, with an array of n values for
+            each property
+
+   Description:
+   CreateEnsemble turns the network built so far into the template of an
+   ensemble of n independent instances, which are simulated together in a
+   single kernel. This saves the startup, network construction and Prepare
+   of n separate simulations, e.g., in parameter scans of small networks.
+
+   The template consists of all nodes, with GIDs 1 to N. The copy of node
+   gid in instance k, counting from 0, has GID gid + k * N, and has the
+   same properties as the template node. All connections among template
+   nodes are copied to each instance with the same synapse properties.
+   Recording devices with a label get the instance appended to it, e.g.,
+   (sd-3).
+
+   For each model in params, the k-th value of each property is set on the
+   nodes or connections of that model in instance k. Random generators
+   draw numbers from the generator of their virtual process, so that the
+   instances receive different realizations of random input.
+
+   CreateEnsemble returns an array with the GIDs of each instance. The
+   kernel status reports ensemble_size and ensemble_template_size.
+
+   The network must not contain subnets. CreateEnsemble can be called once
+   after ResetKernel, before the first simulation. With several MPI
+   processes, N must be a multiple of the number of virtual processes.
+
+   Examples:
+   /iaf_psc_alpha Create ;
+   /spike_detector << /label (sd) >> Create ;
+   1 2 Connect
+   3 << /iaf_psc_alpha << /I_e [ 376. 400. 450. ] >> >> CreateEnsemble
+   % -> [[1 2] [3 4] [5 6]], with detectors labeled (sd-0), (sd-1), (sd-2)
+
+   Availability: NEST
+   SeeAlso: Create, Connect, RestoreNodes, ResetKernel
+*/
+void
+NestModule::CreateEnsemble_i_DFunction::execute( SLIInterpreter* i ) const
+{
+  i->assert_stack_load( 2 );
+
+  const DictionaryDatum params = getValue< DictionaryDatum >( i->OStack.top() );
+  const long n_instances = getValue< long >( i->OStack.pick( 1 ) );
+
+  ArrayDatum instances = create_ensemble( n_instances, params );
+
+  i->OStack.pop( 2 );
+  i->OStack.push( instances );
+  i->EStack.pop();
+}
+
 void
 NestModule::GetNodes_i_D_b_bFunction::execute( SLIInterpreter* i ) const
 {
@@ -1717,14 +1946,19 @@ NestModule::init( SLIInterpreter* i )
     "GetChildren_i_D_b", &getchildren_i_D_bfunction, "NEST 3.0" );
 
   i->createcommand( "RestoreNodes_a", &restorenodes_afunction );
+  i->createcommand( "CreateEnsemble_i_D", &createensemble_i_Dfunction );
 
   i->createcommand( "SetStatus_id", &setstatus_idfunction );
   i->createcommand( "SetStatus_CD", &setstatus_CDfunction );
   i->createcommand( "SetStatus_aa", &setstatus_aafunction );
+  i->createcommand( "SetStatusColumns", &setstatuscolumns_a_Dfunction );
 
   i->createcommand( "GetStatus_i", &getstatus_ifunction );
   i->createcommand( "GetStatus_C", &getstatus_Cfunction );
   i->createcommand( "GetStatus_a", &getstatus_afunction );
+  i->createcommand( "GetStatusColumns", &getstatuscolumns_a_afunction );
+  i->createcommand( "GetMemoryStatus", &getmemorystatusfunction );
+  i->createcommand( "WriteSpikeReplayFile", &writespikereplayfilefunction );
 
   i->createcommand( "GetConnections_D", &getconnections_Dfunction );
   i->createcommand( "cva_C", &cva_cfunction );
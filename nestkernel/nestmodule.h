@@ -201,6 +201,36 @@ public:
     void execute( SLIInterpreter* ) const;
   } setstatus_aafunction;
 
+  class SetStatusColumns_a_DFunction : public SLIFunction
+  {
+  public:
+    void execute( SLIInterpreter* ) const;
+  } setstatuscolumns_a_Dfunction;
+
+  class GetStatusColumns_a_aFunction : public SLIFunction
+  {
+  public:
+    void execute( SLIInterpreter* ) const;
+  } getstatuscolumns_a_afunction;
+
+  class GetMemoryStatusFunction : public SLIFunction
+  {
+  public:
+    void execute( SLIInterpreter* ) const;
+  } getmemorystatusfunction;
+
+  class WriteSpikeReplayFileFunction : public SLIFunction
+  {
+  public:
+    void execute( SLIInterpreter* ) const;
+  } writespikereplayfilefunction;
+
+  class CreateEnsemble_i_DFunction : public SLIFunction
+  {
+  public:
+    void execute( SLIInterpreter* ) const;
+  } createensemble_i_Dfunction;
+
   class SetDefaults_l_DFunction : public SLIFunction
   {
   public:
@@ -49,6 +49,7 @@ Node::Node()
   , vp_( invalid_thread_ )
   , frozen_( false )
   , buffers_initialized_( false )
+  , calibrated_( false )
   , node_uses_wfr_( false )
 {
 }
@@ -64,6 +65,7 @@ Node::Node( const Node& n )
   , frozen_( n.frozen_ )
   // copy must always initialized its own buffers
   , buffers_initialized_( false )
+  , calibrated_( false )
   , node_uses_wfr_( n.node_uses_wfr_ )
 {
 }
@@ -174,6 +174,22 @@ public:
 
   virtual bool is_off_grid() const;
 
+  /**
+   * Returns true if the node can obtain its rate input from the
+   * RateNetworkEngine instead of handling DelayedRateConnectionEvents
+   * and InstantaneousRateConnectionEvents.
+   * @see RateNetworkEngine
+   */
+  virtual bool supports_rate_engine() const;
+
+  /**
+   * Returns true if the update of the node does not depend on events
+   * delivered at the beginning of a time slice, as for stimulating devices
+   * and multimeters. Such nodes are updated while a pipelined spike
+   * exchange is still in progress.
+   * @see EventDeliveryManager::start_gather_events()
+   */
+  virtual bool independent_of_delivery() const;
 
   /**
    * Returns true if the node is a proxy node. This is implemented because
@@ -298,6 +314,19 @@ public:
    */
   virtual void calibrate() = 0;
 
+  /**
+   * Returns true if calibrate() depends on the state of the run, e.g., on
+   * the simulation time or on files closed in finalize(). Such nodes are
+   * calibrated in each call to Prepare, all other nodes only if they have
+   * been modified since the last one. post_run_cleanup() and finalize() are
+   * only invoked on nodes returning true.
+   */
+  virtual bool
+  is_run_dependent() const
+  {
+    return false;
+  }
+
   /**
    * Cleanup node after Run. Override this function if a node needs to
    * "wrap up" things after a call to Run, i.e., before
@@ -832,6 +861,19 @@ public:
     buffers_initialized_ = initialized;
   }
 
+  //! True if the node has been calibrated and not modified since.
+  bool
+  is_calibrated() const
+  {
+    return calibrated_;
+  }
+
+  void
+  set_calibrated( bool calibrated )
+  {
+    calibrated_ = calibrated;
+  }
+
   /**
    * Return the number of thread siblings in SiblingContainer.
    *
@@ -938,6 +980,7 @@ private:
   thread vp_;                //!< virtual process node is assigned to
   bool frozen_;              //!< node shall not be updated if true
   bool buffers_initialized_; //!< Buffers have been initialized
+  bool calibrated_;          //!< node is calibrated and unmodified
   bool node_uses_wfr_;       //!< node uses waveform relaxation method
 };
 
@@ -989,6 +1032,18 @@ Node::is_off_grid() const
   return false;
 }
 
+inline bool
+Node::supports_rate_engine() const
+{
+  return false;
+}
+
+inline bool
+Node::independent_of_delivery() const
+{
+  return false;
+}
+
 inline bool
 Node::is_proxy() const
 {
@@ -23,14 +23,18 @@
 #include "node_manager.h"
 
 // C++ includes:
+#include <algorithm>
 #include <set>
+#include <utility>
 
 // Includes from libnestutil:
 #include "compose.hpp"
 #include "logging.h"
 
 // Includes from nestkernel:
+#include "archiving_node.h"
 #include "event_delivery_manager.h"
+#include "exceptions.h"
 #include "genericmodel.h"
 #include "genericmodel_impl.h"
 #include "kernel_manager.h"
@@ -43,11 +47,48 @@
 #include "vp_manager_impl.h"
 
 // Includes from sli:
+#include "arraydatum.h"
 #include "dictutils.h"
+#include "doubledatum.h"
+#include "integerdatum.h"
 
 namespace nest
 {
 
+namespace
+{
+/**
+ * Read an integer property that Node::get_status_base() reports for all
+ * local nodes, without building the status dictionary.
+ * @returns false if key is not such a property
+ */
+bool
+get_integer_property_( const Node& node, const Name& key, long& value )
+{
+  if ( key == names::global_id )
+  {
+    value = node.get_gid();
+  }
+  else if ( key == names::thread )
+  {
+    value = node.get_thread();
+  }
+  else if ( key == names::vp )
+  {
+    value = node.get_vp();
+  }
+  else if ( key == names::thread_local_id )
+  {
+    value = node.get_thread_lid();
+  }
+  else
+  {
+    return false;
+  }
+  return true;
+}
+}
+
 NodeManager::NodeManager()
   : local_nodes_()
   , root_( 0 )
@@ -57,8 +98,16 @@ NodeManager::NodeManager()
   , nodes_vec_()
   , wfr_nodes_vec_()
   , wfr_is_used_( false )
+  , run_dependent_nodes_vec_()
+  , num_modified_nodes_()
+  , foreign_modified_nodes_()
+  , calibrate_all_nodes_( true )
+  , prepared_min_delay_( 0 )
+  , prepared_max_delay_( 0 )
   , nodes_vec_network_size_( 0 ) // zero to force update
   , num_active_nodes_( 0 )
+  , ensemble_size_( 1 )
+  , ensemble_template_size_( 0 )
 {
 }
 
@@ -121,6 +170,12 @@ NodeManager::initialize()
 
   /* END of code adding the root subnet. */
 
+  calibrate_all_nodes_ = true;
+  foreign_modified_nodes_.assign(
+    kernel().vp_manager.get_num_threads(), std::vector< bool >() );
+  ensemble_size_ = 1;
+  ensemble_template_size_ = 0;
+
   // explicitly force construction of nodes_vec_ to ensure consistent state
   nodes_vec_network_size_ = 0;
   ensure_valid_thread_local_ids();
@@ -148,6 +203,7 @@ NodeManager::reinit_nodes()
       container.  Subnets are not iterated, since their nodes are
       registered in nodes_ directly.
     */
+  calibrate_all_nodes_ = true;
   for ( size_t n = 0; n < local_nodes_.size(); ++n )
   {
     Node* node = local_nodes_.get_node_by_index( n );
@@ -293,21 +349,98 @@ index NodeManager::add_node( index mod, long n ) // no_p
     // We only need to reserve memory on the ranks on which we
     // actually create nodes. In this if-branch ---> Only on
     // simulation processes
-    if ( kernel().mpi_manager.get_rank()
-      < kernel().mpi_manager.get_num_sim_processes() )
+    const bool is_sim_process = kernel().mpi_manager.get_rank()
+      < kernel().mpi_manager.get_num_sim_processes();
+    if ( is_sim_process )
     {
       // TODO: This will work reasonably for round-robin. The extra 50 entries
       //       are for subnets and devices.
       local_nodes_.reserve(
         std::ceil( static_cast< double >( max_gid )
           / kernel().mpi_manager.get_num_sim_processes() ) + 50 );
-      for ( thread t = 0; t < n_threads; ++t )
+    }
+
+    // Each thread allocates the nodes it owns from its own pool, so that
+    // node memory is first touched by the thread that updates the nodes
+    // and thus placed in the memory of its NUMA domain. Growing the pools
+    // touches all new memory and is done in parallel. Node constructors
+    // copy reference-counted members of the prototype, so they must not
+    // run concurrently.
+    const index n_sim_vps =
+      kernel().mpi_manager.get_num_sim_processes() * n_threads;
+    std::vector< std::vector< Node* > > thread_nodes( n_threads );
+    std::vector< lockPTR< WrappedThreadException > > exceptions_raised(
+      n_threads );
+#pragma omp parallel
+    {
+      const thread t = kernel().vp_manager.get_thread_id();
+      if ( is_sim_process )
       {
-        // Model::reserve() reserves memory for n ADDITIONAL nodes on thread t
-        // reserves at least one entry on each thread, nobody knows why
-        model->reserve_additional( t, n_per_thread );
+        // first gid >= min_gid which belongs to the VP of this thread
+        const thread vp = kernel().vp_manager.thread_to_vp( t );
+        index gid =
+          min_gid + ( vp + n_sim_vps - min_gid % n_sim_vps ) % n_sim_vps;
+        try
+        {
+          // Model::reserve() reserves memory for n ADDITIONAL nodes on thread
+          // t reserves at least one entry on each thread, nobody knows why
+          model->reserve_additional( t, n_per_thread );
+          if ( gid < max_gid )
+          {
+            thread_nodes[ t ].reserve( ( max_gid - gid - 1 ) / n_sim_vps + 1 );
+          }
+        }
+        catch ( std::exception& err )
+        {
+          exceptions_raised.at( t ) = lockPTR< WrappedThreadException >(
+            new WrappedThreadException( err ) );
+          gid = max_gid;
+        }
+#pragma omp critical( add_node_allocate )
+        {
+          // exceptions must not leave the critical region
+          try
+          {
+            for ( ; gid < max_gid; gid += n_sim_vps )
+            {
+              Node* newnode = model->allocate( t );
+              newnode->set_gid_( gid );
+              newnode->set_model_id( mod );
+              newnode->set_thread( t );
+              newnode->set_vp( vp );
+              thread_nodes[ t ].push_back( newnode );
+            }
+          }
+          catch ( std::exception& err )
+          {
+            // We must create a new exception here, err's lifetime ends at
+            // the end of the catch block.
+            exceptions_raised.at( t ) = lockPTR< WrappedThreadException >(
+              new WrappedThreadException( err ) );
+          }
+        }
+      }
+    }
+
+    for ( thread t = 0; t < n_threads; ++t )
+    {
+      if ( exceptions_raised.at( t ).valid() )
+      {
+        // release the nodes of all threads, none of them has been registered
+        for ( thread tt = 0; tt < n_threads; ++tt )
+        {
+          for ( std::vector< Node* >::iterator it = thread_nodes[ tt ].begin();
+                it != thread_nodes[ tt ].end();
+                ++it )
+          {
+            ( *it )->~Node();
+            model->free( tt, *it );
+          }
+        }
+        throw WrappedThreadException( *( exceptions_raised.at( t ) ) );
       }
     }
+    std::vector< size_t > next_thread_node( n_threads, 0 );
 
     size_t gid;
     if ( kernel().vp_manager.is_local_vp(
@@ -337,11 +470,8 @@ index NodeManager::add_node( index mod, long n ) // no_p
 
       if ( kernel().vp_manager.is_local_vp( vp ) )
       {
-        Node* newnode = model->allocate( t );
-        newnode->set_gid_( gid );
-        newnode->set_model_id( mod );
-        newnode->set_thread( t );
-        newnode->set_vp( vp );
+        Node* newnode = thread_nodes[ t ][ next_thread_node[ t ]++ ];
+        assert( newnode->get_gid() == gid );
 
         local_nodes_.add_local_node( *newnode ); // put into local nodes list
         current_->add_node( newnode ); // and into current subnet, thread 0.
@@ -520,6 +650,130 @@ NodeManager::restore_nodes( const ArrayDatum& node_list )
   current_ = root;
 }
 
+void
+NodeManager::replicate_nodes( size_t n_instances )
+{
+  const index template_size = size() - 1;
+  if ( n_instances < 1 )
+  {
+    throw BadParameter( "An ensemble needs at least one instance." );
+  }
+  if ( ensemble_size_ > 1 )
+  {
+    throw BadParameter( "An ensemble has been created already." );
+  }
+  if ( kernel().simulation_manager.has_been_simulated() )
+  {
+    throw BadParameter( "An ensemble must be created before simulating." );
+  }
+  if ( template_size == 0 )
+  {
+    throw BadParameter( "An ensemble needs at least one node." );
+  }
+  if ( kernel().mpi_manager.get_num_processes() > 1
+    and template_size % kernel().vp_manager.get_num_virtual_processes() != 0 )
+  {
+    // otherwise, copies of a node may be on another process than the node
+    throw BadParameter(
+      "With several MPI processes, the number of nodes in an ensemble must "
+      "be a multiple of the number of virtual processes." );
+  }
+  for ( index gid = 1; gid <= template_size; ++gid )
+  {
+    if ( get_node( gid )->is_subnet() )
+    {
+      throw BadParameter( "An ensemble cannot contain subnets." );
+    }
+  }
+
+  // status of the local template nodes, taken before any copy is changed
+  std::vector< DictionaryDatum > status( template_size + 1 );
+  std::vector< bool > is_labeled_recorder( template_size + 1, false );
+  for ( index gid = 1; gid <= template_size; ++gid )
+  {
+    if ( is_local_gid( gid ) )
+    {
+      status[ gid ] = get_status( gid );
+
+      // the default buffer size is reported as -1, but cannot be set
+      if ( status[ gid ]->known( names::fbuffer_size )
+        and getValue< long >( ( *status[ gid ] )[ names::fbuffer_size ] ) < 0 )
+      {
+        status[ gid ]->remove( names::fbuffer_size );
+      }
+
+      is_labeled_recorder[ gid ] = status[ gid ]->known( names::label )
+        and getValue< Name >( ( *status[ gid ] )[ names::element_type ] )
+          == names::recorder
+        and not getValue< std::string >( ( *status[ gid ] )[ names::label ] )
+                  .empty();
+    }
+  }
+
+  Subnet* const cwn = current_;
+  current_ = root_;
+  for ( size_t k = 1; k < n_instances; ++k )
+  {
+    index gid = 1;
+    while ( gid <= template_size )
+    {
+      // create runs of nodes of the same model at once
+      const index model_id = kernel().modelrange_manager.get_model_id( gid );
+      index last = gid;
+      while ( last < template_size
+        and kernel().modelrange_manager.get_model_id( last + 1 ) == model_id )
+      {
+        ++last;
+      }
+      add_node( model_id, last - gid + 1 );
+      gid = last + 1;
+    }
+  }
+  current_ = cwn;
+
+  for ( index gid = 1; gid <= template_size; ++gid )
+  {
+    if ( not is_local_gid( gid ) )
+    {
+      continue;
+    }
+    const std::string label = is_labeled_recorder[ gid ]
+      ? getValue< std::string >( ( *status[ gid ] )[ names::label ] )
+      : std::string();
+
+    for ( size_t k = 0; k < n_instances; ++k )
+    {
+      if ( is_labeled_recorder[ gid ] )
+      {
+        ( *status[ gid ] )[ names::label ] =
+          String::compose( "%1-%2", label, k );
+      }
+      else if ( k == 0 )
+      {
+        continue;
+      }
+
+      // we call set_status_base() directly to bypass checking of unused
+      // dictionary items, as in restore_nodes()
+      // the sibling container of devices, as get_node() returns a sibling
+      Node* node = local_nodes_.get_node_by_gid( gid + k * template_size );
+      if ( node->num_thread_siblings() == 0 )
+      {
+        set_node_modified( *node );
+        node->set_status_base( status[ gid ] );
+      }
+      for ( size_t t = 0; t < node->num_thread_siblings(); ++t )
+      {
+        set_node_modified( *node->get_thread_sibling( t ) );
+        node->get_thread_sibling( t )->set_status_base( status[ gid ] );
+      }
+    }
+  }
+
+  ensemble_size_ = n_instances;
+  ensemble_template_size_ = template_size;
+}
+
 void
 NodeManager::init_state( index GID )
 {
@@ -529,6 +783,7 @@ NodeManager::init_state( index GID )
     throw UnknownNode( GID );
   }
 
+  set_node_modified( *n );
   n->init_state();
 }
 
@@ -645,6 +900,9 @@ NodeManager::ensure_valid_thread_local_ids()
       nodes_vec_.resize( kernel().vp_manager.get_num_threads() );
       wfr_nodes_vec_.clear();
       wfr_nodes_vec_.resize( kernel().vp_manager.get_num_threads() );
+      run_dependent_nodes_vec_.clear();
+      run_dependent_nodes_vec_.resize( kernel().vp_manager.get_num_threads() );
+      num_modified_nodes_.assign( kernel().vp_manager.get_num_threads(), 0 );
 
       for ( index t = 0; t < kernel().vp_manager.get_num_threads(); ++t )
       {
@@ -702,6 +960,20 @@ NodeManager::ensure_valid_thread_local_ids()
               wfr_nodes_vec_[ t ].push_back( node );
             }
           }
+          else
+          {
+            continue;
+          }
+
+          Node* const added = nodes_vec_[ t ].back();
+          if ( added->is_run_dependent() )
+          {
+            run_dependent_nodes_vec_[ t ].push_back( added );
+          }
+          if ( not added->is_calibrated() )
+          {
+            ++num_modified_nodes_[ t ];
+          }
         }
       } // end of for threads
 
@@ -759,6 +1031,7 @@ NodeManager::set_status_single_node_( Node& target,
     {
       d->clear_access_flags();
     }
+    set_node_modified( target );
     target.set_status_base( d );
 
     // TODO: Not sure this check should be at single neuron level; advantage is
@@ -775,6 +1048,35 @@ NodeManager::prepare_node_( Node* n )
   // have ring buffers and can accept incoming spikes.
   n->init_buffers();
   n->calibrate();
+  n->set_calibrated( true );
+}
+
+void
+NodeManager::set_node_modified( Node& n )
+{
+  if ( n.is_calibrated() )
+  {
+    n.set_calibrated( false );
+    ++num_modified_nodes_[ n.get_thread() ];
+  }
+}
+
+void
+NodeManager::set_node_modified( Node& n, thread tid )
+{
+  if ( n.get_thread() == tid )
+  {
+    set_node_modified( n );
+  }
+  else if ( not n.is_proxy() )
+  {
+    std::vector< bool >& modified = foreign_modified_nodes_[ tid ];
+    if ( modified.size() <= n.get_gid() )
+    {
+      modified.resize( std::max( size(), n.get_gid() + 1 ), false );
+    }
+    modified[ n.get_gid() ] = true;
+  }
 }
 
 void
@@ -782,16 +1084,50 @@ NodeManager::prepare_nodes()
 {
   assert( kernel().is_initialized() );
 
-  /* We initialize the buffers of each node and calibrate it. */
+  /* We initialize the buffers of each node and calibrate it. Nodes which
+     have been calibrated before and have not been modified since are
+     skipped, unless their calibration depends on the state of the run.
+     If no node has been modified, the nodes are not even visited and the
+     counts of active nodes from the last call remain valid. */
+
+  const delay min_delay = kernel().connection_manager.get_min_delay();
+  const delay max_delay = kernel().connection_manager.get_max_delay();
+  if ( min_delay != prepared_min_delay_ or max_delay != prepared_max_delay_ )
+  {
+    calibrate_all_nodes_ = true;
+  }
+
+  // mark nodes recorded by other threads, see set_node_modified( Node&,
+  // thread ); only the thread of a node may mark it during connecting
+  for ( index t = 0; t < foreign_modified_nodes_.size(); ++t )
+  {
+    std::vector< bool >& modified = foreign_modified_nodes_[ t ];
+    for ( index gid = 0; gid < modified.size(); ++gid )
+    {
+      if ( modified[ gid ] )
+      {
+        set_node_modified( *get_node( gid ) );
+      }
+    }
+    modified.clear();
+  }
+
+  bool nodes_modified = calibrate_all_nodes_;
+  for ( index t = 0; t < kernel().vp_manager.get_num_threads(); ++t )
+  {
+    nodes_modified = nodes_modified or num_modified_nodes_[ t ] > 0;
+  }
 
   size_t num_active_nodes = 0;     // counts nodes that will be updated
   size_t num_active_wfr_nodes = 0; // counts nodes that use waveform relaxation
+  size_t num_prepared_nodes = 0;   // counts nodes that have been calibrated
 
   std::vector< lockPTR< WrappedThreadException > > exceptions_raised(
     kernel().vp_manager.get_num_threads() );
 
 #ifdef _OPENMP
-#pragma omp parallel reduction( + : num_active_nodes, num_active_wfr_nodes )
+#pragma omp parallel reduction( \
+  + : num_active_nodes, num_active_wfr_nodes, num_prepared_nodes )
   {
     size_t t = kernel().vp_manager.get_thread_id();
 #else
@@ -803,19 +1139,39 @@ NodeManager::prepare_nodes()
     // exceptions here and then handle them after the parallel region.
     try
     {
-      for ( std::vector< Node* >::iterator it = nodes_vec_[ t ].begin();
-            it != nodes_vec_[ t ].end();
-            ++it )
+      if ( nodes_modified )
       {
-        prepare_node_( *it );
-        if ( not( *it )->is_frozen() )
+        for ( std::vector< Node* >::iterator it = nodes_vec_[ t ].begin();
+              it != nodes_vec_[ t ].end();
+              ++it )
         {
-          ++num_active_nodes;
-          if ( ( *it )->node_uses_wfr() )
+          if ( calibrate_all_nodes_ or not( *it )->is_calibrated()
+            or ( *it )->is_run_dependent() )
           {
-            ++num_active_wfr_nodes;
+            prepare_node_( *it );
+            ++num_prepared_nodes;
+          }
+          if ( not( *it )->is_frozen() )
+          {
+            ++num_active_nodes;
+            if ( ( *it )->node_uses_wfr() )
+            {
+              ++num_active_wfr_nodes;
+            }
           }
         }
+        num_modified_nodes_[ t ] = 0;
+      }
+      else
+      {
+        for ( std::vector< Node* >::iterator it =
+                run_dependent_nodes_vec_[ t ].begin();
+              it != run_dependent_nodes_vec_[ t ].end();
+              ++it )
+        {
+          prepare_node_( *it );
+          ++num_prepared_nodes;
+        }
       }
     }
     catch ( std::exception& e )
@@ -836,6 +1192,20 @@ NodeManager::prepare_nodes()
     }
   }
 
+  calibrate_all_nodes_ = false;
+  prepared_min_delay_ = min_delay;
+  prepared_max_delay_ = max_delay;
+
+  if ( not nodes_modified )
+  {
+    std::ostringstream os;
+    os << "Network unchanged, preparing " << num_prepared_nodes
+       << ( num_prepared_nodes == 1 ? " device" : " devices" )
+       << " for simulation.";
+    LOG( M_INFO, "NodeManager::prepare_nodes", os.str() );
+    return;
+  }
+
   std::ostringstream os;
   std::string tmp_str = num_active_nodes == 1 ? " node" : " nodes";
   os << "Preparing " << num_active_nodes << tmp_str << " for simulation.";
@@ -862,23 +1232,12 @@ NodeManager::post_run_cleanup()
   for ( index t = 0; t < kernel().vp_manager.get_num_threads(); ++t )
   {
 #endif // clang-format on
-    for ( size_t idx = 0; idx < local_nodes_.size(); ++idx )
+    for ( std::vector< Node* >::iterator it =
+            run_dependent_nodes_vec_[ t ].begin();
+          it != run_dependent_nodes_vec_[ t ].end();
+          ++it )
     {
-      Node* node = local_nodes_.get_node_by_index( idx );
-      if ( node != 0 )
-      {
-        if ( node->num_thread_siblings() > 0 )
-        {
-          node->get_thread_sibling( t )->post_run_cleanup();
-        }
-        else
-        {
-          if ( static_cast< index >( node->get_thread() ) == t )
-          {
-            node->post_run_cleanup();
-          }
-        }
-      }
+      ( *it )->post_run_cleanup();
     }
   }
 }
@@ -898,23 +1257,12 @@ NodeManager::finalize_nodes()
   for ( index t = 0; t < kernel().vp_manager.get_num_threads(); ++t )
   {
 #endif // clang-format on
-    for ( size_t idx = 0; idx < local_nodes_.size(); ++idx )
+    for ( std::vector< Node* >::iterator it =
+            run_dependent_nodes_vec_[ t ].begin();
+          it != run_dependent_nodes_vec_[ t ].end();
+          ++it )
     {
-      Node* node = local_nodes_.get_node_by_index( idx );
-      if ( node != 0 )
-      {
-        if ( node->num_thread_siblings() > 0 )
-        {
-          node->get_thread_sibling( t )->finalize();
-        }
-        else
-        {
-          if ( static_cast< index >( node->get_thread() ) == t )
-          {
-            node->finalize();
-          }
-        }
-      }
+      ( *it )->finalize();
     }
   }
 }
@@ -981,10 +1329,275 @@ NodeManager::set_status( index gid, const DictionaryDatum& d )
   }
 }
 
+void
+NodeManager::set_status_columns( const std::vector< long >& gids,
+  const DictionaryDatum& columns )
+{
+  const size_t n = gids.size();
+
+  // Convert all columns to plain vectors; integer columns remain integer
+  // so that integer properties are set with the proper type.
+  std::vector< Name > keys;
+  std::vector< bool > is_int;
+  std::vector< std::vector< long > > int_cols;
+  std::vector< std::vector< double > > double_cols;
+  for ( Dictionary::const_iterator it = columns->begin();
+        it != columns->end();
+        ++it )
+  {
+    const Token& col = it->second;
+    ArrayDatum* ad = dynamic_cast< ArrayDatum* >( col.datum() );
+    const bool int_col = dynamic_cast< IntVectorDatum* >( col.datum() ) != 0
+      or ( ad != 0 and ad->size() > 0
+           and dynamic_cast< IntegerDatum* >( ad->get( 0 ).datum() ) != 0 );
+
+    keys.push_back( it->first );
+    is_int.push_back( int_col );
+    int_cols.push_back( int_col ? getValue< std::vector< long > >( col )
+                                : std::vector< long >() );
+    double_cols.push_back( int_col ? std::vector< double >()
+                                   : getValue< std::vector< double > >( col ) );
+
+    const size_t len = int_col ? int_cols.back().size()
+                               : double_cols.back().size();
+    if ( len != n )
+    {
+      throw DimensionMismatch( n, len );
+    }
+  }
+
+  DictionaryDatum d( new Dictionary );
+
+  // Serial pass: the first node of each model and all devices and subnets
+  // are set here, all other nodes are queued for the thread owning them.
+  const thread n_threads = kernel().vp_manager.get_num_threads();
+  std::vector< std::vector< std::pair< size_t, Node* > > > queued( n_threads );
+  std::set< int > validated_models;
+  for ( size_t i = 0; i < n; ++i )
+  {
+    if ( gids[ i ] <= 0 )
+    {
+      throw UnknownNode( gids[ i ] );
+    }
+    Node* target = local_nodes_.get_node_by_gid( gids[ i ] );
+    if ( target == 0 or target->is_proxy() )
+    {
+      continue;
+    }
+
+    if ( target->num_thread_siblings() == 0
+      and validated_models.count( target->get_model_id() ) != 0 )
+    {
+      queued[ target->get_thread() ].push_back( std::make_pair( i, target ) );
+      continue;
+    }
+
+    for ( size_t k = 0; k < keys.size(); ++k )
+    {
+      if ( is_int[ k ] )
+      {
+        ( *d )[ keys[ k ] ] = int_cols[ k ][ i ];
+      }
+      else
+      {
+        ( *d )[ keys[ k ] ] = double_cols[ k ][ i ];
+      }
+    }
+    set_status( gids[ i ], d );
+    if ( target->num_thread_siblings() == 0 )
+    {
+      validated_models.insert( target->get_model_id() );
+    }
+  }
+
+  // Each thread gets its own dictionary, since access flags are stored
+  // in the dictionary and datums must not be allocated in parallel.
+  std::vector< DictionaryDatum > thread_dicts( n_threads );
+  std::vector< std::vector< Datum* > > thread_values( n_threads );
+  for ( thread t = 0; t < n_threads; ++t )
+  {
+    thread_dicts[ t ] = DictionaryDatum( new Dictionary );
+    for ( size_t k = 0; k < keys.size(); ++k )
+    {
+      Token& tok = thread_dicts[ t ]->insert( keys[ k ],
+        is_int[ k ] ? Token( new IntegerDatum( 0 ) )
+                    : Token( new DoubleDatum( 0.0 ) ) );
+      thread_values[ t ].push_back( tok.datum() );
+    }
+  }
+
+  std::vector< lockPTR< WrappedThreadException > > exceptions_raised(
+    n_threads );
+
+#pragma omp parallel
+  {
+    const thread t = kernel().vp_manager.get_thread_id();
+    try
+    {
+      for ( std::vector< std::pair< size_t, Node* > >::const_iterator it =
+              queued[ t ].begin();
+            it != queued[ t ].end();
+            ++it )
+      {
+        for ( size_t k = 0; k < keys.size(); ++k )
+        {
+          if ( is_int[ k ] )
+          {
+            *static_cast< IntegerDatum* >( thread_values[ t ][ k ] ) =
+              int_cols[ k ][ it->first ];
+          }
+          else
+          {
+            *static_cast< DoubleDatum* >( thread_values[ t ][ k ] ) =
+              double_cols[ k ][ it->first ];
+          }
+        }
+        // keys have been validated on the first node of the model
+        set_node_modified( *it->second );
+        it->second->set_status_base( thread_dicts[ t ] );
+      }
+    }
+    catch ( std::exception& err )
+    {
+      // We must create a new exception here, err's lifetime ends at
+      // the end of the catch block.
+      exceptions_raised.at( t ) =
+        lockPTR< WrappedThreadException >( new WrappedThreadException( err ) );
+    }
+  }
+
+  for ( thread t = 0; t < n_threads; ++t )
+  {
+    if ( exceptions_raised.at( t ).valid() )
+    {
+      throw WrappedThreadException( *( exceptions_raised.at( t ) ) );
+    }
+  }
+}
+
+DictionaryDatum
+NodeManager::get_status_columns( const std::vector< long >& gids,
+  const std::vector< Name >& keys )
+{
+  std::vector< Node* > nodes;
+  nodes.reserve( gids.size() );
+  for ( size_t i = 0; i < gids.size(); ++i )
+  {
+    if ( gids[ i ] <= 0 or static_cast< index >( gids[ i ] ) > size() )
+    {
+      throw UnknownNode( gids[ i ] );
+    }
+    if ( not is_local_gid( gids[ i ] ) )
+    {
+      throw LocalNodeExpected( gids[ i ] );
+    }
+    nodes.push_back( get_node( gids[ i ] ) );
+  }
+
+  // Properties of the Node base class are read directly. Nodes offer no
+  // access to single model properties, so for all other keys the full
+  // status dictionary of each node is built. Datums are allocated from
+  // pools which are not thread-safe, so this is done serially.
+  DictionaryDatum columns( new Dictionary );
+  std::vector< Name > model_keys;
+  long value;
+  for ( std::vector< Name >::const_iterator key = keys.begin();
+        key != keys.end();
+        ++key )
+  {
+    if ( nodes.empty()
+      or not get_integer_property_( *nodes[ 0 ], *key, value ) )
+    {
+      model_keys.push_back( *key );
+      continue;
+    }
+    std::vector< long >* col = new std::vector< long >( nodes.size() );
+    for ( size_t i = 0; i < nodes.size(); ++i )
+    {
+      get_integer_property_( *nodes[ i ], *key, ( *col )[ i ] );
+    }
+    ( *columns )[ *key ] = new IntVectorDatum( col );
+  }
+
+  if ( model_keys.empty() )
+  {
+    return columns;
+  }
+  if ( nodes.empty() )
+  {
+    for ( size_t k = 0; k < model_keys.size(); ++k )
+    {
+      ( *columns )[ model_keys[ k ] ] = new ArrayDatum();
+    }
+    return columns;
+  }
+
+  // The type of each column is given by the first node. Each dictionary
+  // is dropped before the next one is built, since keeping the
+  // dictionaries of all nodes is several times slower for large networks.
+  const size_t n = nodes.size();
+  std::vector< std::vector< double >* > double_cols( model_keys.size(), 0 );
+  std::vector< std::vector< long >* > int_cols( model_keys.size(), 0 );
+  std::vector< ArrayDatum > array_cols( model_keys.size() );
+  for ( size_t i = 0; i < n; ++i )
+  {
+    DictionaryDatum status = nodes[ i ]->get_status_base();
+    for ( size_t k = 0; k < model_keys.size(); ++k )
+    {
+      const Token& t = status->lookup2( model_keys[ k ] );
+      if ( i == 0 )
+      {
+        if ( dynamic_cast< DoubleDatum* >( t.datum() ) != 0 )
+        {
+          double_cols[ k ] = new std::vector< double >();
+          double_cols[ k ]->reserve( n );
+          ( *columns )[ model_keys[ k ] ] =
+            new DoubleVectorDatum( double_cols[ k ] );
+        }
+        else if ( dynamic_cast< IntegerDatum* >( t.datum() ) != 0 )
+        {
+          int_cols[ k ] = new std::vector< long >();
+          int_cols[ k ]->reserve( n );
+          ( *columns )[ model_keys[ k ] ] = new IntVectorDatum( int_cols[ k ] );
+        }
+        else
+        {
+          array_cols[ k ].reserve( n );
+        }
+      }
+
+      if ( double_cols[ k ] != 0 )
+      {
+        double_cols[ k ]->push_back( getValue< double >( t ) );
+      }
+      else if ( int_cols[ k ] != 0 )
+      {
+        int_cols[ k ]->push_back( getValue< long >( t ) );
+      }
+      else
+      {
+        array_cols[ k ].push_back( t );
+      }
+    }
+  }
+
+  for ( size_t k = 0; k < model_keys.size(); ++k )
+  {
+    if ( double_cols[ k ] == 0 and int_cols[ k ] == 0 )
+    {
+      ( *columns )[ model_keys[ k ] ] = array_cols[ k ];
+    }
+  }
+
+  return columns;
+}
+
 void
 NodeManager::get_status( DictionaryDatum& d )
 {
   def< long >( d, names::network_size, size() );
+  def< long >( d, names::ensemble_size, ensemble_size_ );
+  def< long >( d, names::ensemble_template_size, ensemble_template_size_ );
 
   std::map< long, size_t > sna_cts = local_nodes_.get_step_ctr();
   DictionaryDatum cdict( new Dictionary );
@@ -998,9 +1611,58 @@ NodeManager::get_status( DictionaryDatum& d )
   }
 }
 
+void
+NodeManager::get_memory_status( DictionaryDatum& d )
+{
+  const thread n_threads = kernel().vp_manager.get_num_threads();
+
+  // Node objects are counted by the capacity of the memory pools of
+  // their models, which includes space reserved for further nodes.
+  DictionaryDatum nodes( new Dictionary );
+  for ( index m = 0; m < kernel().model_manager.get_num_node_models(); ++m )
+  {
+    // models which have not been used yet own no memory
+    if ( not kernel().model_manager.is_model_materialized( m ) )
+    {
+      continue;
+    }
+    Model* const model = kernel().model_manager.get_model( m );
+    std::vector< long > bytes( n_threads, 0 );
+    bool has_nodes = false;
+    for ( thread t = 0; t < n_threads; ++t )
+    {
+      bytes[ t ] = model->mem_capacity( t ) * model->get_element_size();
+      has_nodes |= bytes[ t ] > 0;
+    }
+    if ( has_nodes )
+    {
+      def< std::vector< long > >( nodes, model->get_name(), bytes );
+    }
+  }
+  def< DictionaryDatum >( d, names::nodes, nodes );
+
+  // Devices do not archive spikes, so sibling containers are skipped.
+  std::vector< long > histories( n_threads, 0 );
+  for ( size_t n = 0; n < local_nodes_.size(); ++n )
+  {
+    const Archiving_Node* const node = dynamic_cast< const Archiving_Node* >(
+      local_nodes_.get_node_by_index( n ) );
+    if ( node != 0 )
+    {
+      histories[ node->get_thread() ] +=
+        node->get_history_size() * sizeof( histentry );
+    }
+  }
+  def< std::vector< long > >( d, names::spike_histories, histories );
+}
+
 void
 NodeManager::set_status( const DictionaryDatum& d )
 {
+  // kernel parameters such as the resolution or the random number
+  // generators may enter the calibration of any node
+  calibrate_all_nodes_ = true;
+
   std::string tmp;
   // proceed only if there are unaccessed items left
   if ( not d->all_accessed( tmp ) )
@@ -1038,6 +1700,7 @@ NodeManager::reset_nodes_state()
      container.  Subnets are not iterated, since their nodes are
      registered in nodes_ directly.
    */
+  calibrate_all_nodes_ = true;
   for ( size_t n = 0; n < local_nodes_.size(); ++n )
   {
     Node* node = local_nodes_.get_node_by_index( n );
@@ -58,6 +58,12 @@ public:
   virtual void set_status( const DictionaryDatum& );
   virtual void get_status( DictionaryDatum& );
 
+  /**
+   * Report bytes of node memory per model and of spike histories, each
+   * for every thread.
+   */
+  void get_memory_status( DictionaryDatum& );
+
   void reinit_nodes();
   /**
    * Get properties of a node. The specified node must exist.
@@ -74,6 +80,35 @@ public:
    */
   void set_status( index, const DictionaryDatum& );
 
+  /**
+   * Set one or more properties of many nodes from columns of values.
+   * Each entry of columns maps a property name to an IntVectorDatum,
+   * DoubleVectorDatum or homogeneous numeric array with one value per
+   * GID in gids. Keys are validated on the first local node of each
+   * model, the remaining nodes are updated in parallel by the threads
+   * owning them. Non-local nodes are skipped.
+   * @throws nest::UnknownNode         A GID does not exist in the network.
+   * @throws nest::DimensionMismatch   A column does not match gids in length.
+   * @throws TypeMismatch              A column is not a numeric array.
+   * @throws nest::UnaccessedDictionaryEntry  Model did not read a key.
+   */
+  void set_status_columns( const std::vector< long >& gids,
+    const DictionaryDatum& columns );
+
+  /**
+   * Get one or more properties of many nodes as columns of values.
+   * The result maps each key to an IntVectorDatum or DoubleVectorDatum
+   * if the property of the first node is an integer or double, and to
+   * an array otherwise. All nodes must be local. The GID, thread, virtual
+   * process and thread-local ID are read directly, all other properties
+   * from the status dictionary of each node, which is built serially.
+   * @throws nest::UnknownNode         A GID does not exist in the network.
+   * @throws nest::LocalNodeExpected   A GID belongs to a non-local node.
+   * @throws UndefinedName             A node does not have a property.
+   */
+  DictionaryDatum get_status_columns( const std::vector< long >& gids,
+    const std::vector< Name >& keys );
+
   /**
    * Add a number of nodes to the network.
    * This function creates n Node objects of Model m and adds them
@@ -99,6 +134,24 @@ public:
    */
   void restore_nodes( const ArrayDatum& );
 
+  /**
+   * Instantiate all nodes of the network n_instances - 1 more times.
+   *
+   * The nodes with GIDs 1 to N form the template, and the copy of node gid
+   * in instance k has GID gid + k * N. Each copy is given the status of its
+   * template node. Recording devices with a label get the instance
+   * appended to it, so that their output can be told apart. The network
+   * must not contain subnets, and the function can be called only once
+   * after ResetKernel, before the first simulation.
+   */
+  void replicate_nodes( size_t n_instances );
+
+  //! Number of instances created by replicate_nodes(), 1 otherwise
+  size_t get_ensemble_size() const;
+
+  //! Number of nodes in each instance, 0 if there is no ensemble
+  index get_ensemble_template_size() const;
+
   /**
    * Reset state of nodes.
    *
@@ -193,11 +246,30 @@ public:
 
   /**
    * Prepare nodes for simulation and register nodes in node_list.
-   * Calls prepare_node_() for each pertaining Node.
-   * @see prepare_node_()
+   * Calls prepare_node_() for each Node that has been modified since the
+   * last call, and for all run-dependent nodes. All nodes are prepared
+   * after changes to the kernel, the delay extrema or ResetNetwork.
+   * @see prepare_node_(), set_node_modified(), Node::is_run_dependent()
    */
   void prepare_nodes();
 
+  /**
+   * Mark node for calibration in the next call to prepare_nodes().
+   * Must be called whenever properties or connections of a node change.
+   * May be called in parallel for nodes on different threads; proxies are
+   * ignored.
+   */
+  void set_node_modified( Node& );
+
+  /**
+   * Mark node for calibration from thread tid, which may differ from the
+   * thread of the node, e.g. for the source of a connection created on the
+   * thread of its target. Nodes of other threads are only recorded for
+   * thread tid and marked in the next call to prepare_nodes(), so that no
+   * thread writes to the nodes or counters of another thread.
+   */
+  void set_node_modified( Node&, thread tid );
+
   /**
    * Get the number of nodes created by last prepare_nodes() call
    * @see prepare_nodes()
@@ -210,12 +282,12 @@ public:
   };
 
   /**
-   * Invoke post_run_cleanup() on all nodes.
+   * Invoke post_run_cleanup() on all run-dependent nodes.
    */
   void post_run_cleanup();
 
   /**
-   * Invoke finalize() on all nodes.
+   * Invoke finalize() on all run-dependent nodes.
    */
   void finalize_nodes();
 
@@ -305,11 +377,35 @@ private:
                      //!< use the waveform relaxation method
   bool wfr_is_used_; //!< there is at least one node that uses
                      //!< waveform relaxation
+  //! Nodelists for run-dependent nodes, see Node::is_run_dependent()
+  std::vector< std::vector< Node* > > run_dependent_nodes_vec_;
+  //! Number of uncalibrated nodes per thread
+  std::vector< size_t > num_modified_nodes_;
+  //! Nodes of other threads marked by each thread, indexed by GID
+  std::vector< std::vector< bool > > foreign_modified_nodes_;
+  //! All nodes need to be calibrated in the next prepare_nodes()
+  bool calibrate_all_nodes_;
+  delay prepared_min_delay_; //!< min_delay at last prepare_nodes()
+  delay prepared_max_delay_; //!< max_delay at last prepare_nodes()
   //! Network size when nodes_vec_ was last updated
   index nodes_vec_network_size_;
   size_t num_active_nodes_; //!< number of nodes created by prepare_nodes
+  size_t ensemble_size_;    //!< number of instances, see replicate_nodes()
+  index ensemble_template_size_; //!< number of nodes in each instance
 };
 
+inline size_t
+NodeManager::get_ensemble_size() const
+{
+  return ensemble_size_;
+}
+
+inline index
+NodeManager::get_ensemble_template_size() const
+{
+  return ensemble_template_size_;
+}
+
 inline index
 NodeManager::size() const
 {
@@ -0,0 +1,311 @@
+/*
+ *  perf_counters.cpp
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "perf_counters.h"
+
+// Generated includes:
+#include "config.h"
+
+// C includes:
+#include <string.h>
+#ifdef HAVE_LINUX_PERF_EVENT_H
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+// C++ includes:
+#include <cassert>
+
+// Includes from nestkernel:
+#include "nest_names.h"
+
+// Includes from sli:
+#include "arraydatum.h"
+#include "dictutils.h"
+
+namespace
+{
+
+#ifdef HAVE_LINUX_PERF_EVENT_H
+//! Type and config of perf_event_attr for each PerfCounters::Counter
+const uint32_t event_types[ nest::PerfCounters::NUM_COUNTERS ] = {
+  PERF_TYPE_HARDWARE,
+  PERF_TYPE_HARDWARE,
+  PERF_TYPE_HW_CACHE,
+  PERF_TYPE_HW_CACHE
+};
+
+const uint64_t event_configs[ nest::PerfCounters::NUM_COUNTERS ] = {
+  PERF_COUNT_HW_CPU_CYCLES,
+  PERF_COUNT_HW_INSTRUCTIONS,
+  PERF_COUNT_HW_CACHE_LL | ( PERF_COUNT_HW_CACHE_OP_READ << 8 )
+    | ( PERF_COUNT_HW_CACHE_RESULT_MISS << 16 ),
+  PERF_COUNT_HW_CACHE_DTLB | ( PERF_COUNT_HW_CACHE_OP_READ << 8 )
+    | ( PERF_COUNT_HW_CACHE_RESULT_MISS << 16 )
+};
+
+/**
+ * Open counter c for the calling thread on any CPU, as member of the group
+ * of group_fd or as a new group if group_fd is -1. Only user-space events
+ * are counted, which unprivileged processes may count with the default
+ * setting of perf_event_paranoid.
+ * @returns file descriptor, -1 on error
+ */
+int
+open_counter( nest::PerfCounters::Counter c, int group_fd )
+{
+  perf_event_attr attr;
+  memset( &attr, 0, sizeof( attr ) );
+  attr.size = sizeof( attr );
+  attr.type = event_types[ c ];
+  attr.config = event_configs[ c ];
+  attr.read_format = PERF_FORMAT_GROUP;
+  attr.exclude_kernel = 1;
+  attr.exclude_hv = 1;
+  return syscall( __NR_perf_event_open, &attr, 0, -1, group_fd, 0 );
+}
+#endif
+
+const Name&
+counter_name( nest::PerfCounters::Counter c )
+{
+  switch ( c )
+  {
+  case nest::PerfCounters::CYCLES:
+    return nest::names::cycles;
+  case nest::PerfCounters::INSTRUCTIONS:
+    return nest::names::instructions;
+  case nest::PerfCounters::LLC_MISSES:
+    return nest::names::llc_misses;
+  default:
+    return nest::names::dtlb_misses;
+  }
+}
+
+const Name&
+phase_name( nest::PerfCounters::Phase p )
+{
+  switch ( p )
+  {
+  case nest::PerfCounters::UPDATE:
+    return nest::names::update;
+  case nest::PerfCounters::DELIVER:
+    return nest::names::deliver;
+  default:
+    return nest::names::gather;
+  }
+}
+}
+
+nest::PerfCounters::ThreadCounters::ThreadCounters()
+  : leader( -1 )
+  , num_open( 0 )
+{
+  memset( fds, -1, sizeof( fds ) );
+  memset( counters, 0, sizeof( counters ) );
+  memset( start, 0, sizeof( start ) );
+  memset( totals, 0, sizeof( totals ) );
+  memset( opened, 0, sizeof( opened ) );
+}
+
+nest::PerfCounters::PerfCounters()
+  : threads_()
+{
+}
+
+nest::PerfCounters::~PerfCounters()
+{
+  for ( size_t t = 0; t < threads_.size(); ++t )
+  {
+    close( t );
+  }
+}
+
+bool
+nest::PerfCounters::is_supported()
+{
+#ifdef HAVE_LINUX_PERF_EVENT_H
+  for ( int c = 0; c < NUM_COUNTERS; ++c )
+  {
+    const int fd = open_counter( static_cast< Counter >( c ), -1 );
+    if ( fd >= 0 )
+    {
+      ::close( fd );
+      return true;
+    }
+  }
+#endif
+  return false;
+}
+
+void
+nest::PerfCounters::set_num_threads( thread num_threads )
+{
+  if ( threads_.size() == static_cast< size_t >( num_threads ) )
+  {
+    return;
+  }
+  for ( size_t t = 0; t < threads_.size(); ++t )
+  {
+    close( t );
+  }
+  threads_.assign( num_threads, ThreadCounters() );
+}
+
+void
+nest::PerfCounters::reset()
+{
+  for ( size_t t = 0; t < threads_.size(); ++t )
+  {
+    memset( threads_[ t ].totals, 0, sizeof( threads_[ t ].totals ) );
+    memset( threads_[ t ].opened, 0, sizeof( threads_[ t ].opened ) );
+    for ( size_t i = 0; i < threads_[ t ].num_open; ++i )
+    {
+      threads_[ t ].opened[ threads_[ t ].counters[ i ] ] = true;
+    }
+  }
+}
+
+void
+nest::PerfCounters::open( thread t )
+{
+  assert( static_cast< size_t >( t ) < threads_.size() );
+  close( t );
+
+#ifdef HAVE_LINUX_PERF_EVENT_H
+  ThreadCounters& tc = threads_[ t ];
+  for ( int c = 0; c < NUM_COUNTERS; ++c )
+  {
+    const int fd = open_counter( static_cast< Counter >( c ), tc.leader );
+    if ( fd < 0 )
+    {
+      continue; // not provided here, leave out
+    }
+    if ( tc.leader < 0 )
+    {
+      tc.leader = fd;
+    }
+    tc.fds[ tc.num_open ] = fd;
+    tc.counters[ tc.num_open ] = static_cast< Counter >( c );
+    tc.opened[ c ] = true;
+    ++tc.num_open;
+  }
+#endif
+}
+
+void
+nest::PerfCounters::close( thread t )
+{
+  ThreadCounters& tc = threads_[ t ];
+#ifdef HAVE_LINUX_PERF_EVENT_H
+  // close members before the leader
+  for ( size_t i = tc.num_open; i > 0; --i )
+  {
+    ::close( tc.fds[ i - 1 ] );
+  }
+#endif
+  memset( tc.fds, -1, sizeof( tc.fds ) );
+  tc.leader = -1;
+  tc.num_open = 0;
+}
+
+bool
+nest::PerfCounters::read_( ThreadCounters& tc, uint64_t* values ) const
+{
+#ifdef HAVE_LINUX_PERF_EVENT_H
+  // with PERF_FORMAT_GROUP, the leader returns the number of counters
+  // followed by the value of each counter in group order
+  uint64_t buffer[ 1 + NUM_COUNTERS ];
+  const ssize_t size = ( 1 + tc.num_open ) * sizeof( uint64_t );
+  if ( tc.leader < 0 or ::read( tc.leader, buffer, size ) != size
+    or buffer[ 0 ] != tc.num_open )
+  {
+    return false;
+  }
+  memcpy( values, buffer + 1, tc.num_open * sizeof( uint64_t ) );
+  return true;
+#else
+  return false;
+#endif
+}
+
+void
+nest::PerfCounters::start( thread t )
+{
+  ThreadCounters& tc = threads_[ t ];
+  if ( tc.num_open > 0 and not read_( tc, tc.start ) )
+  {
+    close( t ); // counters are unusable, count nothing from here on
+  }
+}
+
+void
+nest::PerfCounters::stop( thread t, Phase p )
+{
+  ThreadCounters& tc = threads_[ t ];
+  if ( tc.num_open == 0 )
+  {
+    return;
+  }
+
+  uint64_t values[ NUM_COUNTERS ];
+  if ( not read_( tc, values ) )
+  {
+    close( t );
+    return;
+  }
+  for ( size_t i = 0; i < tc.num_open; ++i )
+  {
+    tc.totals[ p ][ tc.counters[ i ] ] += values[ i ] - tc.start[ i ];
+  }
+}
+
+void
+nest::PerfCounters::get_status( DictionaryDatum& d ) const
+{
+  for ( int p = 0; p < NUM_PHASES; ++p )
+  {
+    DictionaryDatum phase( new Dictionary );
+    for ( int c = 0; c < NUM_COUNTERS; ++c )
+    {
+      bool opened = false;
+      std::vector< long >* values = new std::vector< long >();
+      values->reserve( threads_.size() );
+      for ( size_t t = 0; t < threads_.size(); ++t )
+      {
+        opened = opened or threads_[ t ].opened[ c ];
+        values->push_back( threads_[ t ].totals[ p ][ c ] );
+      }
+      if ( opened )
+      {
+        ( *phase )[ counter_name( static_cast< Counter >( c ) ) ] =
+          new IntVectorDatum( values );
+      }
+      else
+      {
+        delete values;
+      }
+    }
+    ( *d )[ phase_name( static_cast< Phase >( p ) ) ] = phase;
+  }
+}
@@ -0,0 +1,145 @@
+/*
+ *  perf_counters.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef PERF_COUNTERS_H
+#define PERF_COUNTERS_H
+
+// C includes:
+#include <stdint.h>
+
+// C++ includes:
+#include <vector>
+
+// Includes from nestkernel:
+#include "nest_types.h"
+
+// Includes from sli:
+#include "dictdatum.h"
+
+namespace nest
+{
+
+/**
+ * Hardware performance counters of the threads of the simulation loop,
+ * accumulated per phase of the loop.
+ *
+ * Each thread opens its own group of Linux perf_event_open(2) counters,
+ * which count user-space events of the calling thread only: cycles,
+ * instructions, last-level cache read misses and data TLB read misses.
+ * Counters the hardware or the kernel does not provide are left out, so
+ * that, e.g., in containers or virtual machines that forbid access to the
+ * performance monitoring unit, simulations run without counters. Values
+ * are not scaled if the kernel multiplexes the counters.
+ *
+ * Counting is started before and stopped after each phase by the thread
+ * executing the phase. The phases executed by the master thread only, such
+ * as gathering spikes, are counted for thread 0 only.
+ */
+class PerfCounters
+{
+public:
+  enum Phase
+  {
+    UPDATE = 0, //!< node updates
+    DELIVER,    //!< delivery of events to the targets
+    GATHER,     //!< collocation and communication of spikes
+    NUM_PHASES
+  };
+
+  enum Counter
+  {
+    CYCLES = 0,
+    INSTRUCTIONS,
+    LLC_MISSES,
+    DTLB_MISSES,
+    NUM_COUNTERS
+  };
+
+  PerfCounters();
+  ~PerfCounters();
+
+  /**
+   * Check whether the calling thread can open at least one counter.
+   * Always false on systems other than Linux.
+   */
+  static bool is_supported();
+
+  /**
+   * Set number of threads and clear accumulated values, if the number of
+   * threads differs from the present one.
+   */
+  void set_num_threads( thread num_threads );
+
+  //! Clear accumulated values
+  void reset();
+
+  /**
+   * Open the counters of the calling thread, which will be counted as
+   * thread t. Must be called by the thread that later calls start() and
+   * stop(), as the counters are bound to the calling thread.
+   */
+  void open( thread t );
+
+  //! Close the counters of thread t
+  void close( thread t );
+
+  //! Read the counters of thread t at the beginning of a phase
+  void start( thread t );
+
+  //! Read the counters of thread t and add the difference to phase p
+  void stop( thread t, Phase p );
+
+  /**
+   * Store accumulated values in d as a dictionary with one entry per phase,
+   * each a dictionary with an array of values per thread for each counter
+   * that could be opened.
+   */
+  void get_status( DictionaryDatum& d ) const;
+
+private:
+  /**
+   * Counters of a thread. Padded so that threads do not write to the same
+   * cache line.
+   */
+  struct ThreadCounters
+  {
+    ThreadCounters();
+
+    int leader;                         //!< group leader, -1 if closed
+    size_t num_open;                    //!< number of counters in the group
+    int fds[ NUM_COUNTERS ];            //!< file descriptors in group order
+    Counter counters[ NUM_COUNTERS ];   //!< counter at each group position
+    uint64_t start[ NUM_COUNTERS ];     //!< values at start of phase
+    uint64_t totals[ NUM_PHASES ][ NUM_COUNTERS ];
+    bool opened[ NUM_COUNTERS ];        //!< counter was ever opened
+    char padding[ 64 ];
+  };
+
+  //! Read current counter values in group order, returns false on error
+  bool read_( ThreadCounters& tc, uint64_t* values ) const;
+
+  std::vector< ThreadCounters > threads_;
+};
+
+} // namespace nest
+
+#endif /* PERF_COUNTERS_H */
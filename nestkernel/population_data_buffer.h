@@ -0,0 +1,213 @@
+/*
+ *  population_data_buffer.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef POPULATION_DATA_BUFFER_H
+#define POPULATION_DATA_BUFFER_H
+
+// C++ includes:
+#include <algorithm>
+#include <cassert>
+#include <limits>
+#include <vector>
+
+// Includes from nestkernel:
+#include "nest_types.h"
+
+namespace nest
+{
+
+/**
+ * Contiguous buffer for analog data sampled from a population of nodes.
+ *
+ * The data is stored as a matrix with one row per sampling time. Each row
+ * contains one column per recorded node, and each column one entry per
+ * recorded variable, i.e., the layout is time x node x variable. Nodes
+ * write their column directly through their UniversalDataLogger, so that
+ * no DataLoggingRequest and DataLoggingReply events are required.
+ *
+ * A buffer belongs to a single thread and is only written by nodes updated
+ * on that thread. Rows are added as nodes write data for new sampling
+ * times. Entries not written by a node, e.g., because the node was frozen,
+ * are NaN.
+ *
+ * @see UniversalDataLogger, PopulationMultimeter
+ */
+class PopulationDataBuffer
+{
+public:
+  PopulationDataBuffer();
+
+  /**
+   * Set the number of columns and variables and the recording window.
+   * If columns are added after data has been recorded, the existing rows
+   * are rearranged and the new columns are filled with NaN.
+   * @param n_columns number of nodes recorded from
+   * @param n_vars number of variables per node
+   * @param interval sampling interval in steps
+   * @param t_min data is recorded for time stamps t_min < t <= t_max
+   * @param t_max see t_min
+   */
+  void configure( size_t n_columns,
+    size_t n_vars,
+    long interval,
+    long t_min,
+    long t_max );
+
+  /**
+   * Return pointer to the first variable of a column for the given time
+   * stamp in steps, or 0 if the time stamp is outside the recording
+   * window. The pointer is valid until the next call to get_entry().
+   */
+  double* get_entry( long stamp, size_t column );
+
+  //! Remove all recorded data.
+  void clear();
+
+  size_t
+  get_num_rows() const
+  {
+    return n_rows_;
+  }
+
+  size_t
+  get_num_columns() const
+  {
+    return n_columns_;
+  }
+
+  size_t
+  get_num_vars() const
+  {
+    return n_vars_;
+  }
+
+  /**
+   * Return time stamp of the first row in steps.
+   * Only valid if the buffer contains data.
+   */
+  long
+  get_first_stamp() const
+  {
+    return first_stamp_;
+  }
+
+  //! Return entries of given row, n_columns x n_vars values.
+  const double*
+  get_row( size_t row ) const
+  {
+    assert( row < n_rows_ );
+    return &data_[ row * n_columns_ * n_vars_ ];
+  }
+
+private:
+  std::vector< double > data_; //!< recorded data, time x node x variable
+  size_t n_columns_;
+  size_t n_vars_;
+  size_t n_rows_;
+  long interval_;
+  long first_stamp_; //!< time stamp of first row
+  long t_min_;
+  long t_max_;
+};
+
+inline PopulationDataBuffer::PopulationDataBuffer()
+  : data_()
+  , n_columns_( 0 )
+  , n_vars_( 0 )
+  , n_rows_( 0 )
+  , interval_( 1 )
+  , first_stamp_( 0 )
+  , t_min_( 0 )
+  , t_max_( 0 )
+{
+}
+
+inline void
+PopulationDataBuffer::configure( const size_t n_columns,
+  const size_t n_vars,
+  const long interval,
+  const long t_min,
+  const long t_max )
+{
+  assert( interval > 0 );
+  assert( n_rows_ == 0 || ( n_vars == n_vars_ && interval == interval_ ) );
+
+  if ( n_rows_ > 0 && n_columns != n_columns_ )
+  {
+    assert( n_columns > n_columns_ );
+    std::vector< double > data( n_rows_ * n_columns * n_vars,
+      std::numeric_limits< double >::quiet_NaN() );
+    for ( size_t r = 0; r < n_rows_; ++r )
+    {
+      std::copy( data_.begin() + r * n_columns_ * n_vars_,
+        data_.begin() + ( r + 1 ) * n_columns_ * n_vars_,
+        data.begin() + r * n_columns * n_vars );
+    }
+    data_.swap( data );
+  }
+
+  n_columns_ = n_columns;
+  n_vars_ = n_vars;
+  interval_ = interval;
+  t_min_ = t_min;
+  t_max_ = t_max;
+}
+
+inline double*
+PopulationDataBuffer::get_entry( const long stamp, const size_t column )
+{
+  assert( column < n_columns_ );
+
+  if ( stamp <= t_min_ || stamp > t_max_ )
+  {
+    return 0;
+  }
+
+  // Nodes on a thread are updated one after the other for an entire time
+  // slice, so the first stamp written is the earliest of all nodes.
+  if ( n_rows_ == 0 )
+  {
+    first_stamp_ = stamp;
+  }
+  assert( stamp >= first_stamp_ );
+
+  const size_t row = ( stamp - first_stamp_ ) / interval_;
+  if ( row >= n_rows_ )
+  {
+    n_rows_ = row + 1;
+    data_.resize( n_rows_ * n_columns_ * n_vars_,
+      std::numeric_limits< double >::quiet_NaN() );
+  }
+
+  return &data_[ ( row * n_columns_ + column ) * n_vars_ ];
+}
+
+inline void
+PopulationDataBuffer::clear()
+{
+  data_.clear();
+  n_rows_ = 0;
+}
+
+} // namespace nest
+
+#endif // POPULATION_DATA_BUFFER_H
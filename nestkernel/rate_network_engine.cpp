@@ -0,0 +1,410 @@
+/*
+ *  rate_network_engine.cpp
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "rate_network_engine.h"
+
+// C++ includes:
+#include <algorithm>
+
+// Includes from libnestutil:
+#include "logging.h"
+
+// Includes from nestkernel:
+#include "event.h"
+#include "exceptions.h"
+#include "kernel_manager.h"
+#include "node.h"
+
+namespace nest
+{
+
+namespace
+{
+
+/**
+ * Connection of the matrix, as found by the probe events.
+ */
+struct RateConnection
+{
+  index target_lid;
+  index source;
+  double weight;
+  long delay;
+
+  bool operator<( const RateConnection& rhs ) const
+  {
+    return target_lid < rhs.target_lid
+      || ( target_lid == rhs.target_lid && source < rhs.source );
+  }
+};
+
+/**
+ * Rate events that record the connections they are sent through instead
+ * of being handled by the receiver.
+ */
+template < typename EventT >
+class RateProbe : public EventT
+{
+public:
+  RateProbe( std::vector< RateConnection >& conns, bool& eligible )
+    : conns_( conns )
+    , eligible_( eligible )
+  {
+  }
+
+  void operator()();
+
+private:
+  std::vector< RateConnection >& conns_;
+  bool& eligible_;
+};
+
+template < typename EventT >
+void RateProbe< EventT >::operator()()
+{
+  Node& target = this->get_receiver();
+  if ( not target.supports_rate_engine() )
+  {
+    eligible_ = false;
+    return;
+  }
+
+  RateConnection c;
+  c.target_lid = target.get_thread_lid();
+  c.source = this->get_sender_gid();
+  c.weight = this->get_weight();
+  c.delay = this->get_delay();
+  conns_.push_back( c );
+}
+
+} // namespace
+
+template < typename EntryT >
+void
+RateNetworkEngine::Matrix_< EntryT >::clear()
+{
+  std::vector< size_t >().swap( row_begin_ );
+  std::vector< EntryT >().swap( entries_ );
+}
+
+RateNetworkEngine::RateNetworkEngine()
+  : active_( false )
+  , history_length_( 0 )
+  , min_delay_( 0 )
+  , slot_()
+  , sources_()
+  , delayed_()
+  , instantaneous_()
+  , history_()
+  , read_( 0 )
+{
+}
+
+void
+RateNetworkEngine::reset()
+{
+  active_ = false;
+  history_length_ = 0;
+  min_delay_ = 0;
+  std::vector< index >().swap( slot_ );
+  std::vector< index >().swap( sources_ );
+  std::vector< Matrix_< DelayedEntry_ > >().swap( delayed_ );
+  std::vector< Matrix_< InstantaneousEntry_ > >().swap( instantaneous_ );
+  std::vector< double >().swap( history_ );
+  std::vector< double >().swap( instant_[ 0 ] );
+  std::vector< double >().swap( instant_[ 1 ] );
+  read_ = 0;
+}
+
+void
+RateNetworkEngine::prepare( const bool enabled )
+{
+  const bool simulated = kernel().simulation_manager.has_been_simulated();
+  if ( not enabled or ( simulated and not active_ ) )
+  {
+    // Rates in transit are held by the receiving nodes.
+    return;
+  }
+
+  if ( kernel().mpi_manager.get_num_processes() > 1 )
+  {
+    deactivate( "the simulation runs on more than one MPI process" );
+    return;
+  }
+
+  const thread n_threads = kernel().vp_manager.get_num_threads();
+  delayed_.resize( n_threads );
+  instantaneous_.resize( n_threads );
+  std::vector< std::string > reasons( n_threads );
+  std::vector< std::vector< index > > thread_sources( n_threads );
+  std::vector< bool > thread_eligible( n_threads, true );
+#pragma omp parallel
+  {
+    const thread t = kernel().vp_manager.get_thread_id();
+    thread_eligible[ t ] = assemble_( t, reasons[ t ], thread_sources[ t ] );
+  }
+
+  std::vector< index > sources;
+  for ( thread t = 0; t < n_threads; ++t )
+  {
+    if ( not thread_eligible[ t ] )
+    {
+      deactivate( reasons[ t ] );
+      return;
+    }
+    sources.insert(
+      sources.end(), thread_sources[ t ].begin(), thread_sources[ t ].end() );
+  }
+  std::sort( sources.begin(), sources.end() );
+  sources.erase( std::unique( sources.begin(), sources.end() ), sources.end() );
+
+  if ( sources.empty() and not active_ )
+  {
+    // there is nothing to deliver, e.g., in networks of spiking neurons
+    reset();
+    return;
+  }
+
+  configure_buffers_( sources );
+#pragma omp parallel
+  {
+    map_sources_( kernel().vp_manager.get_thread_id() );
+  }
+  active_ = true;
+}
+
+void
+RateNetworkEngine::deactivate( const std::string& reason )
+{
+  if ( active_ and kernel().simulation_manager.has_been_simulated() )
+  {
+    throw KernelException(
+      "The rate network engine cannot be deactivated after the simulation "
+      "has started, but "
+      + reason
+      + ". Please call ResetKernel and disable use_rate_engine." );
+  }
+  reset();
+  LOG( M_INFO,
+    "RateNetworkEngine::deactivate",
+    "Rate connections are delivered as events, since " + reason + "." );
+}
+
+bool
+RateNetworkEngine::assemble_( const thread t,
+  std::string& reason,
+  std::vector< index >& sources )
+{
+  const std::vector< Node* >& nodes =
+    kernel().node_manager.get_nodes_on_thread( t );
+
+  // frozen nodes do not store their rates
+  for ( std::vector< Node* >::const_iterator n = nodes.begin();
+        n != nodes.end();
+        ++n )
+  {
+    if ( ( *n )->supports_rate_engine() and ( *n )->is_frozen() )
+    {
+      reason = "a rate neuron is frozen";
+      delayed_[ t ].clear();
+      instantaneous_[ t ].clear();
+      return false;
+    }
+  }
+
+  std::vector< RateConnection > delayed;
+  std::vector< RateConnection > instantaneous;
+  bool eligible = true;
+  RateProbe< DelayedRateConnectionEvent > dprobe( delayed, eligible );
+  RateProbe< InstantaneousRateConnectionEvent > iprobe(
+    instantaneous, eligible );
+
+  // the probes only pass through connections of the rate synapse types
+  std::vector< index > secondary_sources;
+  kernel().connection_manager.get_secondary_sources( t, secondary_sources );
+  sources.clear();
+  for ( std::vector< index >::const_iterator sgid = secondary_sources.begin();
+        sgid != secondary_sources.end() and eligible;
+        ++sgid )
+  {
+    const size_t n_found = delayed.size() + instantaneous.size();
+
+    dprobe.set_sender_gid( *sgid );
+    kernel().connection_manager.send_secondary( t, dprobe );
+    iprobe.set_sender_gid( *sgid );
+    kernel().connection_manager.send_secondary( t, iprobe );
+
+    // the probes clear eligible for targets that do not support the engine
+    if ( delayed.size() + instantaneous.size() > n_found )
+    {
+      const Node* source = kernel().node_manager.get_node( *sgid, t );
+      eligible = eligible and source->supports_rate_engine();
+      sources.push_back( *sgid );
+    }
+  }
+
+  if ( not eligible )
+  {
+    reason =
+      "there are rate connections from or to nodes that do not support it";
+    delayed_[ t ].clear();
+    instantaneous_[ t ].clear();
+    return false;
+  }
+
+  std::sort( delayed.begin(), delayed.end() );
+  std::sort( instantaneous.begin(), instantaneous.end() );
+
+  Matrix_< DelayedEntry_ >& dm = delayed_[ t ];
+  dm.row_begin_.assign( nodes.size() + 1, 0 );
+  dm.entries_.resize( delayed.size() );
+  for ( size_t k = 0; k < delayed.size(); ++k )
+  {
+    ++dm.row_begin_[ delayed[ k ].target_lid + 1 ];
+    dm.entries_[ k ].source_ = delayed[ k ].source;
+    dm.entries_[ k ].weight_ = delayed[ k ].weight;
+    dm.entries_[ k ].delay_ = delayed[ k ].delay;
+  }
+
+  Matrix_< InstantaneousEntry_ >& im = instantaneous_[ t ];
+  im.row_begin_.assign( nodes.size() + 1, 0 );
+  im.entries_.resize( instantaneous.size() );
+  for ( size_t k = 0; k < instantaneous.size(); ++k )
+  {
+    ++im.row_begin_[ instantaneous[ k ].target_lid + 1 ];
+    im.entries_[ k ].source_ = instantaneous[ k ].source;
+    im.entries_[ k ].weight_ = instantaneous[ k ].weight;
+  }
+
+  for ( size_t i = 0; i < nodes.size(); ++i )
+  {
+    dm.row_begin_[ i + 1 ] += dm.row_begin_[ i ];
+    im.row_begin_[ i + 1 ] += im.row_begin_[ i ];
+  }
+
+  return true;
+}
+
+void
+RateNetworkEngine::map_sources_( const thread t )
+{
+  std::vector< DelayedEntry_ >& d = delayed_[ t ].entries_;
+  for ( size_t k = 0; k < d.size(); ++k )
+  {
+    d[ k ].source_ = slot_[ d[ k ].source_ ];
+  }
+  std::vector< InstantaneousEntry_ >& i = instantaneous_[ t ].entries_;
+  for ( size_t k = 0; k < i.size(); ++k )
+  {
+    i[ k ].source_ = slot_[ i[ k ].source_ ];
+  }
+}
+
+void
+RateNetworkEngine::configure_buffers_( const std::vector< index >& sources )
+{
+  const long min_delay = kernel().connection_manager.get_min_delay();
+  const long history_length =
+    kernel().connection_manager.get_max_delay() + 2 * min_delay;
+  const long now = kernel().simulation_manager.get_clock().get_steps()
+    + kernel().simulation_manager.get_from_step();
+  const long n_keep = std::min( history_length, history_length_ );
+  // min_delay can only change before the first simulation
+  const bool keep_instant = min_delay == min_delay_;
+
+  std::vector< index > slot( kernel().node_manager.size(), invalid_index );
+  std::vector< double > history( sources.size() * history_length, 0.0 );
+  std::vector< double > instant[ 2 ];
+  instant[ 0 ].assign( sources.size() * min_delay, 0.0 );
+  instant[ 1 ].assign( sources.size() * min_delay, 0.0 );
+
+  for ( index s = 0; s < sources.size(); ++s )
+  {
+    const index gid = sources[ s ];
+    slot[ gid ] = s;
+
+    // keep the rates in transit of sources that had a slot before
+    const index old = gid < slot_.size() ? slot_[ gid ] : invalid_index;
+    if ( old == invalid_index )
+    {
+      continue;
+    }
+    for ( long step = now - n_keep; step < now; ++step )
+    {
+      long pos = step % history_length;
+      if ( pos < 0 )
+      {
+        pos += history_length;
+      }
+      history[ s * history_length + pos ] =
+        history_[ old * history_length_ + history_pos_( step ) ];
+    }
+    if ( keep_instant )
+    {
+      for ( size_t b = 0; b < 2; ++b )
+      {
+        std::copy( instant_[ b ].begin() + old * min_delay,
+          instant_[ b ].begin() + ( old + 1 ) * min_delay,
+          instant[ b ].begin() + s * min_delay );
+      }
+    }
+  }
+
+  slot_.swap( slot );
+  sources_ = sources;
+  history_.swap( history );
+  instant_[ 0 ].swap( instant[ 0 ] );
+  instant_[ 1 ].swap( instant[ 1 ] );
+  history_length_ = history_length;
+  min_delay_ = min_delay;
+}
+
+void
+RateNetworkEngine::clear_buffers()
+{
+  std::fill( history_.begin(), history_.end(), 0.0 );
+  std::fill( instant_[ 0 ].begin(), instant_[ 0 ].end(), 0.0 );
+  std::fill( instant_[ 1 ].begin(), instant_[ 1 ].end(), 0.0 );
+}
+
+size_t
+RateNetworkEngine::get_num_connections() const
+{
+  size_t n = 0;
+  for ( size_t t = 0; t < delayed_.size(); ++t )
+  {
+    n += delayed_[ t ].entries_.size() + instantaneous_[ t ].entries_.size();
+  }
+  return n;
+}
+
+void
+RateNetworkEngine::swap_buffers()
+{
+  read_ = 1 - read_;
+
+  // If a slice is updated in several parts, rates are stored for some
+  // lags only. The others must not contain rates of an earlier pass.
+  std::fill( instant_[ 1 - read_ ].begin(), instant_[ 1 - read_ ].end(), 0.0 );
+}
+
+} // namespace nest
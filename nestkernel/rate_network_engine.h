@@ -0,0 +1,360 @@
+/*
+ *  rate_network_engine.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef RATE_NETWORK_ENGINE_H
+#define RATE_NETWORK_ENGINE_H
+
+// C++ includes:
+#include <cassert>
+#include <string>
+#include <vector>
+
+// Includes from nestkernel:
+#include "nest_time.h"
+#include "nest_types.h"
+
+namespace nest
+{
+
+/**
+ * Identity input function, used by rate neurons with linear summation
+ * of their inputs.
+ */
+struct RateIdentityInput
+{
+  double
+  operator()( const double x ) const
+  {
+    return x;
+  }
+};
+
+/**
+ * Input function applied to each input before summation, used by rate
+ * neurons with nonlinear summation of their inputs.
+ */
+template < class TNonlinearities >
+class RateNonlinearInput
+{
+public:
+  explicit RateNonlinearInput( TNonlinearities& nl )
+    : nl_( nl )
+  {
+  }
+
+  double
+  operator()( const double x ) const
+  {
+    return nl_.input( x );
+  }
+
+private:
+  TNonlinearities& nl_;
+};
+
+/**
+ * Delivery of rate connections by sparse matrix-vector products.
+ *
+ * Rate neurons usually send their rates of each slice as a
+ * DelayedRateConnectionEvent and an InstantaneousRateConnectionEvent,
+ * which are serialized into the secondary event buffers and delivered to
+ * each connection. For networks in which all rate connections are between
+ * nodes that support the engine (see Node::supports_rate_engine()), the
+ * engine instead assembles the connections into one matrix in compressed
+ * sparse row format per thread and per connection type, with one row per
+ * thread-local node. Only sources with secondary connections in the
+ * connection tables are visited to find the rate connections. Nodes store
+ * their rates in a global history and pull their input as the product of
+ * their row with the history.
+ *
+ * The history has one slot per source of rate connections and keeps its
+ * rates for the last max_delay + 2 min_delay steps. Delayed input at time
+ * t is the sum of w * rate(t - d) over all delayed connections. Since
+ * d >= min_delay, the input of a slice only depends on rates of previous
+ * slices. Instantaneous rates are double buffered: nodes read the rates
+ * stored in the previous pass and write to the other buffer. The buffers
+ * are swapped whenever secondary events would be exchanged, i.e., after
+ * each iteration of the waveform relaxation and at the end of each slice,
+ * so that the semantics of the event based delivery are preserved. Only
+ * the order of summation differs.
+ *
+ * The engine is only used if enabled by the kernel property
+ * use_rate_engine, if the simulation runs on a single MPI process and if
+ * there are rate connections. Frozen rate neurons do not store their
+ * rates, and with waveform relaxation, the event based delivery depends on
+ * how a simulation is split at times that are not multiples of min_delay.
+ * The engine is turned off if either occurs before the first simulation.
+ * It is set up at the first call to Prepare and cannot be deactivated once
+ * the simulation has started, since the history then holds the rates in
+ * transit. The matrices are
+ * assembled anew at each Prepare, so that connections and weights may
+ * change between calls to Simulate.
+ *
+ * @see EventDeliveryManager, rate_neuron_ipn, rate_neuron_opn
+ */
+class RateNetworkEngine
+{
+public:
+  RateNetworkEngine();
+
+  /**
+   * Release all matrices and buffers and deactivate the engine.
+   */
+  void reset();
+
+  /**
+   * Assemble the connection matrices and set up the buffers if the engine
+   * is enabled and the network is eligible. Must be called from a serial
+   * context after thread-local ids and delay extrema have been updated.
+   * @throws KernelException if the engine was active but the network is
+   * no longer eligible.
+   */
+  void prepare( bool enabled );
+
+  /**
+   * Deliver rate connections as events instead, since reason.
+   * @throws KernelException if the simulation has started with the engine.
+   */
+  void deactivate( const std::string& reason );
+
+  /**
+   * Set all stored rates to zero, as for ResetNetwork.
+   */
+  void clear_buffers();
+
+  bool
+  is_active() const
+  {
+    return active_;
+  }
+
+  //! Number of connections handled by the engine on all threads.
+  size_t get_num_connections() const;
+
+  /**
+   * Add the delayed and instantaneous input of the given node for lags
+   * from to to-1 of the slice starting at origin to ex and in. Inputs
+   * through connections with non-negative weight are added to ex, the
+   * others to in. The input function is applied to each rate before it is
+   * multiplied by the weight.
+   */
+  template < typename TInput >
+  void add_input( thread t,
+    index lid,
+    const Time& origin,
+    long from,
+    long to,
+    const TInput& input,
+    std::vector< double >& ex,
+    std::vector< double >& in ) const;
+
+  /**
+   * Store rates for lags from to to-1 of the slice starting at origin to
+   * the history. Must only be called in the final update of a slice.
+   */
+  void store_delayed_rates( index gid,
+    const Time& origin,
+    long from,
+    long to,
+    const std::vector< double >& rates );
+
+  /**
+   * Store rates for lags from to to-1 to be read as instantaneous input
+   * in the next pass.
+   */
+  void store_instantaneous_rates( index gid,
+    long from,
+    long to,
+    const std::vector< double >& rates );
+
+  /**
+   * Make the instantaneous rates of the current pass available to the
+   * next pass. Must be called from a serial context where secondary events
+   * are gathered.
+   */
+  void swap_buffers();
+
+private:
+  struct DelayedEntry_
+  {
+    index source_; //!< slot of the source in history_
+    double weight_;
+    long delay_;
+  };
+
+  struct InstantaneousEntry_
+  {
+    index source_; //!< slot of the source in history_
+    double weight_;
+  };
+
+  /**
+   * Connection matrix of one thread in compressed sparse row format.
+   * The entries of row i are entries_[ row_begin_[ i ] ] to
+   * entries_[ row_begin_[ i + 1 ] - 1 ], ordered by source.
+   */
+  template < typename EntryT >
+  struct Matrix_
+  {
+    std::vector< size_t > row_begin_;
+    std::vector< EntryT > entries_;
+
+    void clear();
+  };
+
+  /**
+   * Assemble the matrices of thread t, with gids as sources, and store
+   * the sources of the rate connections found in sources.
+   * @returns false and sets reason if the network is not eligible.
+   */
+  bool assemble_( thread t,
+    std::string& reason,
+    std::vector< index >& sources );
+
+  /**
+   * Set up history and buffers for the given sources in increasing order
+   * and keep the rates of sources that had a slot before.
+   */
+  void configure_buffers_( const std::vector< index >& sources );
+
+  //! Replace the gids in the matrices of thread t by slots.
+  void map_sources_( thread t );
+
+  long
+  history_pos_( long step ) const
+  {
+    const long pos = step % history_length_;
+    return pos < 0 ? pos + history_length_ : pos;
+  }
+
+  bool active_;
+  long history_length_; //!< max_delay + 2 min_delay
+  long min_delay_;
+
+  //! slot of each gid, invalid_index for nodes that send no rates
+  std::vector< index > slot_;
+
+  //! gid of each slot, in increasing order
+  std::vector< index > sources_;
+
+  std::vector< Matrix_< DelayedEntry_ > > delayed_;             //!< per thread
+  std::vector< Matrix_< InstantaneousEntry_ > > instantaneous_; //!< per thread
+
+  //! rates of all sources, sources_.size() x history_length_
+  std::vector< double > history_;
+
+  //! instantaneous rates of all sources, 2 x sources_.size() x min_delay_
+  std::vector< double > instant_[ 2 ];
+  size_t read_; //!< index of instantaneous buffer read in current pass
+};
+
+template < typename TInput >
+inline void
+RateNetworkEngine::add_input( const thread t,
+  const index lid,
+  const Time& origin,
+  const long from,
+  const long to,
+  const TInput& input,
+  std::vector< double >& ex,
+  std::vector< double >& in ) const
+{
+  assert( active_ );
+
+  const Matrix_< DelayedEntry_ >& dm = delayed_[ t ];
+  for ( size_t k = dm.row_begin_[ lid ]; k < dm.row_begin_[ lid + 1 ]; ++k )
+  {
+    const DelayedEntry_& e = dm.entries_[ k ];
+    double* const target = e.weight_ >= 0.0 ? &ex[ 0 ] : &in[ 0 ];
+    const double* const h = &history_[ e.source_ * history_length_ ];
+    long pos = history_pos_( origin.get_steps() + from - e.delay_ );
+    for ( long lag = from; lag < to; ++lag )
+    {
+      target[ lag ] += e.weight_ * input( h[ pos ] );
+      if ( ++pos == history_length_ )
+      {
+        pos = 0;
+      }
+    }
+  }
+
+  const Matrix_< InstantaneousEntry_ >& im = instantaneous_[ t ];
+  const std::vector< double >& rates = instant_[ read_ ];
+  for ( size_t k = im.row_begin_[ lid ]; k < im.row_begin_[ lid + 1 ]; ++k )
+  {
+    const InstantaneousEntry_& e = im.entries_[ k ];
+    double* const target = e.weight_ >= 0.0 ? &ex[ 0 ] : &in[ 0 ];
+    const double* const r = &rates[ e.source_ * min_delay_ ];
+    for ( long lag = from; lag < to; ++lag )
+    {
+      target[ lag ] += e.weight_ * input( r[ lag ] );
+    }
+  }
+}
+
+inline void
+RateNetworkEngine::store_delayed_rates( const index gid,
+  const Time& origin,
+  const long from,
+  const long to,
+  const std::vector< double >& rates )
+{
+  assert( gid < slot_.size() );
+  const index slot = slot_[ gid ];
+  if ( slot == invalid_index )
+  {
+    return;
+  }
+  double* const h = &history_[ slot * history_length_ ];
+  long pos = history_pos_( origin.get_steps() + from );
+  for ( long lag = from; lag < to; ++lag )
+  {
+    h[ pos ] = rates[ lag ];
+    if ( ++pos == history_length_ )
+    {
+      pos = 0;
+    }
+  }
+}
+
+inline void
+RateNetworkEngine::store_instantaneous_rates( const index gid,
+  const long from,
+  const long to,
+  const std::vector< double >& rates )
+{
+  assert( gid < slot_.size() );
+  const index slot = slot_[ gid ];
+  if ( slot == invalid_index )
+  {
+    return;
+  }
+  double* const r = &instant_[ 1 - read_ ][ slot * min_delay_ ];
+  for ( long lag = from; lag < to; ++lag )
+  {
+    r[ lag ] = rates[ lag ];
+  }
+}
+
+} // namespace nest
+
+#endif /* #ifndef RATE_NETWORK_ENGINE_H */
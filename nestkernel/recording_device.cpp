@@ -23,6 +23,7 @@
 #include "recording_device.h"
 
 // C++ includes:
+#include <cstring>
 #include <iomanip>
 #include <iostream> // using cerr for error message.
 
@@ -60,6 +61,7 @@ nest::RecordingDevice::Parameters_::Parameters_( const std::string& file_ext,
   , to_screen_( false )
   , to_memory_( true )
   , to_accumulator_( false )
+  , to_shm_( false )
   , time_in_steps_( false )
   , precise_times_( false )
   , withgid_( withgid )
@@ -77,6 +79,8 @@ nest::RecordingDevice::Parameters_::Parameters_( const std::string& file_ext,
   , label_()
   , file_ext_( file_ext )
   , filename_()
+  , shm_buffer_size_( 1 << 20 )
+  , shm_name_()
   , close_after_simulate_( false )
   , flush_after_simulate_( true )
   , flush_records_( false )
@@ -126,6 +130,7 @@ nest::RecordingDevice::Parameters_::get( const RecordingDevice& rd,
   ( *d )[ names::to_screen ] = to_screen_;
   ( *d )[ names::to_memory ] = to_memory_;
   ( *d )[ names::to_file ] = to_file_;
+  ( *d )[ names::to_shm ] = to_shm_;
   if ( rd.mode_ == RecordingDevice::MULTIMETER )
   {
     ( *d )[ names::to_accumulator ] = to_accumulator_;
@@ -143,6 +148,10 @@ nest::RecordingDevice::Parameters_::get( const RecordingDevice& rd,
   {
     ad.push_back( LiteralDatum( names::screen ) );
   }
+  if ( to_shm_ )
+  {
+    ad.push_back( LiteralDatum( names::shm ) );
+  }
   if ( rd.mode_ == RecordingDevice::MULTIMETER )
   {
     if ( to_accumulator_ )
@@ -158,6 +167,7 @@ nest::RecordingDevice::Parameters_::get( const RecordingDevice& rd,
 
   ( *d )[ names::binary ] = binary_;
   ( *d )[ names::fbuffer_size ] = fbuffer_size_;
+  ( *d )[ names::shm_buffer_size ] = shm_buffer_size_;
 
   ( *d )[ names::close_after_simulate ] = close_after_simulate_;
   ( *d )[ names::flush_after_simulate ] = flush_after_simulate_;
@@ -171,6 +181,12 @@ nest::RecordingDevice::Parameters_::get( const RecordingDevice& rd,
     initialize_property_array( d, names::filenames );
     append_property( d, names::filenames, filename_ );
   }
+
+  if ( to_shm_ && not shm_name_.empty() )
+  {
+    initialize_property_array( d, names::shm_names );
+    append_property( d, names::shm_names, shm_name_ );
+  }
 }
 
 void
@@ -223,6 +239,16 @@ nest::RecordingDevice::Parameters_::set( const RecordingDevice& rd,
     fbuffer_size_ = fbuffer_size;
   }
 
+  long shm_buffer_size = shm_buffer_size_;
+  if ( updateValue< long >( d, names::shm_buffer_size, shm_buffer_size ) )
+  {
+    if ( shm_buffer_size < 64 )
+    {
+      throw BadProperty( "shm_buffer_size must be >= 64." );
+    }
+    shm_buffer_size_ = shm_buffer_size;
+  }
+
   updateValue< bool >( d, names::close_after_simulate, close_after_simulate_ );
   updateValue< bool >( d, names::flush_after_simulate, flush_after_simulate_ );
   updateValue< bool >( d, names::flush_records, flush_records_ );
@@ -241,6 +267,7 @@ nest::RecordingDevice::Parameters_::set( const RecordingDevice& rd,
   rec_change =
     updateValue< bool >( d, names::to_memory, to_memory_ ) || rec_change;
   rec_change = updateValue< bool >( d, names::to_file, to_file_ ) || rec_change;
+  rec_change = updateValue< bool >( d, names::to_shm, to_shm_ ) || rec_change;
   if ( rd.mode_ == RecordingDevice::MULTIMETER )
   {
     rec_change = updateValue< bool >(
@@ -251,7 +278,7 @@ nest::RecordingDevice::Parameters_::set( const RecordingDevice& rd,
   if ( have_record_to )
   {
     // clear all flags
-    to_file_ = to_screen_ = to_memory_ = to_accumulator_ = false;
+    to_file_ = to_screen_ = to_memory_ = to_accumulator_ = to_shm_ = false;
 
     // check for flags present in array, could be far more elegant ...
     ArrayDatum ad = getValue< ArrayDatum >( d, names::record_to );
@@ -272,6 +299,11 @@ nest::RecordingDevice::Parameters_::set( const RecordingDevice& rd,
       {
         to_screen_ = true;
       }
+      else if ( *t == LiteralDatum( names::shm )
+        || *t == Token( names::shm.toString() ) )
+      {
+        to_shm_ = true;
+      }
       else if ( rd.mode_ == RecordingDevice::MULTIMETER
         && ( *t == LiteralDatum( names::accumulator )
                   || *t == Token( names::accumulator.toString() ) ) )
@@ -284,13 +316,13 @@ nest::RecordingDevice::Parameters_::set( const RecordingDevice& rd,
         {
           throw BadProperty(
             "/to_record must be array, allowed entries: /file, /memory, "
-            "/screen, /accumulator." );
+            "/screen, /shm, /accumulator." );
         }
         else
         {
           throw BadProperty(
             "/to_record must be array, allowed entries: /file, /memory, "
-            "/screen." );
+            "/screen, /shm." );
         }
       }
     }
@@ -303,14 +335,15 @@ nest::RecordingDevice::Parameters_::set( const RecordingDevice& rd,
       "Data will be recorded to file and to memory." );
   }
 
-  if ( to_accumulator_
-    && ( to_file_ || to_screen_ || to_memory_ || withgid_ || withweight_ ) )
+  if ( to_accumulator_ && ( to_file_ || to_screen_ || to_memory_ || to_shm_
+                            || withgid_ || withweight_ ) )
   {
-    to_file_ = to_screen_ = to_memory_ = withgid_ = withweight_ = false;
+    to_file_ = to_screen_ = to_memory_ = to_shm_ = withgid_ = withweight_ =
+      false;
     LOG( M_WARNING,
       "RecordingDevice::set_status()",
       "Accumulator mode selected. All incompatible properties "
-      "(to_file, to_screen, to_memory, withgid, withweight) "
+      "(to_file, to_screen, to_memory, to_shm, withgid, withweight) "
       "have been set to false." );
   }
 
@@ -356,39 +389,45 @@ nest::RecordingDevice::State_::get( DictionaryDatum& d,
   {
     assert( not p.to_accumulator_ );
     initialize_property_intvector( dict, names::senders );
-    append_property(
-      dict, names::senders, std::vector< long >( event_senders_ ) );
+    append_property( dict,
+      names::senders,
+      std::vector< long >( event_senders_.begin(), event_senders_.end() ) );
   }
 
   if ( p.withweight_ )
   {
     assert( not p.to_accumulator_ );
     initialize_property_doublevector( dict, names::weights );
-    append_property(
-      dict, names::weights, std::vector< double >( event_weights_ ) );
+    append_property( dict,
+      names::weights,
+      std::vector< double >( event_weights_.begin(), event_weights_.end() ) );
   }
 
   if ( p.withtargetgid_ )
   {
     assert( not p.to_accumulator_ );
     initialize_property_intvector( dict, names::targets );
-    append_property(
-      dict, names::targets, std::vector< long >( event_targets_ ) );
+    append_property( dict,
+      names::targets,
+      std::vector< long >( event_targets_.begin(), event_targets_.end() ) );
   }
 
   if ( p.withport_ )
   {
     assert( not p.to_accumulator_ );
     initialize_property_intvector( dict, names::ports );
-    append_property( dict, names::ports, std::vector< long >( event_ports_ ) );
+    append_property( dict,
+      names::ports,
+      std::vector< long >( event_ports_.begin(), event_ports_.end() ) );
   }
 
   if ( p.withrport_ )
   {
     assert( not p.to_accumulator_ );
     initialize_property_intvector( dict, names::rports );
-    append_property(
-      dict, names::rports, std::vector< long >( event_rports_ ) );
+    append_property( dict,
+      names::rports,
+      std::vector< long >( event_rports_.begin(), event_rports_.end() ) );
   }
 
   if ( p.withtime_ )
@@ -401,13 +440,17 @@ nest::RecordingDevice::State_::get( DictionaryDatum& d,
       // other threads is either empty of identical to what is present.
       if ( not p.to_accumulator_ )
       {
-        append_property(
-          dict, names::times, std::vector< long >( event_times_steps_ ) );
+        append_property( dict,
+          names::times,
+          std::vector< long >(
+            event_times_steps_.begin(), event_times_steps_.end() ) );
       }
       else
       {
-        provide_property(
-          dict, names::times, std::vector< long >( event_times_steps_ ) );
+        provide_property( dict,
+          names::times,
+          std::vector< long >(
+            event_times_steps_.begin(), event_times_steps_.end() ) );
       }
 
       if ( p.precise_times_ )
@@ -417,13 +460,15 @@ nest::RecordingDevice::State_::get( DictionaryDatum& d,
         {
           append_property( dict,
             names::offsets,
-            std::vector< double >( event_times_offsets_ ) );
+            std::vector< double >(
+              event_times_offsets_.begin(), event_times_offsets_.end() ) );
         }
         else
         {
           provide_property( dict,
             names::offsets,
-            std::vector< double >( event_times_offsets_ ) );
+            std::vector< double >(
+              event_times_offsets_.begin(), event_times_offsets_.end() ) );
         }
       }
     }
@@ -432,13 +477,17 @@ nest::RecordingDevice::State_::get( DictionaryDatum& d,
       initialize_property_doublevector( dict, names::times );
       if ( not p.to_accumulator_ )
       {
-        append_property(
-          dict, names::times, std::vector< double >( event_times_ms_ ) );
+        append_property( dict,
+          names::times,
+          std::vector< double >(
+            event_times_ms_.begin(), event_times_ms_.end() ) );
       }
       else
       {
-        provide_property(
-          dict, names::times, std::vector< double >( event_times_ms_ ) );
+        provide_property( dict,
+          names::times,
+          std::vector< double >(
+            event_times_ms_.begin(), event_times_ms_.end() ) );
       }
     }
   }
@@ -558,6 +607,18 @@ nest::RecordingDevice::calibrate()
 {
   Device::calibrate();
 
+  if ( P_.to_shm_ )
+  {
+    // the ring is replaced if any part of its name has changed
+    const std::string name = build_shm_name_();
+    if ( not B_.shm_.is_open() or name != P_.shm_name_ )
+    {
+      P_.shm_name_.clear();
+      B_.shm_.create( name, P_.shm_buffer_size_, 1 );
+      P_.shm_name_ = name;
+    }
+  }
+
   if ( P_.to_file_ )
   {
     // do we need to (re-)open the file
@@ -701,6 +762,8 @@ nest::RecordingDevice::calibrate()
 void
 nest::RecordingDevice::post_run_cleanup()
 {
+  B_.shm_.publish();
+
   if ( B_.fs_.is_open() )
   {
     if ( P_.flush_after_simulate_ )
@@ -773,6 +836,12 @@ nest::RecordingDevice::set_status( const DictionaryDatum& d )
     P_.filename_.clear();
   }
 
+  if ( not P_.to_shm_ && B_.shm_.is_open() )
+  {
+    B_.shm_.close();
+    P_.shm_name_.clear();
+  }
+
   if ( S_.events_ == 0 )
   {
     S_.clear_events();
@@ -838,6 +907,21 @@ nest::RecordingDevice::record_event( const Event& event, bool endrecord )
     }
   }
 
+  if ( P_.to_shm_ )
+  {
+    // integers are stored bitwise in the staged record of doubles
+    const int64_t ints[ 2 ] = { static_cast< int64_t >( sender ),
+      stamp.get_steps() };
+    B_.shm_record_.resize( 4 );
+    std::memcpy( &B_.shm_record_[ 0 ], ints, sizeof( ints ) );
+    B_.shm_record_[ 2 ] = offset;
+    B_.shm_record_[ 3 ] = weight;
+    if ( endrecord )
+    {
+      write_shm_record_();
+    }
+  }
+
   // storing data when recording to accumulator relies on the fact
   // that multimeter will call us only once per accumulation step
   if ( P_.to_memory_ || P_.to_accumulator_ )
@@ -1013,6 +1097,40 @@ nest::RecordingDevice::build_filename_() const
   return basename.str() + '.' + P_.file_ext_;
 }
 
+const std::string
+nest::RecordingDevice::build_shm_name_() const
+{
+  std::ostringstream name;
+  name << '/' << kernel().io_manager.get_data_prefix();
+  if ( not P_.label_.empty() )
+  {
+    name << P_.label_;
+  }
+  else
+  {
+    name << node_.get_name();
+  }
+  if ( P_.use_gid_in_filename_ or P_.label_.empty() )
+  {
+    name << '-' << node_.get_gid();
+  }
+  name << '-' << node_.get_vp();
+  return name.str();
+}
+
+void
+nest::RecordingDevice::write_shm_record_()
+{
+  // the ring is opened in calibrate(), to_shm may have been set since
+  if ( B_.shm_.is_open() )
+  {
+    B_.shm_.write( ShmRingBuffer::EVENT,
+      &B_.shm_record_[ 0 ],
+      B_.shm_record_.size() * sizeof( double ) );
+  }
+  B_.shm_record_.clear();
+}
+
 void
 nest::RecordingDevice::State_::clear_events()
 {
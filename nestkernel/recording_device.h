@@ -32,7 +32,9 @@
 
 // Includes from nestkernel:
 #include "device.h"
+#include "memory_accounting.h"
 #include "nest_types.h"
+#include "shm_ring_buffer.h"
 
 // Includes from sli:
 #include "dictdatum.h"
@@ -98,11 +100,11 @@ namespace nest
 
   The following parameters control where output is sent/data collected:
   /record_to - An array containing any combination of /file, /memory, /screen,
-               indicating whether to write to file, record in memory or write
-               to the console window. An empty array turns all recording of
-               individual events off, only an event count is kept. You can also
-               pass strings (file), (memory), (screen), mainly for compatibility
-               with Python.
+               /shm, indicating whether to write to file, record in memory,
+               write to the console window or stream to shared memory. An empty
+               array turns all recording of individual events off, only an
+               event count is kept. You can also pass strings (file), (memory),
+               (screen), (shm), mainly for compatibility with Python.
 
                The name of the output file is
                  data_path/data_prefix(label|model_name)-gid-vp.file_extension
@@ -125,6 +127,25 @@ namespace nest
   /to_memory - If true, turn on recording to memory Similar to /record_to
                [/memory], but does not affect settings for recording to file and
                screen.
+  /to_shm    - If true, turn on streaming to shared memory. Similar to
+               /record_to [/shm], but does not affect other settings.
+
+               Each thread writes its events to a POSIX shared memory ring
+               named
+                 /data_prefix(label|model_name)-gid-vp
+               where gid is omitted if /use_gid_in_filename is false. Unlike
+               file names, the name does not depend on the network size. Each
+               event is a record of type EVENT with sender, time stamp, offset
+               and weight, followed by the sampled values for multimeters; see
+               ShmRingBuffer in nestkernel/shm_ring_buffer.h for the layout.
+               Records of a time slice become visible to the reader at the end
+               of the slice. Records that do not fit into the ring because the
+               reader does not keep up are dropped. The ring is created in
+               Prepare and removed when the device is destroyed.
+  /shm_buffer_size - Size of the shared memory ring in bytes (default: 1 MB).
+                     Only has an effect on rings created afterwards.
+  /shm_names - Array containing the names of the shared memory rings, one per
+               local thread. Only available while rings are open.
 
   /filenames - Array containing the filenames where data is recorded to. This
                array has one entry per local thread and is only available if
@@ -392,6 +413,21 @@ public:
   {
     return P_.to_accumulator_;
   }
+  bool
+  to_shm() const
+  {
+    return P_.to_shm_;
+  }
+
+  /**
+   * Make records streamed to shared memory visible to the reader.
+   * Recorders call this at the end of each update.
+   */
+  void
+  publish_records()
+  {
+    B_.shm_.publish();
+  }
 
   inline void set_precise_times( bool precise_times );
 
@@ -471,6 +507,12 @@ private:
    */
   const std::string build_filename_() const;
 
+  //! Build name of shared memory ring from parts, see build_filename_()
+  const std::string build_shm_name_() const;
+
+  //! Write staged record to shared memory ring
+  void write_shm_record_();
+
   // ------------------------------------------------------------------
 
   struct Buffers_
@@ -486,6 +528,9 @@ private:
     char* fbuffer_;
     long fbuffer_size_; //!< size of fbuffer_; -1: not yet set
 
+    ShmRingBuffer shm_;               //!< ring to stream records to
+    std::vector< double > shm_record_; //!< record in progress
+
     Buffers_();
     ~Buffers_();
   };
@@ -499,6 +544,7 @@ private:
     bool to_memory_; //!< true if data should be recorded in memory, default
     bool to_accumulator_; //!< true if data is to be accumulated; exclusive to
                           //!< all other to_*
+    bool to_shm_;         //!< true if events are streamed to shared memory
     bool time_in_steps_;  //!< true if time is printed in steps, not ms.
     bool precise_times_;  //!< true if time is computed including offset
     bool withgid_;        //!< true if element GID is to be printed, default
@@ -520,6 +566,8 @@ private:
     std::string label_;    //!< a user-defined label for symbolic device names.
     std::string file_ext_; //!< the file name extension to use, without .
     std::string filename_; //!< the filename, if recording to a file (read-only)
+    long shm_buffer_size_; //!< size of shared memory ring in bytes
+    std::string shm_name_; //!< name of shared memory ring while open
     bool close_after_simulate_; //!< if true, finalize() shall close the stream
     bool flush_after_simulate_; //!< if true, post_run_cleanup() flushes stream
     bool flush_records_;        //!< if true, flush stream after each output
@@ -555,16 +603,21 @@ private:
 
   struct State_
   {
-    size_t events_;                         //!< Event counter
-    std::vector< long > event_senders_;     //!< List of event sender ids
-    std::vector< long > event_targets_;     //!< List of event targets ids
-    std::vector< long > event_ports_;       //!< List of event ports
-    std::vector< long > event_rports_;      //!< List of event rports
-    std::vector< double > event_times_ms_;  //!< List of event times in ms
-    std::vector< long > event_times_steps_; //!< List of event times in steps
-    //! List of event time offsets
-    std::vector< double > event_times_offsets_;
-    std::vector< double > event_weights_; //!< List of event weights
+    //! Event vectors are counted by MemoryAccounting
+    typedef std::vector< long, accounting_allocator< long, MEM_RECORDERS > >
+      LongVector;
+    typedef std::vector< double,
+      accounting_allocator< double, MEM_RECORDERS > > DoubleVector;
+
+    size_t events_;                    //!< Event counter
+    LongVector event_senders_;         //!< List of event sender ids
+    LongVector event_targets_;         //!< List of event targets ids
+    LongVector event_ports_;           //!< List of event ports
+    LongVector event_rports_;          //!< List of event rports
+    DoubleVector event_times_ms_;      //!< List of event times in ms
+    LongVector event_times_steps_;     //!< List of event times in steps
+    DoubleVector event_times_offsets_; //!< List of event time offsets
+    DoubleVector event_weights_;       //!< List of event weights
 
     State_(); //!< Sets default parameter values
 
@@ -653,6 +706,15 @@ RecordingDevice::print_value( const ValueT& value, bool endrecord )
       B_.fs_ << '\n';
     }
   }
+
+  if ( P_.to_shm_ )
+  {
+    B_.shm_record_.push_back( static_cast< double >( value ) );
+    if ( endrecord )
+    {
+      write_shm_record_();
+    }
+  }
 }
 
 template < typename DataT >
@@ -29,6 +29,7 @@
 
 // Includes from nestkernel:
 #include "kernel_manager.h"
+#include "memory_accounting.h"
 #include "nest_time.h"
 #include "nest_types.h"
 
@@ -111,6 +112,15 @@ public:
    */
   double get_value_wfr_update( const long offs );
 
+  /**
+   * Check whether all entries in a range of the current slice are zero.
+   * The entries are not modified.
+   * @param  from  Offset of first element to check within slice.
+   * @param  to    Offset one past last element to check within slice.
+   * @returns true if no input has been buffered for [from, to)
+   */
+  bool is_zero( const long from, const long to ) const;
+
   /**
    * Initialize the buffer with noughts.
    * Also resizes the buffer if necessary.
@@ -135,7 +145,8 @@ public:
 
 private:
   //! Buffered data
-  std::vector< double > buffer_;
+  std::vector< double, accounting_allocator< double, MEM_RING_BUFFERS > >
+    buffer_;
 
   /**
    * Obtain buffer index.
@@ -185,6 +196,22 @@ RingBuffer::get_value_wfr_update( const long offs )
   return val;
 }
 
+inline bool
+RingBuffer::is_zero( const long from, const long to ) const
+{
+  assert( 0 <= from && from <= to );
+  assert( ( delay ) to <= kernel().connection_manager.get_min_delay() );
+
+  for ( long offs = from; offs < to; ++offs )
+  {
+    if ( buffer_[ get_index_( offs ) ] != 0.0 )
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
 inline size_t
 RingBuffer::get_index_( const delay d ) const
 {
@@ -235,7 +262,8 @@ public:
 
 private:
   //! Buffered data
-  std::vector< double > buffer_;
+  std::vector< double, accounting_allocator< double, MEM_RING_BUFFERS > >
+    buffer_;
 
   /**
    * Obtain buffer index.
@@ -313,8 +341,10 @@ public:
   }
 
 private:
-  //! Buffered data
-  std::vector< std::list< double > > buffer_;
+  //! Buffered data, list elements are not counted
+  std::vector< std::list< double >,
+    accounting_allocator< std::list< double >, MEM_RING_BUFFERS > >
+    buffer_;
 
   /**
    * Obtain buffer index.
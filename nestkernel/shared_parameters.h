@@ -0,0 +1,283 @@
+/*
+ *  shared_parameters.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef SHARED_PARAMETERS_H
+#define SHARED_PARAMETERS_H
+
+// C++ includes:
+#include <cassert>
+#include <map>
+
+// Generated includes:
+#include "config.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+// Includes from nestkernel:
+#include "nest_types.h"
+
+namespace nest
+{
+
+/**
+ * Handle to a block of parameters and internal variables that is shared
+ * by all nodes of a model with identical parameter values.
+ *
+ * Blocks are interned: a table keyed by parameter value holds one
+ * reference-counted block per distinct parameter set, so that nodes
+ * created from the same prototype, or set to the same values, refer to
+ * the same block. Parameters in a block are never modified. Changing the
+ * parameters of a single node through set_parameters() looks up or
+ * creates the block for the new values and releases the old one
+ * (copy-on-write).
+ *
+ * Internal variables are computed once per block by calibrate(). They are
+ * recomputed only if the resolution in ms or min_delay changed since the
+ * last calibration, since they must not depend on anything else but the
+ * parameters.
+ *
+ * Nodes are created, calibrated and destroyed from within parallel
+ * regions. Reference counts are changed atomically, and only lookups in
+ * the table, i.e., creating and deleting blocks, are serialized. Each
+ * block has its own lock for calibration, which is taken only if the
+ * block must be recalibrated. Reading parameters and variables during
+ * update is lock-free.
+ *
+ * @tparam P Parameters, must be copy-constructible and provide
+ *           operator<, which defines identity of parameter sets and must
+ *           be a strict weak ordering, so that, e.g., parameters must not
+ *           be NaN.
+ * @tparam V Internal variables, must provide calibrate( const P& ),
+ *           which must not throw.
+ */
+template < typename P, typename V >
+class SharedParameters
+{
+public:
+  //! Refer to the block for default parameters
+  SharedParameters();
+
+  //! Share the block of another handle
+  SharedParameters( const SharedParameters& );
+
+  ~SharedParameters();
+
+  SharedParameters& operator=( const SharedParameters& );
+
+  const P&
+  get_parameters() const
+  {
+    return block_->parameters;
+  }
+
+  const V&
+  get_variables() const
+  {
+    return block_->variables;
+  }
+
+  /**
+   * Refer to the block for parameters p, creating it if necessary.
+   * Other handles are not affected.
+   */
+  void set_parameters( const P& p );
+
+  /**
+   * Compute internal variables for the current resolution in ms and
+   * min_delay, unless this has been done for the block already.
+   * @note Defined in shared_parameters_impl.h.
+   */
+  void calibrate();
+
+private:
+  struct Block_
+  {
+    explicit Block_( const P& p )
+      : parameters( p )
+      , variables()
+      , references( 0 )
+      , calibrated_resolution( 0 )
+      , calibrated_min_delay( 0 )
+    {
+#ifdef _OPENMP
+      omp_init_lock( &calibration_lock );
+#endif
+    }
+
+    ~Block_()
+    {
+#ifdef _OPENMP
+      omp_destroy_lock( &calibration_lock );
+#endif
+    }
+
+    const P parameters;
+    V variables;
+    size_t references; //!< changed atomically
+    //! resolution in ms at last calibration, 0 if none
+    double calibrated_resolution;
+    delay calibrated_min_delay; //!< min_delay at last calibration
+#ifdef _OPENMP
+    omp_lock_t calibration_lock;
+#endif
+
+  private:
+    Block_( const Block_& );            //!< not implemented
+    Block_& operator=( const Block_& ); //!< not implemented
+  };
+
+  typedef std::map< P, Block_* > Table_;
+
+  //! Table of blocks; never destroyed, since prototypes may outlive statics
+  static Table_& table_();
+
+  //! Find or create block for p and take a reference
+  static Block_* acquire_( const P& p );
+
+  //! Take another reference to b, which must be referenced already
+  static void retain_( Block_* b );
+
+  //! Drop reference to b, deleting it if unused
+  static void release_( Block_* b );
+
+  /**
+   * Check whether b has been calibrated for the given resolution and
+   * min_delay.
+   * @note Defined in shared_parameters_impl.h.
+   */
+  static bool
+  is_calibrated_( const Block_& b, double resolution, delay min_delay );
+
+  Block_* block_;
+};
+
+template < typename P, typename V >
+typename SharedParameters< P, V >::Table_&
+SharedParameters< P, V >::table_()
+{
+  static Table_* table = new Table_();
+  return *table;
+}
+
+template < typename P, typename V >
+typename SharedParameters< P, V >::Block_*
+SharedParameters< P, V >::acquire_( const P& p )
+{
+  Block_* b = 0;
+#pragma omp critical( shared_parameters )
+  {
+    Table_& table = table_();
+    typename Table_::iterator it = table.find( p );
+    if ( it == table.end() )
+    {
+      it = table.insert( std::make_pair( p, new Block_( p ) ) ).first;
+    }
+    b = it->second;
+    __atomic_add_fetch( &b->references, 1, __ATOMIC_RELAXED );
+  }
+  return b;
+}
+
+template < typename P, typename V >
+void
+SharedParameters< P, V >::retain_( Block_* b )
+{
+  // the caller holds a reference, so that b cannot be deleted meanwhile
+  assert( __atomic_load_n( &b->references, __ATOMIC_RELAXED ) > 0 );
+  __atomic_add_fetch( &b->references, 1, __ATOMIC_RELAXED );
+}
+
+template < typename P, typename V >
+void
+SharedParameters< P, V >::release_( Block_* b )
+{
+  // Other references are dropped without lock. The last one is dropped
+  // under the lock of the table, so that acquire_() cannot take a new
+  // reference to a block that is being deleted.
+  size_t references = __atomic_load_n( &b->references, __ATOMIC_RELAXED );
+  while ( references > 1 )
+  {
+    if ( __atomic_compare_exchange_n( &b->references,
+           &references,
+           references - 1,
+           false,
+           __ATOMIC_RELEASE,
+           __ATOMIC_RELAXED ) )
+    {
+      return;
+    }
+  }
+
+#pragma omp critical( shared_parameters )
+  {
+    assert( __atomic_load_n( &b->references, __ATOMIC_RELAXED ) > 0 );
+    if ( __atomic_sub_fetch( &b->references, 1, __ATOMIC_ACQ_REL ) == 0 )
+    {
+      table_().erase( b->parameters );
+      delete b;
+    }
+  }
+}
+
+template < typename P, typename V >
+SharedParameters< P, V >::SharedParameters()
+  : block_( acquire_( P() ) )
+{
+}
+
+template < typename P, typename V >
+SharedParameters< P, V >::SharedParameters( const SharedParameters& sp )
+  : block_( sp.block_ )
+{
+  retain_( block_ );
+}
+
+template < typename P, typename V >
+SharedParameters< P, V >::~SharedParameters()
+{
+  release_( block_ );
+}
+
+template < typename P, typename V >
+SharedParameters< P, V >& SharedParameters< P, V >::operator=(
+  const SharedParameters& sp )
+{
+  retain_( sp.block_ );
+  release_( block_ );
+  block_ = sp.block_;
+  return *this;
+}
+
+template < typename P, typename V >
+void
+SharedParameters< P, V >::set_parameters( const P& p )
+{
+  Block_* const old = block_;
+  block_ = acquire_( p );
+  release_( old );
+}
+
+} // namespace nest
+
+#endif // SHARED_PARAMETERS_H
@@ -0,0 +1,82 @@
+/*
+ *  shared_parameters_impl.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef SHARED_PARAMETERS_IMPL_H
+#define SHARED_PARAMETERS_IMPL_H
+
+#include "shared_parameters.h"
+
+// Includes from nestkernel:
+#include "kernel_manager.h"
+#include "nest_time.h"
+
+namespace nest
+{
+
+template < typename P, typename V >
+void
+SharedParameters< P, V >::calibrate()
+{
+  // the resolution in ms, not in tics, since tics_per_ms may have changed
+  const double resolution = Time::get_resolution().get_ms();
+  const delay min_delay = kernel().connection_manager.get_min_delay();
+
+  // All nodes are calibrated for the same resolution and min_delay within
+  // a call to Prepare. The variables are written before the resolution and
+  // min_delay, so that they are complete once both match.
+  Block_& b = *block_;
+  if ( is_calibrated_( b, resolution, min_delay ) )
+  {
+    return;
+  }
+
+#ifdef _OPENMP
+  omp_set_lock( &b.calibration_lock );
+#endif
+  if ( not is_calibrated_( b, resolution, min_delay ) )
+  {
+    b.variables.calibrate( b.parameters );
+    __atomic_store( &b.calibrated_resolution, &resolution, __ATOMIC_RELEASE );
+    __atomic_store_n( &b.calibrated_min_delay, min_delay, __ATOMIC_RELEASE );
+  }
+#ifdef _OPENMP
+  omp_unset_lock( &b.calibration_lock );
+#endif
+}
+
+template < typename P, typename V >
+bool
+SharedParameters< P, V >::is_calibrated_( const Block_& b,
+  double resolution,
+  delay min_delay )
+{
+  double calibrated_resolution;
+  __atomic_load(
+    &b.calibrated_resolution, &calibrated_resolution, __ATOMIC_ACQUIRE );
+  return calibrated_resolution == resolution
+    and __atomic_load_n( &b.calibrated_min_delay, __ATOMIC_ACQUIRE )
+    == min_delay;
+}
+
+} // namespace nest
+
+#endif // SHARED_PARAMETERS_IMPL_H
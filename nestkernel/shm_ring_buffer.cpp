@@ -0,0 +1,396 @@
+/*
+ *  shm_ring_buffer.cpp
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "shm_ring_buffer.h"
+
+// Generated includes:
+#include "config.h"
+
+// C++ includes:
+#include <algorithm>
+#include <cassert>
+
+// C includes:
+#include <errno.h>
+#include <string.h>
+#ifdef HAVE_SHM_OPEN
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// Includes from libnestutil:
+#include "compose.hpp"
+#include "logging.h"
+
+// Includes from nestkernel:
+#include "kernel_manager.h"
+
+// Includes from sli:
+#include "sliexceptions.h"
+
+namespace
+{
+const char magic[ 8 ] = { 'N', 'E', 'S', 'T', 'S', 'H', 'M', '1' };
+const size_t header_size = 128; //!< bytes before the first tail
+const size_t line_size = 64;    //!< distance between head and tails
+
+inline uint64_t
+load_acquire( const volatile uint64_t* p )
+{
+  return __atomic_load_n( p, __ATOMIC_ACQUIRE );
+}
+
+inline void
+store_release( volatile uint64_t* p, uint64_t v )
+{
+  __atomic_store_n( p, v, __ATOMIC_RELEASE );
+}
+
+inline uint64_t
+round_up( uint64_t n )
+{
+  return ( n + 7 ) & ~static_cast< uint64_t >( 7 );
+}
+}
+
+nest::ShmRingBuffer::ShmRingBuffer()
+  : name_()
+  , base_( 0 )
+  , size_( 0 )
+  , capacity_( 0 )
+  , owner_( false )
+  , staged_( 0 )
+{
+}
+
+nest::ShmRingBuffer::ShmRingBuffer( const ShmRingBuffer& )
+  : name_()
+  , base_( 0 )
+  , size_( 0 )
+  , capacity_( 0 )
+  , owner_( false )
+  , staged_( 0 )
+{
+}
+
+nest::ShmRingBuffer::~ShmRingBuffer()
+{
+  close();
+}
+
+volatile uint64_t*
+nest::ShmRingBuffer::head_() const
+{
+  return reinterpret_cast< volatile uint64_t* >( base_ + line_size );
+}
+
+volatile uint64_t*
+nest::ShmRingBuffer::tail_( size_t reader ) const
+{
+  return reinterpret_cast< volatile uint64_t* >(
+    base_ + header_size + line_size * reader );
+}
+
+char*
+nest::ShmRingBuffer::data_() const
+{
+  return base_ + header_size + line_size * get_num_readers();
+}
+
+size_t
+nest::ShmRingBuffer::get_num_readers() const
+{
+  return reinterpret_cast< const uint64_t* >( base_ )[ 2 ];
+}
+
+uint64_t
+nest::ShmRingBuffer::get_dropped() const
+{
+  return load_acquire( reinterpret_cast< volatile uint64_t* >( base_ ) + 3 );
+}
+
+#ifdef HAVE_SHM_OPEN
+
+void
+nest::ShmRingBuffer::map_( int fd, size_t size )
+{
+  void* p = mmap( 0, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0 );
+  ::close( fd );
+  if ( p == MAP_FAILED )
+  {
+    LOG( M_ERROR,
+      "ShmRingBuffer::map_",
+      String::compose(
+        "Cannot map shared memory '%1': %2", name_, strerror( errno ) ) );
+    throw IOError();
+  }
+  base_ = static_cast< char* >( p );
+  size_ = size;
+}
+
+void
+nest::ShmRingBuffer::create( const std::string& name,
+  size_t capacity,
+  size_t num_readers )
+{
+  close();
+  name_ = name;
+  capacity_ = round_up( capacity );
+
+  shm_unlink( name_.c_str() );
+  const int fd = shm_open( name_.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600 );
+  const size_t size = header_size + line_size * num_readers + capacity_;
+  if ( fd < 0 or ftruncate( fd, size ) != 0 )
+  {
+    LOG( M_ERROR,
+      "ShmRingBuffer::create",
+      String::compose(
+        "Cannot create shared memory '%1': %2", name_, strerror( errno ) ) );
+    if ( fd >= 0 )
+    {
+      ::close( fd );
+      shm_unlink( name_.c_str() );
+    }
+    throw IOError();
+  }
+  map_( fd, size );
+  owner_ = true;
+
+  // the segment is zero-filled by ftruncate(), so that head and tails are 0
+  uint64_t* const header = reinterpret_cast< uint64_t* >( base_ );
+  header[ 1 ] = capacity_;
+  header[ 2 ] = num_readers;
+  staged_ = 0;
+
+  // readers check the magic last
+  __atomic_thread_fence( __ATOMIC_RELEASE );
+  memcpy( base_, magic, sizeof( magic ) );
+}
+
+bool
+nest::ShmRingBuffer::attach( const std::string& name )
+{
+  close();
+  name_ = name;
+
+  const int fd = shm_open( name_.c_str(), O_RDWR, 0 );
+  if ( fd < 0 )
+  {
+    return false;
+  }
+  struct stat st;
+  if ( fstat( fd, &st ) != 0
+    or static_cast< size_t >( st.st_size ) < header_size )
+  {
+    ::close( fd );
+    LOG( M_ERROR,
+      "ShmRingBuffer::attach",
+      String::compose( "Shared memory '%1' is not a NEST ring.", name_ ) );
+    throw IOError();
+  }
+  map_( fd, st.st_size );
+
+  __atomic_thread_fence( __ATOMIC_ACQUIRE );
+  const uint64_t* const header = reinterpret_cast< const uint64_t* >( base_ );
+  if ( memcmp( base_, magic, sizeof( magic ) ) != 0
+    or header_size + line_size * header[ 2 ] + header[ 1 ] != size_ )
+  {
+    close();
+    LOG( M_ERROR,
+      "ShmRingBuffer::attach",
+      String::compose( "Shared memory '%1' is not a NEST ring.", name ) );
+    throw IOError();
+  }
+  capacity_ = header[ 1 ];
+  staged_ = load_acquire( head_() );
+  return true;
+}
+
+void
+nest::ShmRingBuffer::close()
+{
+  if ( base_ == 0 )
+  {
+    return;
+  }
+  munmap( base_, size_ );
+  if ( owner_ )
+  {
+    shm_unlink( name_.c_str() );
+  }
+  base_ = 0;
+  size_ = 0;
+  owner_ = false;
+}
+
+#else
+
+void
+nest::ShmRingBuffer::map_( int, size_t )
+{
+}
+
+void
+nest::ShmRingBuffer::create( const std::string& name, size_t, size_t )
+{
+  LOG( M_ERROR,
+    "ShmRingBuffer::create",
+    String::compose( "Cannot create shared memory '%1': NEST was compiled "
+                     "without support for POSIX shared memory.",
+      name ) );
+  throw IOError();
+}
+
+bool
+nest::ShmRingBuffer::attach( const std::string& name )
+{
+  create( name, 0, 0 );
+  return false;
+}
+
+void
+nest::ShmRingBuffer::close()
+{
+}
+
+#endif // HAVE_SHM_OPEN
+
+void
+nest::ShmRingBuffer::attach_or_create( const std::string& name,
+  size_t capacity,
+  size_t num_readers )
+{
+#pragma omp critical( shm_ring_buffer )
+  {
+    if ( not attach( name ) )
+    {
+      create( name, capacity, num_readers );
+    }
+  }
+
+  if ( get_num_readers() < num_readers )
+  {
+    close();
+    LOG( M_ERROR,
+      "ShmRingBuffer::attach_or_create",
+      String::compose( "Shared memory '%1' has less than %2 readers.",
+        name,
+        num_readers ) );
+    throw IOError();
+  }
+}
+
+bool
+nest::ShmRingBuffer::write( RecordType type, const void* payload, size_t size )
+{
+  assert( is_open() );
+
+  const uint64_t record_size = 8 + round_up( size );
+  uint64_t pad = capacity_ - staged_ % capacity_;
+  if ( pad >= record_size )
+  {
+    pad = 0;
+  }
+
+  uint64_t min_tail = staged_;
+  for ( size_t r = 0; r < get_num_readers(); ++r )
+  {
+    min_tail = std::min( min_tail, load_acquire( tail_( r ) ) );
+  }
+  if ( staged_ + pad + record_size - min_tail > capacity_ )
+  {
+    volatile uint64_t* const dropped =
+      reinterpret_cast< volatile uint64_t* >( base_ ) + 3;
+    __atomic_add_fetch( dropped, 1, __ATOMIC_RELAXED );
+    return false;
+  }
+
+  if ( pad > 0 )
+  {
+    uint32_t* const h =
+      reinterpret_cast< uint32_t* >( data_() + staged_ % capacity_ );
+    h[ 0 ] = pad;
+    h[ 1 ] = PAD;
+    staged_ += pad;
+  }
+
+  char* const p = data_() + staged_ % capacity_;
+  uint32_t* const h = reinterpret_cast< uint32_t* >( p );
+  h[ 0 ] = record_size;
+  h[ 1 ] = type;
+  memcpy( p + 8, payload, size );
+  memset( p + 8 + size, 0, record_size - 8 - size );
+  staged_ += record_size;
+  return true;
+}
+
+void
+nest::ShmRingBuffer::publish()
+{
+  if ( is_open() )
+  {
+    store_release( head_(), staged_ );
+  }
+}
+
+bool
+nest::ShmRingBuffer::read( size_t reader,
+  RecordType& type,
+  std::vector< char >& payload )
+{
+  assert( is_open() and reader < get_num_readers() );
+
+  uint64_t tail = load_acquire( tail_( reader ) );
+  const uint64_t head = load_acquire( head_() );
+  while ( tail != head )
+  {
+    const char* const p = data_() + tail % capacity_;
+    const uint32_t* const h = reinterpret_cast< const uint32_t* >( p );
+    const uint32_t record_size = h[ 0 ];
+    // the segment is written by other processes, never trust the size
+    if ( record_size < 8 or record_size % 8 != 0
+      or record_size > capacity_ - tail % capacity_
+      or record_size > head - tail )
+    {
+      throw KernelException( String::compose(
+        "Shared memory '%1' holds a record of invalid size %2 at position "
+        "%3.",
+        name_,
+        record_size,
+        tail ) );
+    }
+    type = static_cast< RecordType >( h[ 1 ] );
+    if ( type != PAD )
+    {
+      payload.assign( p + 8, p + record_size );
+    }
+    tail += record_size;
+    store_release( tail_( reader ), tail );
+    if ( type != PAD )
+    {
+      return true;
+    }
+  }
+  return false;
+}
@@ -0,0 +1,176 @@
+/*
+ *  shm_ring_buffer.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef SHM_RING_BUFFER_H
+#define SHM_RING_BUFFER_H
+
+// C includes:
+#include <stdint.h>
+
+// C++ includes:
+#include <string>
+#include <vector>
+
+namespace nest
+{
+
+/**
+ * Lock-free ring buffer of variable-size records in POSIX shared memory,
+ * with a single producer and a fixed number of readers.
+ *
+ * Every reader sees every record. The producer never overwrites records
+ * that have not been read by all readers; records that do not fit are
+ * dropped and counted instead, so that the simulation never waits for a
+ * reader.
+ *
+ * Layout of the segment, all integers in native byte order:
+ *
+ *   offset        size  content
+ *   0             8     magic, "NESTSHM1"
+ *   8             8     capacity C of the data area in bytes, multiple of 8
+ *   16            8     number of readers R
+ *   24            8     number of records dropped because the ring was full
+ *   64            8     head: bytes written in total (written by producer)
+ *   128 + 64 * i  8     tail of reader i: bytes read in total by reader i
+ *   128 + 64 * R  C     data area
+ *
+ * Head and tails only increase; the position of a byte in the data area is
+ * its count modulo C. The producer stores the head with release semantics
+ * after writing records, readers load it with acquire semantics, and vice
+ * versa for the tails. Each record starts at a multiple of 8 with an
+ * 8-byte header, a uint32 total size of the record including header and
+ * padding, followed by a uint32 record type. Records never wrap around the
+ * end of the data area; the space up to the end is filled with a record of
+ * type PAD instead.
+ *
+ * Record types and their payload:
+ *
+ *   PAD      no payload, skip
+ *   EVENT    int64 sender, int64 step, double offset, double weight,
+ *            followed by zero or more double values
+ *   CURRENT  double time in ms, double amplitude in pA
+ *   SPIKES   zero or more double spike times in ms
+ *
+ * Steps and times refer to the stamp of an event, i.e., the end of the
+ * time step in which it was generated. The segment name must start with
+ * a slash. extras/shm_stream/nest_shm_stream.h and pynest/nest/shm_stream.py
+ * implement readers and writers.
+ *
+ * Instances are not copied: the copy constructor creates a closed ring, so
+ * that nodes can be copied from prototypes.
+ */
+class ShmRingBuffer
+{
+public:
+  enum RecordType
+  {
+    PAD = 0,
+    EVENT = 1,
+    CURRENT = 2,
+    SPIKES = 3
+  };
+
+  ShmRingBuffer();
+  ShmRingBuffer( const ShmRingBuffer& );
+  ~ShmRingBuffer();
+
+  /**
+   * Create segment with given name, replacing any existing segment.
+   * The segment is removed when the ring is closed.
+   * @throws IOError if the segment cannot be created.
+   */
+  void create( const std::string& name, size_t capacity, size_t num_readers );
+
+  /**
+   * Map an existing segment.
+   * @returns false if the segment does not exist.
+   * @throws IOError if the segment is not a valid ring.
+   */
+  bool attach( const std::string& name );
+
+  /**
+   * Map segment with given name, or create it if it does not exist.
+   * Serialized across threads, so that the replicas of a device share a
+   * segment, with one reader per replica.
+   * @throws IOError if an existing segment has less than num_readers readers.
+   */
+  void attach_or_create( const std::string& name,
+    size_t capacity,
+    size_t num_readers );
+
+  //! Unmap the segment and remove it if it was created by this instance
+  void close();
+
+  bool
+  is_open() const
+  {
+    return base_ != 0;
+  }
+
+  const std::string&
+  get_name() const
+  {
+    return name_;
+  }
+
+  size_t get_num_readers() const;
+
+  //! Number of records dropped since the segment was created
+  uint64_t get_dropped() const;
+
+  /**
+   * Append a record, which becomes visible to readers with the next call
+   * to publish(). The payload is padded to a multiple of 8 bytes.
+   * @returns false if the record was dropped because the ring is full.
+   */
+  bool write( RecordType type, const void* payload, size_t size );
+
+  //! Make all records written so far visible to readers
+  void publish();
+
+  /**
+   * Read next published record as reader with given index. Records of type
+   * PAD are skipped. The payload is copied, including padding.
+   * @returns false if there is no record.
+   */
+  bool read( size_t reader, RecordType& type, std::vector< char >& payload );
+
+private:
+  ShmRingBuffer& operator=( const ShmRingBuffer& ); //!< not implemented
+
+  void map_( int fd, size_t size );
+
+  volatile uint64_t* head_() const;
+  volatile uint64_t* tail_( size_t reader ) const;
+  char* data_() const;
+
+  std::string name_;
+  char* base_;      //!< start of mapped segment, 0 if closed
+  size_t size_;     //!< size of mapped segment
+  uint64_t capacity_;
+  bool owner_;      //!< segment was created by this instance
+  uint64_t staged_; //!< head including records not yet published
+};
+
+} // namespace nest
+
+#endif /* SHM_RING_BUFFER_H */
@@ -57,6 +57,9 @@ nest::SimulationManager::SimulationManager()
   , wfr_tol_( 0.0001 )
   , wfr_max_iterations_( 15 )
   , wfr_interpolation_order_( 3 )
+  , use_perf_counters_( false )
+  , perf_counters_available_( false )
+  , perf_counters_()
 {
 }
 
@@ -71,6 +74,10 @@ nest::SimulationManager::initialize()
   simulated_ = false;
   exit_on_user_signal_ = false;
   inconsistent_state_ = false;
+
+  use_perf_counters_ = false;
+  perf_counters_available_ = PerfCounters::is_supported();
+  perf_counters_.set_num_threads( 0 );
 }
 
 void
@@ -349,6 +356,22 @@ nest::SimulationManager::set_status( const DictionaryDatum& d )
       wfr_interpolation_order_ = interp_order;
     }
   }
+
+  // hardware event counters are optional, simulations run without them
+  // if the system does not provide them
+  bool perf_counters;
+  if ( updateValue< bool >( d, names::perf_counters, perf_counters ) )
+  {
+    if ( perf_counters and not perf_counters_available_ )
+    {
+      LOG( M_WARNING,
+        "SimulationManager::set_status",
+        "Hardware performance counters are not available on this system. "
+        "Simulating without counters." );
+    }
+    use_perf_counters_ = perf_counters;
+    perf_counters_.reset();
+  }
 }
 
 void
@@ -371,6 +394,12 @@ nest::SimulationManager::get_status( DictionaryDatum& d )
   def< double >( d, names::wfr_tol, wfr_tol_ );
   def< long >( d, names::wfr_max_iterations, wfr_max_iterations_ );
   def< long >( d, names::wfr_interpolation_order, wfr_interpolation_order_ );
+
+  def< bool >( d, names::perf_counters, use_perf_counters_ );
+  def< bool >( d, names::perf_counters_available, perf_counters_available_ );
+  DictionaryDatum perf_counts( new Dictionary );
+  perf_counters_.get_status( perf_counts );
+  ( *d )[ names::perf_counts ] = perf_counts;
 }
 
 void
@@ -421,6 +450,8 @@ nest::SimulationManager::prepare()
 
   kernel().model_manager.create_secondary_events_prototypes();
 
+  kernel().event_delivery_manager.configure_rate_engine();
+
   // we have to do enter_runtime after prepare_nodes, since we use
   // calibrate to map the ports of MUSIC devices, which has to be done
   // before enter_runtime
@@ -534,6 +565,16 @@ nest::SimulationManager::run( Time const& t )
       "the minimal delay." );
   }
 
+  // Waveform relaxation iterates whole slices, which the rate network
+  // engine cannot split, see RateNetworkEngine.
+  if ( kernel().node_manager.wfr_is_used()
+    and end_sim % kernel().connection_manager.get_min_delay() != 0
+    and kernel().event_delivery_manager.get_rate_engine().is_active() )
+  {
+    kernel().event_delivery_manager.get_rate_engine().deactivate(
+      "a simulation with waveform relaxation ends within a min_delay slice" );
+  }
+
   call_update_();
 
   kernel().node_manager.post_run_cleanup();
@@ -650,11 +691,23 @@ nest::SimulationManager::update_()
     kernel().vp_manager.get_num_threads() );
   bool exception_raised = false; // none raised on any thread
 
+  const bool count_events = use_perf_counters_ and perf_counters_available_;
+  if ( count_events )
+  {
+    perf_counters_.set_num_threads( kernel().vp_manager.get_num_threads() );
+  }
+
 // parallel section begins
 #pragma omp parallel
   {
     const int thrd = kernel().vp_manager.get_thread_id();
 
+    // counters count the events of the thread that opens them
+    if ( count_events )
+    {
+      perf_counters_.open( thrd );
+    }
+
     do
     {
       if ( print_time_ )
@@ -662,6 +715,10 @@ nest::SimulationManager::update_()
         gettimeofday( &t_slice_begin_, NULL );
       }
 
+      // The structural plasticity update, and the update of nodes that do
+      // not depend on delivered events, run while a pipelined spike exchange
+      // started at the end of the last slice is still in progress. The
+      // exchange is completed in deliver_events().
       if ( kernel().sp_manager.is_structural_plasticity_enabled()
         && ( clock_.get_steps() + from_step_ )
             % kernel().sp_manager.get_structural_plasticity_update_interval()
@@ -691,9 +748,53 @@ nest::SimulationManager::update_()
       }
 
 
+      const std::vector< Node* >& thread_local_nodes =
+        kernel().node_manager.get_nodes_on_thread( thrd );
+      const bool update_early =
+        kernel().event_delivery_manager.is_exchange_pending();
+      if ( update_early )
+      {
+        if ( count_events )
+        {
+          perf_counters_.start( thrd );
+        }
+        for ( std::vector< Node* >::const_iterator node =
+                thread_local_nodes.begin();
+              node != thread_local_nodes.end();
+              ++node )
+        {
+          try
+          {
+            if ( ( *node )->independent_of_delivery()
+              and not( *node )->is_frozen() )
+            {
+              ( *node )->update( clock_, from_step_, to_step_ );
+            }
+          }
+          catch ( std::exception& e )
+          {
+            // so throw the exception after parallel region
+            exceptions_raised.at( thrd ) = lockPTR< WrappedThreadException >(
+              new WrappedThreadException( e ) );
+          }
+        }
+        if ( count_events )
+        {
+          perf_counters_.stop( thrd, PerfCounters::UPDATE );
+        }
+      }
+
       if ( from_step_ == 0 ) // deliver only at beginning of slice
       {
+        if ( count_events )
+        {
+          perf_counters_.start( thrd );
+        }
         kernel().event_delivery_manager.deliver_events( thrd );
+        if ( count_events )
+        {
+          perf_counters_.stop( thrd, PerfCounters::DELIVER );
+        }
 #ifdef HAVE_MUSIC
 // advance the time of music by one step (min_delay * h) must
 // be done after deliver_events_() since it calls
@@ -749,6 +850,10 @@ nest::SimulationManager::update_()
         {
           bool done_p = true;
 
+          if ( count_events )
+          {
+            perf_counters_.start( thrd );
+          }
           // this loop may be empty for those threads
           // that do not have any nodes requiring wfr_update
           for ( std::vector< Node* >::const_iterator i =
@@ -758,6 +863,10 @@ nest::SimulationManager::update_()
           {
             done_p = wfr_update_( *i ) && done_p;
           }
+          if ( count_events )
+          {
+            perf_counters_.stop( thrd, PerfCounters::UPDATE );
+          }
 
 // add done value of thread p to done vector
 #pragma omp critical
@@ -776,7 +885,15 @@ nest::SimulationManager::update_()
             }
 
             // gather SecondaryEvents (e.g. GapJunctionEvents)
+            if ( count_events )
+            {
+              perf_counters_.start( thrd );
+            }
             kernel().event_delivery_manager.gather_events( done_all );
+            if ( count_events )
+            {
+              perf_counters_.stop( thrd, PerfCounters::GATHER );
+            }
 
             // reset done and done_all
             //(needs to be in the single threaded part)
@@ -786,7 +903,15 @@ nest::SimulationManager::update_()
 
           // deliver SecondaryEvents generated during wfr_update
           // returns the done value over all threads
+          if ( count_events )
+          {
+            perf_counters_.start( thrd );
+          }
           done_p = kernel().event_delivery_manager.deliver_events( thrd );
+          if ( count_events )
+          {
+            perf_counters_.stop( thrd, PerfCounters::DELIVER );
+          }
 
           if ( done_p )
           {
@@ -811,8 +936,10 @@ nest::SimulationManager::update_()
       } // of if(wfr_is_used)
       // end of preliminary update
 
-      const std::vector< Node* >& thread_local_nodes =
-        kernel().node_manager.get_nodes_on_thread( thrd );
+      if ( count_events )
+      {
+        perf_counters_.start( thrd );
+      }
       for (
         std::vector< Node* >::const_iterator node = thread_local_nodes.begin();
         node != thread_local_nodes.end();
@@ -822,7 +949,8 @@ nest::SimulationManager::update_()
         // exceptions here and then handle them after the parallel region.
         try
         {
-          if ( not( *node )->is_frozen() )
+          if ( not( *node )->is_frozen()
+            and not( update_early and ( *node )->independent_of_delivery() ) )
           {
             ( *node )->update( clock_, from_step_, to_step_ );
           }
@@ -834,6 +962,10 @@ nest::SimulationManager::update_()
             new WrappedThreadException( e ) );
         }
       }
+      if ( count_events )
+      {
+        perf_counters_.stop( thrd, PerfCounters::UPDATE );
+      }
 
 // parallel section ends, wait until all threads are done -> synchronize
 #pragma omp barrier
@@ -853,10 +985,19 @@ nest::SimulationManager::update_()
           }
         }
 
-        // gather only at end of slice
+        // gather only at end of slice; a pipelined exchange is completed
+        // during deliver_events() at the beginning of the next slice
         if ( to_step_ == kernel().connection_manager.get_min_delay() )
         {
-          kernel().event_delivery_manager.gather_events( true );
+          if ( count_events )
+          {
+            perf_counters_.start( thrd );
+          }
+          kernel().event_delivery_manager.start_gather_events();
+          if ( count_events )
+          {
+            perf_counters_.stop( thrd, PerfCounters::GATHER );
+          }
         }
 
         advance_time_();
@@ -891,8 +1032,16 @@ nest::SimulationManager::update_()
         Time( Time::step( clock_.get_steps() + to_step_ ) ).get_ms() );
     }
 
+    if ( count_events )
+    {
+      perf_counters_.close( thrd );
+    }
   } // end of #pragma parallel omp
 
+  // complete the exchange started at the end of the last slice, so that
+  // the buffers can be reconfigured before the next call to simulate
+  kernel().event_delivery_manager.finish_gather_events();
+
   // check if any exceptions have been raised
   for ( index thrd = 0; thrd < kernel().vp_manager.get_num_threads(); ++thrd )
   {
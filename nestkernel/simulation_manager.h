@@ -32,6 +32,7 @@
 // Includes from nestkernel:
 #include "nest_time.h"
 #include "nest_types.h"
+#include "perf_counters.h"
 
 // Includes from sli:
 #include "dictdatum.h"
@@ -187,6 +188,9 @@ private:
                             //!< relaxation
   size_t wfr_interpolation_order_; //!< interpolation order for waveform
                                    //!< relaxation method
+  bool use_perf_counters_;       //!< count hardware events during simulation
+  bool perf_counters_available_; //!< hardware event counters can be opened
+  PerfCounters perf_counters_;   //!< hardware events per thread and phase
 };
 
 inline Time const&
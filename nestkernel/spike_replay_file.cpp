@@ -0,0 +1,290 @@
+/*
+ *  spike_replay_file.cpp
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "spike_replay_file.h"
+
+// C++ includes:
+#include <algorithm>
+#include <cassert>
+#include <fstream>
+
+// C includes:
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Includes from libnestutil:
+#include "compose.hpp"
+#include "logging.h"
+
+// Includes from nestkernel:
+#include "kernel_manager.h"
+#include "nest_time.h"
+
+// Includes from sli:
+#include "sliexceptions.h"
+
+namespace
+{
+const char magic[ 8 ] = { 'N', 'E', 'S', 'T', 'R', 'P', 'L', '1' };
+const size_t header_size = 40;
+
+struct StepLess
+{
+  bool
+  operator()( const nest::SpikeReplayFile::Record& r, int64_t step ) const
+  {
+    return r.step < step;
+  }
+
+  bool
+  operator()( const nest::SpikeReplayFile::Record& a,
+    const nest::SpikeReplayFile::Record& b ) const
+  {
+    return a.step < b.step;
+  }
+};
+}
+
+nest::SpikeReplayFile::SpikeReplayFile()
+  : filename_()
+  , base_( 0 )
+  , length_( 0 )
+  , records_( 0 )
+  , size_( 0 )
+  , released_( 0 )
+{
+}
+
+nest::SpikeReplayFile::SpikeReplayFile( const SpikeReplayFile& )
+  : filename_()
+  , base_( 0 )
+  , length_( 0 )
+  , records_( 0 )
+  , size_( 0 )
+  , released_( 0 )
+{
+}
+
+nest::SpikeReplayFile::~SpikeReplayFile()
+{
+  close();
+}
+
+void
+nest::SpikeReplayFile::open( const std::string& filename )
+{
+  close();
+  filename_ = filename;
+
+  const int fd = ::open( filename_.c_str(), O_RDONLY );
+  struct stat st;
+  if ( fd < 0 or fstat( fd, &st ) != 0 )
+  {
+    LOG( M_ERROR,
+      "SpikeReplayFile::open",
+      String::compose(
+        "Cannot open spike file '%1': %2", filename_, strerror( errno ) ) );
+    if ( fd >= 0 )
+    {
+      ::close( fd );
+    }
+    throw IOError();
+  }
+
+  const size_t length = st.st_size;
+  if ( length < header_size )
+  {
+    ::close( fd );
+    LOG( M_ERROR,
+      "SpikeReplayFile::open",
+      String::compose( "File '%1' is not a spike file.", filename_ ) );
+    throw IOError();
+  }
+
+  void* p = mmap( 0, length, PROT_READ, MAP_PRIVATE, fd, 0 );
+  ::close( fd );
+  if ( p == MAP_FAILED )
+  {
+    LOG( M_ERROR,
+      "SpikeReplayFile::open",
+      String::compose(
+        "Cannot map spike file '%1': %2", filename_, strerror( errno ) ) );
+    throw IOError();
+  }
+  base_ = static_cast< char* >( p );
+  length_ = length;
+
+  const uint64_t num_spikes = reinterpret_cast< const uint64_t* >( base_ )[ 1 ];
+  if ( memcmp( base_, magic, sizeof( magic ) ) != 0
+    or header_size + num_spikes * sizeof( Record ) != length_ )
+  {
+    close();
+    LOG( M_ERROR,
+      "SpikeReplayFile::open",
+      String::compose( "File '%1' is not a spike file.", filename ) );
+    throw IOError();
+  }
+  records_ = reinterpret_cast< const Record* >( base_ + header_size );
+  size_ = num_spikes;
+  released_ = 0;
+
+  // pages are read once, in order
+  madvise( base_, length_, MADV_SEQUENTIAL );
+
+  // readers bisect and stop at the first record after the slice, so that
+  // records out of order would be dropped silently
+  for ( size_t i = 0; i < size_; ++i )
+  {
+    if ( ( i > 0 and records_[ i ].step < records_[ i - 1 ].step )
+      or records_[ i ].gid < get_min_gid()
+      or records_[ i ].gid > get_max_gid() )
+    {
+      close();
+      LOG( M_ERROR,
+        "SpikeReplayFile::open",
+        String::compose(
+          "Record %1 of spike file '%2' is not sorted by step or its GID is "
+          "out of the range given in the header.",
+          i,
+          filename ) );
+      throw IOError();
+    }
+  }
+
+  // the check has read the whole file, drop the pages again
+  release( size_ );
+}
+
+void
+nest::SpikeReplayFile::close()
+{
+  if ( base_ == 0 )
+  {
+    return;
+  }
+  munmap( base_, length_ );
+  base_ = 0;
+  length_ = 0;
+  records_ = 0;
+  size_ = 0;
+  released_ = 0;
+}
+
+uint64_t
+nest::SpikeReplayFile::get_min_gid() const
+{
+  return reinterpret_cast< const uint64_t* >( base_ )[ 2 ];
+}
+
+uint64_t
+nest::SpikeReplayFile::get_max_gid() const
+{
+  return reinterpret_cast< const uint64_t* >( base_ )[ 3 ];
+}
+
+double
+nest::SpikeReplayFile::get_resolution() const
+{
+  return reinterpret_cast< const double* >( base_ )[ 4 ];
+}
+
+size_t
+nest::SpikeReplayFile::lower_bound( size_t begin, int64_t step ) const
+{
+  assert( begin <= size_ );
+  return std::lower_bound(
+           records_ + begin, records_ + size_, step, StepLess() )
+    - records_;
+}
+
+void
+nest::SpikeReplayFile::release( size_t end )
+{
+  assert( end <= size_ );
+
+  // the reader has been rewound, pages before end were read again
+  if ( end < released_ )
+  {
+    released_ = 0;
+  }
+
+  // only whole pages before the page holding record end are dropped
+  static const size_t page_size = sysconf( _SC_PAGESIZE );
+  const size_t from =
+    ( header_size + released_ * sizeof( Record ) ) / page_size;
+  const size_t to = ( header_size + end * sizeof( Record ) ) / page_size;
+  if ( to > from )
+  {
+    madvise(
+      base_ + from * page_size, ( to - from ) * page_size, MADV_DONTNEED );
+    released_ = end;
+  }
+}
+
+void
+nest::SpikeReplayFile::write( const std::string& filename,
+  const std::vector< long >& gids,
+  const std::vector< double >& times )
+{
+  assert( gids.size() == times.size() );
+
+  const double h = Time::get_resolution().get_ms();
+  std::vector< Record > records( gids.size() );
+  uint64_t min_gid = 0;
+  uint64_t max_gid = 0;
+  for ( size_t i = 0; i < gids.size(); ++i )
+  {
+    const Time stamp = Time::ms_stamp( times[ i ] );
+    records[ i ].gid = gids[ i ];
+    records[ i ].step = stamp.get_steps();
+    records[ i ].offset = stamp.get_ms() - times[ i ];
+    if ( i == 0 or records[ i ].gid < min_gid )
+    {
+      min_gid = records[ i ].gid;
+    }
+    max_gid = std::max( max_gid, records[ i ].gid );
+  }
+  std::stable_sort( records.begin(), records.end(), StepLess() );
+
+  std::ofstream out( filename.c_str(), std::ios::out | std::ios::binary );
+  const uint64_t header[ 3 ] = { records.size(), min_gid, max_gid };
+  out.write( magic, sizeof( magic ) );
+  out.write( reinterpret_cast< const char* >( header ), sizeof( header ) );
+  out.write( reinterpret_cast< const char* >( &h ), sizeof( h ) );
+  if ( not records.empty() )
+  {
+    out.write( reinterpret_cast< const char* >( &records[ 0 ] ),
+      records.size() * sizeof( Record ) );
+  }
+  out.close();
+  if ( out.fail() )
+  {
+    LOG( M_ERROR,
+      "SpikeReplayFile::write",
+      String::compose( "Cannot write spike file '%1'.", filename ) );
+    throw IOError();
+  }
+}
@@ -0,0 +1,140 @@
+/*
+ *  spike_replay_file.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef SPIKE_REPLAY_FILE_H
+#define SPIKE_REPLAY_FILE_H
+
+// C includes:
+#include <stdint.h>
+
+// C++ includes:
+#include <string>
+#include <vector>
+
+namespace nest
+{
+
+/**
+ * Memory-mapped, read-only file of spikes sorted by time step, as replayed
+ * by the spike_replay_generator.
+ *
+ * Layout of the file, all values in native byte order:
+ *
+ *   offset  size  content
+ *   0       8     magic, "NESTRPL1"
+ *   8       8     uint64 number of spikes N
+ *   16      8     uint64 smallest GID
+ *   24      8     uint64 largest GID
+ *   32      8     double resolution in ms
+ *   40      24*N  records, sorted by step
+ *
+ * Each record consists of the uint64 GID of the sender, the int64 step of
+ * the spike stamp, i.e., the end of the time step in which the spike was
+ * emitted, and the double offset of the spike in ms before the stamp.
+ *
+ * The file is read sequentially. Readers call release() for records they
+ * have passed, so that the pages can be dropped from memory and the
+ * resident size stays constant, whatever the length of the recording.
+ * Instances are not copied: the copy constructor creates a closed file,
+ * so that nodes can be copied from prototypes.
+ */
+class SpikeReplayFile
+{
+public:
+  struct Record
+  {
+    uint64_t gid;
+    int64_t step;
+    double offset;
+  };
+
+  SpikeReplayFile();
+  SpikeReplayFile( const SpikeReplayFile& );
+  ~SpikeReplayFile();
+
+  /**
+   * Map file with given name and check that the records are sorted by step
+   * and that their GIDs are in the range given in the header.
+   * @throws IOError if the file cannot be mapped or is not a valid spike
+   *         file.
+   */
+  void open( const std::string& filename );
+
+  void close();
+
+  bool
+  is_open() const
+  {
+    return base_ != 0;
+  }
+
+  const std::string&
+  get_filename() const
+  {
+    return filename_;
+  }
+
+  size_t
+  size() const
+  {
+    return size_;
+  }
+
+  uint64_t get_min_gid() const;
+  uint64_t get_max_gid() const;
+  double get_resolution() const;
+
+  const Record&
+  operator[]( size_t i ) const
+  {
+    return records_[ i ];
+  }
+
+  //! Index of first record at or after begin with a step of at least step
+  size_t lower_bound( size_t begin, int64_t step ) const;
+
+  //! Allow the kernel to drop the pages of all records before end
+  void release( size_t end );
+
+  /**
+   * Write spike file. Spike times are converted to steps and offsets with
+   * the current resolution, and spikes are sorted by step.
+   * @throws IOError if the file cannot be written.
+   */
+  static void write( const std::string& filename,
+    const std::vector< long >& gids,
+    const std::vector< double >& times );
+
+private:
+  SpikeReplayFile& operator=( const SpikeReplayFile& ); //!< not implemented
+
+  std::string filename_;
+  char* base_;             //!< start of mapped file, 0 if closed
+  size_t length_;          //!< length of mapped file
+  const Record* records_;  //!< first record
+  size_t size_;            //!< number of records
+  size_t released_;        //!< records before are released
+};
+
+} // namespace nest
+
+#endif /* SPIKE_REPLAY_FILE_H */
@@ -0,0 +1,93 @@
+/*
+ *  spike_stream.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef SPIKE_STREAM_H
+#define SPIKE_STREAM_H
+
+// C++ includes:
+#include <cstddef>
+#include <string>
+
+// Includes from nestkernel:
+#include "nest_time.h"
+#include "nest_types.h"
+
+namespace nest
+{
+
+/**
+ * Read-only view of all spikes exchanged at the end of a time slice.
+ *
+ * Spike i was emitted by node gids[ i ] in the time step ending at
+ * get_stamp( i ), with offset offsets[ i ] in ms before the end of the
+ * step; offsets are 0 unless off_grid_spiking is enabled. A spike of
+ * multiplicity n appears n times. Spikes are ordered by virtual process
+ * and, within each virtual process, by lag. The arrays are valid only
+ * during the call to SpikeStreamSubscriber::handle_spikes().
+ */
+struct SpikeBatch
+{
+  Time slice_origin; //!< beginning of the time slice
+  size_t size;       //!< number of spikes
+  const index* gids;
+  const long* lags; //!< steps after slice_origin, stamp minus one
+  const double* offsets;
+
+  Time
+  get_stamp( size_t i ) const
+  {
+    return slice_origin + Time::step( lags[ i ] + 1 );
+  }
+};
+
+/**
+ * Interface for in-process consumers of the spikes of the whole network,
+ * e.g., online decoders in extension modules.
+ *
+ * Subscribers are registered with
+ * EventDeliveryManager::register_spike_stream_subscriber(), typically in
+ * the init() function of a module, and are called once per time slice
+ * with the spikes of all processes, after the spikes have been exchanged.
+ * They are called by the master thread, while all other threads wait, and
+ * must not modify the network. The time spent in each subscriber is
+ * reported in the kernel status as spike_stream_times.
+ *
+ * Subscribers stay registered across ResetKernel, and must be
+ * unregistered before they are destroyed.
+ */
+class SpikeStreamSubscriber
+{
+public:
+  virtual ~SpikeStreamSubscriber()
+  {
+  }
+
+  //! Name under which the time spent is reported
+  virtual std::string get_name() const = 0;
+
+  //! Called once per time slice
+  virtual void handle_spikes( const SpikeBatch& ) = 0;
+};
+
+} // namespace nest
+
+#endif /* SPIKE_STREAM_H */
@@ -30,6 +30,7 @@
 #include "event.h"
 #include "nest_time.h"
 #include "nest_types.h"
+#include "population_data_buffer.h"
 #include "recordables_map.h"
 
 namespace nest
@@ -101,6 +102,10 @@ public:
    * data actually needs to be logged. Otherwise, data is simply
    * discarded.
    *
+   * If the request carries a PopulationDataBuffer, data is written
+   * directly into the buffer by record_data() and no DataLoggingReply
+   * is ever sent for it.
+   *
    * @param provides information about requested data and interval
    * @param map of access functions
    * @return rport for future logging requests
@@ -131,6 +136,13 @@ public:
    */
   void record_data( long );
 
+  //! Return true if at least one multimeter is connected to the host node
+  bool
+  has_loggers() const
+  {
+    return not data_loggers_.empty();
+  }
+
   //! Erase all existing data
   void reset();
 
@@ -165,6 +177,10 @@ private:
     index multimeter_; //!< GID of multimeter for which the logger works
     size_t num_vars_;  //!< number of variables recorded
 
+    //! Buffer to write to directly for population recording, else 0
+    PopulationDataBuffer* population_buffer_;
+    size_t population_column_; //!< column of host in population_buffer_
+
     Time recording_interval_; //!< interval between two recordings
     Time recording_offset_; //!< offset relative to which interval is calculated
     long rec_int_steps_;    //!< interval in steps
@@ -249,6 +265,8 @@ nest::UniversalDataLogger< HostNode >::DataLogger_::DataLogger_(
   const RecordablesMap< HostNode >& rmap )
   : multimeter_( req.get_sender().get_gid() )
   , num_vars_( 0 )
+  , population_buffer_( req.get_population_buffer() )
+  , population_column_( req.get_population_column() )
   , recording_interval_( Time::neg_inf() )
   , recording_offset_( Time::ms( 0. ) )
   , rec_int_steps_( 0 )
@@ -130,6 +130,12 @@ nest::UniversalDataLogger< HostNode >::DataLogger_::init()
       next_rec_step_ - rec_int_steps_ + recording_offset_.get_steps();
   }
 
+  // data is written directly to the population buffer
+  if ( population_buffer_ != 0 )
+  {
+    return;
+  }
+
   // number of data points per slice
   const long recs_per_slice =
     static_cast< long >( std::ceil( kernel().connection_manager.get_min_delay()
@@ -154,6 +160,22 @@ nest::UniversalDataLogger< HostNode >::DataLogger_::record_data(
     return;
   }
 
+  if ( population_buffer_ != 0 )
+  {
+    // step is left end of update interval, so add 1 for time stamp
+    double* const dest =
+      population_buffer_->get_entry( step + 1, population_column_ );
+    if ( dest != 0 )
+    {
+      for ( size_t j = 0; j < num_vars_; ++j )
+      {
+        dest[ j ] = ( ( host ).*( node_access_[ j ] ) )();
+      }
+    }
+    next_rec_step_ += rec_int_steps_;
+    return;
+  }
+
   const size_t wt = kernel().event_delivery_manager.write_toggle();
 
   assert( wt < next_rec_.size() );
@@ -22,6 +22,14 @@
 
 #include "vp_manager.h"
 
+// C includes:
+#ifdef HAVE_SCHED_GETCPU
+#include <sched.h>
+#endif
+
+// C++ includes:
+#include <vector>
+
 // Includes from libnestutil:
 #include "logging.h"
 
@@ -205,6 +213,40 @@ nest::VPManager::get_status( DictionaryDatum& d )
 {
   def< long >( d, names::local_num_threads, get_num_threads() );
   def< long >( d, names::total_num_virtual_procs, get_num_virtual_processes() );
+
+  // Report where the threads run, so that users can check that threads
+  // are bound to distinct cores, e.g. with OMP_PROC_BIND and OMP_PLACES.
+  std::string binding = "false";
+#if defined( _OPENMP ) && _OPENMP >= 201307
+  switch ( omp_get_proc_bind() )
+  {
+  case omp_proc_bind_true:
+    binding = "true";
+    break;
+  case omp_proc_bind_master:
+    binding = "master";
+    break;
+  case omp_proc_bind_close:
+    binding = "close";
+    break;
+  case omp_proc_bind_spread:
+    binding = "spread";
+    break;
+  default:
+    break;
+  }
+#endif
+  def< std::string >( d, names::thread_binding, binding );
+
+  // -1 if the CPU cannot be determined
+  std::vector< long > cpus( get_num_threads(), -1 );
+#ifdef HAVE_SCHED_GETCPU
+#pragma omp parallel
+  {
+    cpus[ get_thread_id() ] = sched_getcpu();
+  }
+#endif
+  def< std::vector< long > >( d, names::thread_cpus, cpus );
 }
 
 void
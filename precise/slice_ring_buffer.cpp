@@ -26,6 +26,8 @@
 #include <cmath>
 #include <limits>
 
+const size_t nest::SliceRingBuffer::sort_by_step_threshold_ = 4;
+
 nest::SliceRingBuffer::SliceRingBuffer()
   : refract_( std::numeric_limits< long >::max(), 0, 0 )
 {
@@ -71,7 +73,60 @@ nest::SliceRingBuffer::prepare_delivery()
     &( queue_[ kernel().event_delivery_manager.get_slice_modulo( 0 ) ] );
 
   // sort events, first event last
-  std::sort( deliver_->begin(), deliver_->end(), std::greater< SpikeInfo >() );
+  const long min_delay = kernel().connection_manager.get_min_delay();
+  if ( deliver_->size() < sort_by_step_threshold_ * min_delay
+    or not sort_by_step_(
+         kernel().simulation_manager.get_slice_origin().get_steps(),
+         min_delay ) )
+  {
+    std::sort(
+      deliver_->begin(), deliver_->end(), std::greater< SpikeInfo >() );
+  }
+}
+
+bool
+nest::SliceRingBuffer::sort_by_step_( const long origin, const long min_delay )
+{
+  // begin of the spikes of each step in sorted_, last step first
+  std::vector< size_t > begin( min_delay + 1, 0 );
+  for ( SliceSpikes::const_iterator it = deliver_->begin();
+        it != deliver_->end();
+        ++it )
+  {
+    const long step = it->stamp_ - origin;
+    if ( step < 0 or step >= min_delay )
+    {
+      return false;
+    }
+    ++begin[ min_delay - step ];
+  }
+  for ( long k = 1; k <= min_delay; ++k )
+  {
+    begin[ k ] += begin[ k - 1 ];
+  }
+
+  sorted_.resize( deliver_->size(), SpikeInfo( 0, 0., 0. ) );
+  for ( SliceSpikes::const_iterator it = deliver_->begin();
+        it != deliver_->end();
+        ++it )
+  {
+    sorted_[ begin[ min_delay - 1 - ( it->stamp_ - origin ) ]++ ] = *it;
+  }
+
+  // begin[ k ] now is the end of the spikes of step min_delay - 1 - k
+  SliceSpikes::iterator first = sorted_.begin();
+  for ( long k = 0; k < min_delay; ++k )
+  {
+    SliceSpikes::iterator last = sorted_.begin() + begin[ k ];
+    if ( last - first > 1 )
+    {
+      std::sort( first, last, std::greater< SpikeInfo >() );
+    }
+    first = last;
+  }
+
+  deliver_->swap( sorted_ );
+  return true;
 }
 
 void
@@ -34,6 +34,7 @@
 
 // Includes from nestkernel:
 #include "kernel_manager.h"
+#include "memory_accounting.h"
 #include "nest_types.h"
 
 namespace nest
@@ -52,6 +53,9 @@ namespace nest
  * - We have a pseudo-ring of Nbuff=ceil((min_del+max_del)/min_del) elements.
  *   Each element is a vector storing incoming spikes that
  *   are due during a given time slice.
+ * - If many spikes are due in a slice, prepare_delivery() first
+ *   distributes them over the time steps of the slice and then only
+ *   sorts the spikes due in the same step, see sort_by_step_().
  *
  * @note The following assumptions underlie the handling of
  * pseudo-events for return from refractoriness:
@@ -84,6 +88,8 @@ public:
 
   /**
    * Prepare for spike delivery in current slice by sorting.
+   * Slices with many spikes per time step are sorted by sort_by_step_(),
+   * others by a single sort.
    */
   void prepare_delivery();
 
@@ -144,11 +150,33 @@ private:
     double weight_;    //<! spike weight
   };
 
+  //! spikes due in one slice
+  typedef std::vector< SpikeInfo,
+    accounting_allocator< SpikeInfo, MEM_RING_BUFFERS > > SliceSpikes;
+
+  /**
+   * Sort the spikes of deliver_, first event last, by distributing them
+   * over the time steps of the slice starting at origin and sorting the
+   * spikes of each step. Returns false without changing deliver_ if a
+   * spike is not due in the slice.
+   */
+  bool sort_by_step_( const long origin, const long min_delay );
+
   //! entire queue, one slot per min_delay block within max_delay
-  std::vector< std::vector< SpikeInfo > > queue_;
+  std::vector< SliceSpikes,
+    accounting_allocator< SliceSpikes, MEM_RING_BUFFERS > > queue_;
 
   //! slot to deliver from
-  std::vector< SpikeInfo >* deliver_;
+  SliceSpikes* deliver_;
+
+  //! buffer for sort_by_step_(), swapped with deliver_
+  SliceSpikes sorted_;
+
+  /**
+   * Smallest mean number of spikes per time step of a slice for which
+   * prepare_delivery() sorts by step. Below, this does not pay off.
+   */
+  static const size_t sort_by_step_threshold_;
 
   SpikeInfo refract_; //!< pseudo-event for return from refractoriness
 };
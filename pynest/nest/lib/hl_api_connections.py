@@ -245,33 +245,30 @@ def Connect(pre, post, conn_spec=None, syn_spec=None, model=None):
             "'model' is an alias for 'syn_spec' and cannot "
             "be used together with 'syn_spec'.")
 
-    sps(pre)
-    sps(post)
-
     # default rule
     rule = 'all_to_all'
 
     if conn_spec is not None:
-        sps(conn_spec)
         if is_string(conn_spec):
             rule = conn_spec
-            sr("cvlit")
+            conn_spec = {'rule': conn_spec}
         elif isinstance(conn_spec, dict):
-            rule = conn_spec['rule']
+            conn_spec = dict(conn_spec)
+            rule = conn_spec.get('rule', rule)
         else:
             raise kernel.NESTError(
                 "conn_spec needs to be a string or dictionary.")
     else:
-        sr('/Connect /conn_spec GetOption')
+        conn_spec = {}
 
     if model is not None:
         syn_spec = model
 
     if syn_spec is not None:
         if is_string(syn_spec):
-            sps(syn_spec)
-            sr("cvlit")
+            syn_spec = {'model': syn_spec}
         elif isinstance(syn_spec, dict):
+            syn_spec = dict(syn_spec)
             for key, value in syn_spec.items():
 
                 # if value is a list, it is converted to a numpy array
@@ -340,12 +337,23 @@ def Connect(pre, post, conn_spec=None, syn_spec=None, model=None):
                                 "only be used in conjunction with rules "
                                 "'all_to_all', 'fixed_indegree' or "
                                 "'fixed_outdegree'.")
-            sps(syn_spec)
         else:
             raise kernel.NESTError(
                 "syn_spec needs to be a string or dictionary.")
-
-    sr('Connect')
+    else:
+        syn_spec = {}
+
+    # fill in missing entries from the options of the SLI function
+    # Connect, which hold the default rule and synapse model
+    if 'rule' not in conn_spec or 'model' not in syn_spec:
+        sr('/Connect GetOptions')
+        defaults = spp()
+        for key, value in defaults['conn_spec'].items():
+            conn_spec.setdefault(key, value)
+        for key, value in defaults['syn_spec'].items():
+            syn_spec.setdefault(key, value)
+
+    engine.connect(pre, post, conn_spec, syn_spec)
 
 
 @check_stack
@@ -38,7 +38,7 @@ from string import Template
 
 # These variables MUST be set by __init__.py right after importing.
 # There is no safety net, whatsoever.
-sps = spp = sr = pcd = kernel = None
+sps = spp = sr = pcd = kernel = engine = None
 
 
 # These flags are used to print deprecation warnings only once. The
@@ -320,6 +320,41 @@ def is_coercible_to_sli_array(seq):
         return isinstance(seq, (tuple, list, xrange))
 
 
+def is_numeric_column(seq, length):
+    """Checks whether seq is a sequence of integers or a sequence of floats
+    with the given length.
+
+    Parameters
+    ----------
+    seq : object
+        Object to check
+    length : int
+        Required length of the sequence
+
+    Returns
+    -------
+    bool:
+        True if object is a homogeneous numeric sequence of given length
+    """
+
+    import numbers
+
+    dtype = getattr(seq, 'dtype', None)
+    if dtype is not None:
+        return getattr(seq, 'ndim', 0) == 1 and len(seq) == length and \
+            dtype.kind in 'iuf'
+
+    if not isinstance(seq, (tuple, list)) or len(seq) != length:
+        return False
+
+    if all(isinstance(x, numbers.Integral) and not isinstance(x, bool)
+           for x in seq):
+        return True
+
+    return all(isinstance(x, numbers.Real) and
+               not isinstance(x, numbers.Integral) for x in seq)
+
+
 def is_sequence_of_connections(seq):
     """Checks whether low-level API accepts seq as a sequence of
     connections.
@@ -24,6 +24,7 @@ Functions to get information on NEST.
 """
 
 from .hl_api_helper import *
+import numpy
 import sys
 import os
 import webbrowser
@@ -199,6 +200,12 @@ def SetStatus(nodes, params, val=None):
         return
 
     if val is not None and is_literal(params):
+        if (is_numeric_column(val, len(nodes)) and
+                not is_sequence_of_connections(nodes) and 0 not in nodes):
+            # a column of numbers is passed on in one piece, so that the
+            # kernel can check the key once and set values in parallel
+            engine.set_status_columns(nodes, {params: val})
+            return
         if is_iterable(val) and not isinstance(val, (uni_str, dict)):
             params = [{params: x} for x in val]
         else:
@@ -212,12 +219,11 @@ def SetStatus(nodes, params, val=None):
 
     if is_sequence_of_connections(nodes):
         pcd(nodes)
+        sps(params)
+        sr('2 arraystore')
+        sr('Transpose { arrayload pop SetStatus } forall')
     else:
-        sps(nodes)
-
-    sps(params)
-    sr('2 arraystore')
-    sr('Transpose { arrayload pop SetStatus } forall')
+        engine.set_status(nodes, params)
 
 
 @check_stack
@@ -269,11 +275,89 @@ def GetStatus(nodes, keys=None):
     else:
         raise TypeError("keys should be either a string or an iterable")
 
-    if is_sequence_of_connections(nodes):
-        pcd(nodes)
-    else:
-        sps(nodes)
+    if not is_sequence_of_connections(nodes):
+        return engine.get_status(nodes, keys)
 
+    pcd(nodes)
     sr(cmd)
 
     return spp()
+
+
+@check_stack
+def GetStatusColumns(nodes, keys):
+    """Return the values of properties of nodes as arrays.
+
+    In contrast to GetStatus, which returns one list of values per node,
+    GetStatusColumns returns one array of values per property. Integer
+    and floating point properties are returned as NumPy arrays if NumPy is
+    available.
+
+    Parameters
+    ----------
+    nodes : list or tuple
+        List of global ids of local nodes
+    keys : str or list
+        String or a list of strings naming model properties
+
+    Returns
+    -------
+    dict:
+        Dictionary mapping each key to the values of all nodes
+
+    Raises
+    ------
+    TypeError
+        Description
+    """
+
+    if not is_coercible_to_sli_array(nodes):
+        raise TypeError("nodes must be a list of nodes")
+
+    if is_sequence_of_connections(nodes):
+        raise TypeError("GetStatusColumns does not support connections")
+
+    if is_literal(keys):
+        keys = [keys]
+    elif not is_iterable(keys):
+        raise TypeError("keys should be either a string or an iterable")
+
+    return engine.get_status_columns(nodes, keys)
+
+
+@check_stack
+def GetPopulationData(sampler):
+    """Return the data recorded by a population_multimeter as a matrix.
+
+    Parameters
+    ----------
+    sampler : list or tuple
+        List containing the global id of a single population_multimeter
+
+    Returns
+    -------
+    numpy.ndarray:
+        Recorded values with shape (number of sampling times, number of
+        recorded nodes, number of recorded variables). The sampling times
+        and the global ids of the recorded nodes are given by the entries
+        times and senders of the events dictionary of the sampler, the
+        variables by its record_from entry.
+
+    Raises
+    ------
+    TypeError
+        If sampler is not a single population_multimeter
+    """
+
+    if not is_coercible_to_sli_array(sampler) or len(sampler) != 1:
+        raise TypeError("sampler must be a list containing the global id "
+                        "of a single population_multimeter")
+
+    status = GetStatus(sampler)[0]
+    if status['model'] != 'population_multimeter':
+        raise TypeError("sampler must be a population_multimeter")
+
+    events = status['events']
+    return numpy.asarray(events['data']).reshape(
+        len(events['times']), len(events['senders']),
+        len(status['record_from']))
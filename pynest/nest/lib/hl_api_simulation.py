@@ -37,8 +37,7 @@ def Simulate(t):
         Time to simulate in ms
     """
 
-    sps(float(t))
-    sr('ms Simulate')
+    engine.simulate(float(t))
 
 
 @check_stack
@@ -60,8 +59,7 @@ def Run(t):
     behavior.
     """
 
-    sps(float(t))
-    sr('ms Run')
+    engine.run_simulation(float(t))
 
 
 @check_stack
@@ -193,6 +191,25 @@ def GetKernelStatus(keys=None):
         raise TypeError("keys should be either a string or an iterable")
 
 
+@check_stack
+def GetMemoryStatus():
+    """Obtain the memory used by the parts of the simulation kernel.
+
+    Values are given in bytes for the local MPI process, with one value
+    per thread unless noted otherwise. See the SLI documentation of
+    GetMemoryStatus for a description of all entries.
+
+    Returns
+    -------
+    dict:
+        Memory dictionary; 'nodes' and 'connections' map model names to
+        the memory of the respective model
+    """
+
+    sr('GetMemoryStatus')
+    return spp()
+
+
 @check_stack
 def Install(module_name):
     """Load a dynamically linked NEST module.
@@ -0,0 +1,283 @@
+# -*- coding: utf-8 -*-
+#
+# shm_stream.py
+#
+# This file is part of NEST.
+#
+# Copyright (C) 2004 The NEST Initiative
+#
+# NEST is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 2 of the License, or
+# (at your option) any later version.
+#
+# NEST is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+
+"""Reader and writer for the shared memory rings of NEST.
+
+Recorders with to_shm set to True write their events to a ring in POSIX
+shared memory, whose name is given in their status as shm_names. The
+shm_spike_generator and shm_current_generator read input from rings. This
+module gives access to these rings from another process, e.g., an
+environment in a closed-loop simulation, using the memory-mapped files in
+/dev/shm. See nestkernel/shm_ring_buffer.h for the layout.
+
+Examples
+--------
+Read spikes recorded by a spike detector:
+
+>>> nest.SetStatus(sd, {'to_shm': True, 'to_memory': False})
+>>> nest.Simulate(10.)
+>>> ring = ShmRing(nest.GetStatus(sd, 'shm_names')[0][0])
+>>> for sender, step, offset, weight, values in ring.read_events():
+...     print(sender, step)
+
+Send spikes to a shm_spike_generator:
+
+>>> ring = ShmRing.create('/input', 1 << 20)
+>>> ring.write_spikes([10., 12.5])
+>>> ring.publish()
+"""
+
+import mmap
+import os
+import struct
+
+__all__ = [
+    'ShmRing',
+    'PAD',
+    'EVENT',
+    'CURRENT',
+    'SPIKES',
+]
+
+PAD = 0
+EVENT = 1
+CURRENT = 2
+SPIKES = 3
+
+_MAGIC = b'NESTSHM1'
+_HEADER_SIZE = 128
+_LINE_SIZE = 64
+_SHM_DIR = '/dev/shm'
+
+
+def _round_up(n):
+    return (n + 7) & ~7
+
+
+class ShmRing(object):
+    """Memory-mapped ring of NEST in shared memory.
+
+    Head and tails are 8-byte aligned and are accessed with single loads
+    and stores, which are atomic on all platforms supported by NEST.
+    """
+
+    def __init__(self, name, _fd=None):
+        """Attach to an existing ring.
+
+        Parameters
+        ----------
+        name : str
+            Name of the ring, starting with a slash
+
+        Raises
+        ------
+        IOError
+            If the ring does not exist or is not a NEST ring
+        """
+
+        self.name = name
+        self._owner = _fd is not None
+        if _fd is None:
+            _fd = os.open(_SHM_DIR + name, os.O_RDWR)
+        try:
+            size = os.fstat(_fd).st_size
+            self._map = mmap.mmap(_fd, size)
+        finally:
+            os.close(_fd)
+
+        capacity, num_readers = struct.unpack_from('QQ', self._map, 8)
+        if (self._map[0:8] != _MAGIC or
+                _HEADER_SIZE + _LINE_SIZE * num_readers + capacity != size):
+            self._map.close()
+            raise IOError("Shared memory '%s' is not a NEST ring." % name)
+        self.capacity = capacity
+        self.num_readers = num_readers
+        self._data = _HEADER_SIZE + _LINE_SIZE * num_readers
+        self._staged = self._head()
+
+    @classmethod
+    def create(cls, name, capacity, num_readers=1):
+        """Create a ring, replacing any existing ring with the same name.
+
+        The ring is removed by close().
+
+        Parameters
+        ----------
+        name : str
+            Name of the ring, starting with a slash
+        capacity : int
+            Size of the data area in bytes
+        num_readers : int, optional
+            Number of readers, must be at least the number of threads for
+            the shm_current_generator
+
+        Returns
+        -------
+        ShmRing:
+            The new ring
+        """
+
+        capacity = _round_up(capacity)
+        path = _SHM_DIR + name
+        if os.path.exists(path):
+            os.unlink(path)
+        fd = os.open(path, os.O_RDWR | os.O_CREAT | os.O_EXCL, 0o600)
+        size = _HEADER_SIZE + _LINE_SIZE * num_readers + capacity
+        os.ftruncate(fd, size)
+        m = mmap.mmap(fd, size)
+        struct.pack_into('QQ', m, 8, capacity, num_readers)
+        m[0:8] = _MAGIC
+        m.close()
+        return cls(name, fd)
+
+    def close(self):
+        """Unmap the ring, and remove it if it was created by this object."""
+
+        self._map.close()
+        if self._owner:
+            os.unlink(_SHM_DIR + self.name)
+
+    def dropped(self):
+        """Return the number of records dropped because the ring was full."""
+
+        return struct.unpack_from('Q', self._map, 24)[0]
+
+    def _head(self):
+        return struct.unpack_from('Q', self._map, _LINE_SIZE)[0]
+
+    def _tail_offset(self, reader):
+        return _HEADER_SIZE + _LINE_SIZE * reader
+
+    def write(self, rtype, payload):
+        """Append a record, visible to readers after publish().
+
+        Parameters
+        ----------
+        rtype : int
+            Record type, one of EVENT, CURRENT and SPIKES
+        payload : bytes
+            Payload of the record
+
+        Returns
+        -------
+        bool:
+            False if the ring is full and the record was dropped
+        """
+
+        record_size = 8 + _round_up(len(payload))
+        pad = self.capacity - self._staged % self.capacity
+        if pad >= record_size:
+            pad = 0
+
+        min_tail = self._staged
+        for r in range(self.num_readers):
+            min_tail = min(min_tail, struct.unpack_from(
+                'Q', self._map, self._tail_offset(r))[0])
+        if self._staged + pad + record_size - min_tail > self.capacity:
+            struct.pack_into('Q', self._map, 24, self.dropped() + 1)
+            return False
+
+        if pad > 0:
+            struct.pack_into('II', self._map,
+                             self._data + self._staged % self.capacity,
+                             pad, PAD)
+            self._staged += pad
+
+        pos = self._data + self._staged % self.capacity
+        struct.pack_into('II', self._map, pos, record_size, rtype)
+        padded = payload + b'\0' * (record_size - 8 - len(payload))
+        self._map[pos + 8:pos + record_size] = padded
+        self._staged += record_size
+        return True
+
+    def write_spikes(self, times):
+        """Append a SPIKES record with the given spike times in ms."""
+
+        return self.write(SPIKES, struct.pack('%dd' % len(times), *times))
+
+    def write_current(self, time, amplitude):
+        """Append a CURRENT record, changing the amplitude at time in ms."""
+
+        return self.write(CURRENT, struct.pack('dd', time, amplitude))
+
+    def publish(self):
+        """Make all records written so far visible to readers."""
+
+        struct.pack_into('Q', self._map, _LINE_SIZE, self._staged)
+
+    def read(self, reader=0):
+        """Read the next record.
+
+        Parameters
+        ----------
+        reader : int, optional
+            Index of the reader
+
+        Returns
+        -------
+        tuple or None:
+            Record type and payload, None if there is no record
+
+        Raises
+        ------
+        IOError
+            If the ring holds a record of invalid size
+        """
+
+        toff = self._tail_offset(reader)
+        tail = struct.unpack_from('Q', self._map, toff)[0]
+        head = self._head()
+        while tail != head:
+            pos = self._data + tail % self.capacity
+            record_size, rtype = struct.unpack_from('II', self._map, pos)
+            if (record_size < 8 or record_size % 8 != 0 or
+                    record_size > self.capacity - tail % self.capacity or
+                    record_size > head - tail):
+                raise IOError("Shared memory '%s' holds a record of invalid "
+                              "size %d." % (self.name, record_size))
+            payload = self._map[pos + 8:pos + record_size]
+            tail += record_size
+            struct.pack_into('Q', self._map, toff, tail)
+            if rtype != PAD:
+                return rtype, payload
+        return None
+
+    def read_events(self, reader=0):
+        """Read all available EVENT records.
+
+        Returns
+        -------
+        list:
+            Tuples of sender, step, offset, weight and a tuple of values
+        """
+
+        events = []
+        rec = self.read(reader)
+        while rec is not None:
+            rtype, payload = rec
+            if rtype == EVENT:
+                sender, step, offset, weight = struct.unpack_from(
+                    'qqdd', payload)
+                n = (len(payload) - 32) // 8
+                values = struct.unpack_from('%dd' % n, payload, 32)
+                events.append((sender, step, offset, weight, values))
+            rec = self.read(reader)
+        return events
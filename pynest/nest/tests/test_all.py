@@ -48,11 +48,13 @@ from . import test_sp
 from . import test_parrot_neuron
 from . import test_stdp_triplet_synapse
 from . import test_weight_recorder
+from . import test_population_multimeter
 from . import test_aeif_lsodar
 from . import test_rate_neuron
 from . import test_rate_neuron_communication
 from . import test_siegert_neuron
 from . import test_use_gid_in_filename
+from . import test_shm_stream
 
 
 def suite():
@@ -83,11 +85,13 @@ def suite():
     suite.addTest(test_parrot_neuron.suite())
     suite.addTest(test_stdp_triplet_synapse.suite())
     suite.addTest(test_weight_recorder.suite())
+    suite.addTest(test_population_multimeter.suite())
     suite.addTest(test_aeif_lsodar.suite())
     suite.addTest(test_rate_neuron.suite())
     suite.addTest(test_rate_neuron_communication.suite())
     suite.addTest(test_siegert_neuron.suite())
     suite.addTest(test_use_gid_in_filename.suite())
+    suite.addTest(test_shm_stream.suite())
 
     return suite
 
@@ -75,6 +75,38 @@ class ErrorTestCase(unittest.TestCase):
         self.assertRaisesRegex(
             nest.NESTError, "UnknownModelName", nest.Create, -1)
 
+    def test_UnknownNodeStatus(self):
+        """Unknown node in status functions"""
+
+        nest.ResetKernel()
+
+        self.assertRaisesRegex(
+            nest.NESTError, "UnknownNode in GetStatus", nest.GetStatus, (99, ))
+        self.assertRaisesRegex(
+            nest.NESTError, "UnknownNode in SetStatus", nest.SetStatus, (99, ),
+            {'V_m': -70.0})
+
+    def test_UnknownStatusKey(self):
+        """Unknown key in status functions"""
+
+        nest.ResetKernel()
+        n = nest.Create('iaf_psc_alpha')
+
+        self.assertRaisesRegex(
+            nest.NESTError, "DictError in GetStatus: .*foo", nest.GetStatus,
+            n, 'foo')
+        self.assertRaisesRegex(
+            nest.NESTError, "DictError in SetStatus: .*foo", nest.SetStatus,
+            n, {'foo': 1.0})
+
+    def test_BadSimulationTime(self):
+        """Negative simulation time"""
+
+        nest.ResetKernel()
+
+        self.assertRaisesRegex(
+            nest.NESTError, "BadParameter in Simulate", nest.Simulate, -1.0)
+
 
 def suite():
     suite = unittest.makeSuite(ErrorTestCase, 'test')
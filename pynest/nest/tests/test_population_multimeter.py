@@ -0,0 +1,83 @@
+# -*- coding: utf-8 -*-
+#
+# test_population_multimeter.py
+#
+# This file is part of NEST.
+#
+# Copyright (C) 2004 The NEST Initiative
+#
+# NEST is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 2 of the License, or
+# (at your option) any later version.
+#
+# NEST is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+
+"""
+Test of population_multimeter and GetPopulationData
+"""
+
+import unittest
+import nest
+import numpy as np
+
+
+@nest.check_stack
+class PopulationMultimeterTestCase(unittest.TestCase):
+    """Tests for the population_multimeter"""
+
+    def setUp(self):
+
+        nest.ResetKernel()
+        nest.set_verbosity('M_ERROR')
+
+    def testDataMatchesMultimeter(self):
+        """Population data equals multimeter data"""
+
+        nrns = nest.Create('iaf_psc_alpha', 5,
+                           params=[{'I_e': 300. + 50. * i} for i in range(5)])
+        params = {'record_from': ['V_m', 'I_syn_ex'], 'interval': 0.5}
+        mm = nest.Create('multimeter', params=params)
+        pm = nest.Create('population_multimeter', params=params)
+        pg = nest.Create('poisson_generator', params={'rate': 5000.})
+        nest.Connect(pg, nrns)
+        nest.Connect(mm, nrns)
+        nest.Connect(pm, nrns)
+
+        nest.Simulate(20.)
+
+        data = nest.GetPopulationData(pm)
+        events = nest.GetStatus(pm, 'events')[0]
+        self.assertEqual(data.shape, (40, 5, 2))
+        self.assertEqual(list(events['senders']), list(nrns))
+
+        mmev = nest.GetStatus(mm, 'events')[0]
+        rows = np.round(mmev['times'] / 0.5).astype(int) - 1
+        cols = np.asarray(mmev['senders']) - nrns[0]
+        np.testing.assert_array_equal(data[rows, cols, 0], mmev['V_m'])
+        np.testing.assert_array_equal(data[rows, cols, 1], mmev['I_syn_ex'])
+
+    def testWrongDevice(self):
+        """GetPopulationData requires population_multimeter"""
+
+        mm = nest.Create('multimeter')
+        self.assertRaises(TypeError, nest.GetPopulationData, mm)
+
+
+def suite():
+
+    suite = unittest.TestLoader().loadTestsFromTestCase(
+        PopulationMultimeterTestCase)
+    return suite
+
+
+if __name__ == "__main__":
+
+    runner = unittest.TextTestRunner(verbosity=2)
+    runner.run(suite())
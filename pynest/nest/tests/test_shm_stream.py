@@ -0,0 +1,81 @@
+# -*- coding: utf-8 -*-
+#
+# test_shm_stream.py
+#
+# This file is part of NEST.
+#
+# Copyright (C) 2004 The NEST Initiative
+#
+# NEST is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 2 of the License, or
+# (at your option) any later version.
+#
+# NEST is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+
+"""
+Tests of the shared memory rings of nest.shm_stream
+"""
+
+import struct
+import unittest
+
+from nest import shm_stream
+
+
+class ShmStreamTestCase(unittest.TestCase):
+    """Reading and writing shared memory rings"""
+
+    def setUp(self):
+        self.ring = shm_stream.ShmRing.create('/test_shm_stream', 4096)
+
+    def tearDown(self):
+        self.ring.close()
+
+    def test_ReadWrite(self):
+        """Records are read in the order written"""
+
+        self.ring.write_spikes([10., 12.5])
+        self.ring.write_current(1., 100.)
+        self.ring.publish()
+
+        rtype, payload = self.ring.read()
+        self.assertEqual(rtype, shm_stream.SPIKES)
+        self.assertEqual(struct.unpack('2d', payload), (10., 12.5))
+        rtype, payload = self.ring.read()
+        self.assertEqual(rtype, shm_stream.CURRENT)
+        self.assertEqual(struct.unpack('2d', payload), (1., 100.))
+        self.assertEqual(self.ring.read(), None)
+
+    def test_InvalidRecordSize(self):
+        """Records of invalid size are rejected"""
+
+        # a record of 24 bytes is written at the start of the data area, so
+        # that valid sizes are multiples of 8 from 8 to 24
+        for size in (0, 4, 12, 32, 8192):
+            self.ring.close()
+            self.ring = shm_stream.ShmRing.create('/test_shm_stream', 4096)
+            self.ring.write_spikes([10., 12.5])
+            self.ring.publish()
+            struct.pack_into('I', self.ring._map, self.ring._data, size)
+            self.assertRaises(IOError, self.ring.read)
+
+
+def suite():
+    suite = unittest.makeSuite(ShmStreamTestCase, 'test')
+    return suite
+
+
+def run():
+    runner = unittest.TextTestRunner(verbosity=2)
+    runner.run(suite())
+
+
+if __name__ == "__main__":
+    run()
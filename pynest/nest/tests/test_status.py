@@ -176,6 +176,46 @@ class StatusTestCase(unittest.TestCase):
                 nest.SetStatus(n, 'V_m', 3.)
                 self.assertEqual(nest.GetStatus(n, 'V_m')[0], 3.)
 
+    def test_SetStatusColumn(self):
+        """SetStatus with parameter and list of values"""
+
+        nest.ResetKernel()
+        nest.SetKernelStatus({'local_num_threads': 2})
+
+        n = nest.Create('iaf_psc_alpha', 5) + nest.Create('iaf_psc_exp', 5)
+        v_m = [-70. + i for i in range(len(n))]
+
+        nest.SetStatus(n, 'V_m', v_m)
+        self.assertEqual(list(nest.GetStatus(n, 'V_m')), v_m)
+
+        nest.SetStatus(n, 'I_e', tuple(10. * x for x in v_m))
+        self.assertEqual(list(nest.GetStatus(n, 'I_e')),
+                         [10. * x for x in v_m])
+
+        self.assertRaisesRegex(
+            nest.NESTError, "DictError",
+            nest.SetStatus, n, 'nonexistent_status_key', v_m)
+
+    def test_GetStatusColumns(self):
+        """GetStatusColumns"""
+
+        nest.ResetKernel()
+        nest.SetKernelStatus({'local_num_threads': 2})
+
+        n = nest.Create('iaf_psc_alpha', 4)
+        nest.SetStatus(n, [{'V_m': -70. + i} for i in range(len(n))])
+
+        columns = nest.GetStatusColumns(n, ['V_m', 'model'])
+        self.assertEqual(list(columns['V_m']), list(nest.GetStatus(n, 'V_m')))
+        self.assertEqual(list(columns['model']), ['iaf_psc_alpha'] * len(n))
+
+        self.assertEqual(list(nest.GetStatusColumns(n, 'V_m')['V_m']),
+                         list(nest.GetStatus(n, 'V_m')))
+
+        self.assertRaisesRegex(
+            nest.NESTError, "DictError",
+            nest.GetStatusColumns, n, 'nonexistent_status_key')
+
     def test_SetStatusVth_E_L(self):
         """SetStatus of reversal and threshold potential """
 
@@ -29,6 +29,8 @@ from cpython.ref cimport PyObject
 
 cdef extern from "name.h":
     cppclass Name:
+        Name()
+        Name(const string&)
         string toString() except +
 
 cdef extern from "datum.h":
@@ -100,6 +102,10 @@ cdef extern from "arraydatum.h":
     cppclass DoubleVectorDatum:
         DoubleVectorDatum(vector[double]*) except +
 
+cdef extern from "gid_collection.h" namespace "nest":
+    cppclass GIDCollection:
+        GIDCollection(IntVectorDatum) except +
+
 cdef extern from "dict.h":
     cppclass Dictionary:
         Dictionary() except +
@@ -113,6 +119,7 @@ cdef extern from "dictdatum.h":
             Token second
 
     cppclass DictionaryDatum:
+        DictionaryDatum() except +
         DictionaryDatum(Dictionary *) except +
         void insert(const string&, Datum*) except +
         TokenMap.const_iterator begin()
@@ -137,6 +144,25 @@ cdef extern from "neststartup.h":
     int neststartup(int*, char***, SLIInterpreter&, string) except +
     void nestshutdown(int) except +
 
+    void current_exception "CYTHON_currentException" (string&, string&)
+
+
+# Kernel functions called directly, bypassing the interpreter. Exceptions
+# are translated into NESTErrors by raise_kernel_error.
+#
+cdef int raise_kernel_error() except -1
+
+cdef extern from "nest.h":
+    void kernel_simulate "nest::simulate" (const double&) except +raise_kernel_error
+    void kernel_run "nest::run" (const double&) except +raise_kernel_error
+    void kernel_set_kernel_status "nest::set_kernel_status" (const DictionaryDatum&) except +raise_kernel_error
+    DictionaryDatum kernel_get_kernel_status "nest::get_kernel_status" () except +raise_kernel_error
+    void kernel_set_node_status "nest::set_node_status" (const long, const DictionaryDatum&) except +raise_kernel_error
+    DictionaryDatum kernel_get_node_status "nest::get_node_status" (const long) except +raise_kernel_error
+    void kernel_set_node_status_columns "nest::set_node_status_columns" (const vector[long]&, const DictionaryDatum&) except +raise_kernel_error
+    DictionaryDatum kernel_get_node_status_columns "nest::get_node_status_columns" (const vector[long]&, const vector[Name]&) except +raise_kernel_error
+    void kernel_connect "nest::connect" (const GIDCollection&, const GIDCollection&, const DictionaryDatum&, const DictionaryDatum&) except +raise_kernel_error
+
 
 cdef extern from *:
 
@@ -153,6 +179,8 @@ cdef extern from *:
 
     TokenMap.const_iterator deref_tmap "CYTHON_DEREF" (TokenMap.const_iterator)
 
+    Datum* dict_lookup "CYTHON_DICT_LOOKUP" (DictionaryDatum*, const string&) except +raise_kernel_error
+
     vector[long]* deref_ivector "&*CYTHON_DEREF" (IntVectorDatum*)
     vector[double]* deref_dvector "&*CYTHON_DEREF" (DoubleVectorDatum*)
 
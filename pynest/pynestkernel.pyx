@@ -80,6 +80,24 @@ class NESTError(Exception):
     pass
 
 
+# Name of the API function calling the kernel directly, reported in the
+# errors raised by raise_kernel_error()
+cdef unicode kernel_caller = u""
+
+cdef int raise_kernel_error() except -1:
+
+    cdef string errorname
+    cdef string message
+
+    current_exception(errorname, message)
+
+    errorstring = u"{0} in {1}".format(errorname.decode('utf-8'), kernel_caller)
+    if message.size() > 0:
+        errorstring += u": " + message.decode('utf-8')
+
+    raise NESTError(errorstring)
+
+
 cdef class SLIDatum(object):
 
     cdef Datum* thisptr
@@ -263,6 +281,185 @@ cdef class NESTEngine(object):
             del connectome
             raise
 
+    # The following functions call the kernel directly instead of
+    # executing SLI code. Arguments and results are converted without
+    # going through the interpreter stack.
+
+    def simulate(self, double t):
+
+        if self.pEngine is NULL:
+            raise NESTError("engine uninitialized")
+
+        global kernel_caller
+        kernel_caller = u"Simulate"
+
+        kernel_simulate(t)
+
+    def run_simulation(self, double t):
+
+        if self.pEngine is NULL:
+            raise NESTError("engine uninitialized")
+
+        global kernel_caller
+        kernel_caller = u"Run"
+
+        kernel_run(t)
+
+    def set_status(self, nodes, params):
+
+        if self.pEngine is NULL:
+            raise NESTError("engine uninitialized")
+
+        cdef long gid
+        cdef DictionaryDatum* dd = NULL
+
+        global kernel_caller
+        kernel_caller = u"SetStatus"
+
+        for node, node_params in zip(nodes, params):
+            if not isinstance(node_params, dict):
+                raise TypeError("params must be a dict or a list of dicts")
+
+            gid = node
+            dd = <DictionaryDatum*> python_object_to_datum(node_params)
+            try:
+                if gid == 0:
+                    kernel_set_kernel_status(deref(dd))
+                else:
+                    kernel_set_node_status(gid, deref(dd))
+            finally:
+                del dd
+
+    def get_status(self, nodes, keys=None):
+
+        if self.pEngine is NULL:
+            raise NESTError("engine uninitialized")
+
+        cdef long gid
+        cdef DictionaryDatum status
+        cdef vector[string] key_strs
+
+        global kernel_caller
+        kernel_caller = u"GetStatus"
+
+        single_key = isinstance(keys, (str, unicode, SLILiteral))
+        if keys is not None:
+            for key in ([keys] if single_key else keys):
+                key_strs.push_back(str(key).encode())
+
+        result = [None] * len(nodes)
+
+        for i, node in enumerate(nodes):
+            gid = node
+            if gid == 0:
+                status = kernel_get_kernel_status()
+            else:
+                status = kernel_get_node_status(gid)
+
+            if keys is None:
+                result[i] = sli_dict_to_object(&status)
+            elif single_key:
+                result[i] = sli_datum_to_object(dict_lookup(&status, key_strs[0]))
+            else:
+                result[i] = tuple([sli_datum_to_object(dict_lookup(&status, k))
+                                   for k in key_strs])
+
+        return tuple(result)
+
+    def set_status_columns(self, nodes, columns):
+
+        if self.pEngine is NULL:
+            raise NESTError("engine uninitialized")
+
+        if not isinstance(columns, dict):
+            raise TypeError("columns must be a dict")
+
+        cdef vector[long] gids
+        cdef DictionaryDatum* dd = NULL
+
+        global kernel_caller
+        kernel_caller = u"SetStatus"
+
+        gids.reserve(len(nodes))
+        for gid in nodes:
+            gids.push_back(gid)
+
+        dd = <DictionaryDatum*> python_object_to_datum(columns)
+        try:
+            kernel_set_node_status_columns(gids, deref(dd))
+        finally:
+            del dd
+
+    def get_status_columns(self, nodes, keys):
+
+        if self.pEngine is NULL:
+            raise NESTError("engine uninitialized")
+
+        cdef vector[long] gids
+        cdef vector[Name] names
+        cdef DictionaryDatum columns
+
+        global kernel_caller
+        kernel_caller = u"GetStatus"
+
+        gids.reserve(len(nodes))
+        for gid in nodes:
+            gids.push_back(gid)
+
+        for key in keys:
+            names.push_back(Name(<string> str(key).encode()))
+
+        columns = kernel_get_node_status_columns(gids, names)
+
+        return sli_dict_to_object(&columns)
+
+    def connect(self, pre, post, conn_spec, syn_spec):
+
+        if self.pEngine is NULL:
+            raise NESTError("engine uninitialized")
+
+        if not isinstance(conn_spec, dict) or not isinstance(syn_spec, dict):
+            raise TypeError("conn_spec and syn_spec must be dicts")
+
+        cdef GIDCollection* sources = NULL
+        cdef GIDCollection* targets = NULL
+        cdef DictionaryDatum* conn_dict = NULL
+        cdef DictionaryDatum* syn_dict = NULL
+
+        global kernel_caller
+        kernel_caller = u"Connect"
+
+        try:
+            sources = python_object_to_gid_collection(pre)
+            targets = python_object_to_gid_collection(post)
+            conn_dict = <DictionaryDatum*> python_object_to_datum(conn_spec)
+            syn_dict = <DictionaryDatum*> python_object_to_datum(syn_spec)
+
+            kernel_connect(deref(sources), deref(targets),
+                           deref(conn_dict), deref(syn_dict))
+        finally:
+            del sources
+            del targets
+            del conn_dict
+            del syn_dict
+
+cdef GIDCollection* python_object_to_gid_collection(obj) except NULL:
+
+    cdef vector[long]* gids = new vector[long]()
+    cdef IntVectorDatum* gids_datum = new IntVectorDatum(gids)
+    cdef GIDCollection* ret = NULL
+
+    try:
+        gids.reserve(len(obj))
+        for gid in obj:
+            gids.push_back(gid)
+
+        ret = new GIDCollection(deref(gids_datum))
+    finally:
+        del gids_datum
+
+    return ret
+
 cdef inline Datum* python_object_to_datum(obj) except NULL:
 
     cdef Datum* ret = NULL
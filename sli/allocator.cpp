@@ -22,6 +22,9 @@
 
 #include "allocator.h"
 
+// C++ includes:
+#include <algorithm>
+
 sli::pool::pool()
   : initial_block_size( 1024 )
   , growth_factor( 1 )
@@ -150,6 +153,61 @@ sli::pool::reserve_additional( size_t n )
   }
 }
 
+sli::arena::arena( size_t chunk_size )
+  : chunk_size_( chunk_size )
+  , chunks_( 0 )
+  , head_( 0 )
+  , capacity_( 0 )
+  , free_lists_( max_size / alignment + 1, static_cast< link* >( 0 ) )
+  , chunk_bytes_( 0 )
+  , large_bytes_( 0 )
+  , used_( 0 )
+  , free_( 0 )
+  , waste_( 0 )
+{
+  // the chunk header must not break the alignment of the objects
+  assert( sizeof( chunk ) <= alignment );
+  assert( chunk_size_ >= max_size + alignment );
+}
+
+sli::arena::~arena()
+{
+  release();
+}
+
+void
+sli::arena::new_chunk_()
+{
+  // The chunk header occupies the first alignment bytes of the chunk.
+  // operator new returns memory suitably aligned for any object.
+  char* mem = static_cast< char* >( ::operator new( chunk_size_ ) );
+  chunk* c = reinterpret_cast< chunk* >( mem );
+  c->next = chunks_;
+  chunks_ = c;
+  waste_ += capacity_;
+  head_ = mem + alignment;
+  capacity_ = chunk_size_ - alignment;
+  chunk_bytes_ += chunk_size_;
+}
+
+void
+sli::arena::release()
+{
+  while ( chunks_ != 0 )
+  {
+    chunk* c = chunks_;
+    chunks_ = c->next;
+    ::operator delete( c );
+  }
+  head_ = 0;
+  capacity_ = 0;
+  std::fill( free_lists_.begin(), free_lists_.end(), static_cast< link* >( 0 ) );
+  chunk_bytes_ = 0;
+  large_bytes_ = 0;
+  used_ = 0;
+  free_ = 0;
+  waste_ = 0;
+}
 
 // --- Code below is for the PoorMan's Allocator
 #ifdef USE_PMA
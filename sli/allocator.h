@@ -30,6 +30,7 @@
 #include <cassert>
 #include <cstdlib>
 #include <string>
+#include <vector>
 
 namespace sli
 {
@@ -195,6 +196,149 @@ pool::get_total() const
 {
   return total;
 }
+
+/**
+ * arena is a slab allocator for small objects of varying size, such as
+ * the connectors of one thread.
+ *
+ * Requests are rounded up to a multiple of the alignment and carved
+ * from large chunks of memory. Freed objects are kept in one free list
+ * per size class and handed out again for requests of the same class.
+ * Objects larger than max_size are passed on to the global operator new.
+ *
+ * An arena is not thread-safe; each thread must use its own arena. An
+ * object may be freed to another arena than the one it was allocated
+ * from, as long as all arenas are released together. Its bytes are then
+ * credited to the arena freeing it, so that only the sum of used bytes
+ * over all arenas is exact.
+ * @ingroup MemoryManagement
+ */
+class arena
+{
+  struct link
+  {
+    link* next;
+  };
+
+  struct chunk
+  {
+    chunk* next;
+  };
+
+  arena( const arena& );            //!< not implemented
+  arena& operator=( const arena& ); //!< not implemented
+
+  size_t chunk_size_; //!< bytes per chunk
+  chunk* chunks_;     //!< linked list of memory chunks
+  char* head_;        //!< next free byte in current chunk
+  size_t capacity_;   //!< bytes left in current chunk
+
+  std::vector< link* > free_lists_; //!< one free list per size class
+
+  size_t chunk_bytes_; //!< bytes in chunks
+  long large_bytes_;   //!< bytes in objects larger than max_size
+  long used_;          //!< bytes handed out minus bytes freed
+  size_t free_;        //!< bytes held in free lists
+  size_t waste_;       //!< bytes left unused at the end of full chunks
+
+  void new_chunk_();
+
+  static size_t
+  size_class_( size_t n )
+  {
+    return ( n + alignment - 1 ) / alignment;
+  }
+
+public:
+  static const size_t alignment = 16;  //!< all objects are aligned to this
+  static const size_t max_size = 1024; //!< larger objects bypass the arena
+
+  explicit arena( size_t chunk_size = 1048576 );
+  ~arena(); //!< deallocate ALL memory
+
+  void* alloc( size_t n );        //!< allocate object of n bytes
+  void free( void* p, size_t n ); //!< return object of n bytes
+
+  /**
+   * Give all chunks back to the system. All objects must have been
+   * freed before.
+   */
+  void release();
+
+  /** Bytes obtained from the system. */
+  long
+  get_allocated() const
+  {
+    return chunk_bytes_ + large_bytes_;
+  }
+
+  /** Bytes occupied by live objects, including rounding. */
+  long
+  get_used() const
+  {
+    return used_;
+  }
+
+  /**
+   * Bytes neither in use nor available for new objects without
+   * recycling, i.e., freed objects waiting for reuse and chunk tails
+   * that were too short for a request.
+   */
+  size_t
+  get_fragmented() const
+  {
+    return free_ + waste_;
+  }
+};
+
+inline void*
+arena::alloc( size_t n )
+{
+  const size_t c = size_class_( n );
+  const size_t bytes = c * alignment;
+  used_ += bytes;
+  if ( bytes > max_size )
+  {
+    large_bytes_ += bytes;
+    return ::operator new( n );
+  }
+
+  link* p = free_lists_[ c ];
+  if ( p != 0 )
+  {
+    free_lists_[ c ] = p->next;
+    free_ -= bytes;
+    return p;
+  }
+
+  if ( capacity_ < bytes )
+  {
+    new_chunk_();
+  }
+  void* q = head_;
+  head_ += bytes;
+  capacity_ -= bytes;
+  return q;
+}
+
+inline void
+arena::free( void* p, size_t n )
+{
+  const size_t c = size_class_( n );
+  const size_t bytes = c * alignment;
+  used_ -= bytes;
+  if ( bytes > max_size )
+  {
+    large_bytes_ -= bytes;
+    ::operator delete( p );
+    return;
+  }
+
+  link* l = static_cast< link* >( p );
+  l->next = free_lists_[ c ];
+  free_lists_[ c ] = l;
+  free_ += bytes;
+}
 }
 
 #ifdef USE_PMA
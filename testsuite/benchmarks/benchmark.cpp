@@ -0,0 +1,226 @@
+/*
+ *  benchmark.cpp
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "benchmark.h"
+
+// C++ includes:
+#include <algorithm>
+#include <cstdio>
+#include <sstream>
+
+// Includes from libnestutil:
+#include "compose.hpp"
+
+namespace
+{
+// largest number of iterations of a single run
+const size_t max_iterations = 1000000000;
+
+volatile double sink;
+}
+
+nest::benchmark::State::State( size_t iterations, long arg )
+  : iterations_( iterations )
+  , remaining_( iterations )
+  , started_( false )
+  , arg_( arg )
+  , items_per_iteration_( 0 )
+  , timer_()
+{
+}
+
+bool
+nest::benchmark::State::keep_running()
+{
+  if ( not started_ )
+  {
+    started_ = true;
+    timer_.start();
+  }
+  if ( remaining_ == 0 )
+  {
+    timer_.stop();
+    return false;
+  }
+  --remaining_;
+  return true;
+}
+
+void
+nest::benchmark::State::pause_timing()
+{
+  timer_.stop();
+}
+
+void
+nest::benchmark::State::resume_timing()
+{
+  timer_.start();
+}
+
+double
+nest::benchmark::State::get_elapsed() const
+{
+  return timer_.elapsed();
+}
+
+void
+nest::benchmark::Registry::add( const std::string& name,
+  Function function,
+  long arg )
+{
+  Benchmark b;
+  b.name = arg < 0 ? name : String::compose( "%1/%2", name, arg );
+  b.function = function;
+  b.arg = arg;
+  benchmarks_.push_back( b );
+}
+
+nest::benchmark::Result
+nest::benchmark::run( const Benchmark& b,
+  double min_time,
+  size_t repetitions )
+{
+  Result result;
+  result.name = b.name;
+
+  // the first runs also warm up caches and allocators
+  size_t n = 1;
+  double elapsed = 0;
+  while ( true )
+  {
+    State state( n, b.arg );
+    b.function( state );
+    elapsed = state.get_elapsed();
+    result.items_per_iteration = state.get_items_per_iteration();
+    if ( elapsed >= min_time or n >= max_iterations )
+    {
+      break;
+    }
+
+    // aim somewhat above min_time, but grow by at most a factor of 10, as
+    // the first runs are short and their times inaccurate
+    double factor = 10;
+    if ( elapsed > 0.1 * min_time )
+    {
+      factor = 1.4 * min_time / elapsed;
+    }
+    n = std::min( max_iterations,
+      std::max( n + 1, static_cast< size_t >( n * factor ) ) );
+  }
+
+  result.iterations = n;
+  result.times.push_back( elapsed / n );
+  for ( size_t r = 1; r < repetitions; ++r )
+  {
+    State state( n, b.arg );
+    b.function( state );
+    result.times.push_back( state.get_elapsed() / n );
+  }
+  return result;
+}
+
+std::string
+nest::benchmark::json_string( const std::string& s )
+{
+  std::string quoted = "\"";
+  for ( std::string::const_iterator c = s.begin(); c != s.end(); ++c )
+  {
+    switch ( *c )
+    {
+    case '"':
+      quoted += "\\\"";
+      break;
+    case '\\':
+      quoted += "\\\\";
+      break;
+    case '\n':
+      quoted += "\\n";
+      break;
+    case '\t':
+      quoted += "\\t";
+      break;
+    default:
+      if ( static_cast< unsigned char >( *c ) < 0x20 )
+      {
+        char code[ 7 ];
+        std::sprintf( code, "\\u%04x", *c );
+        quoted += code;
+      }
+      else
+      {
+        quoted += *c;
+      }
+    }
+  }
+  return quoted + "\"";
+}
+
+void
+nest::benchmark::write_json( std::ostream& out,
+  const std::vector< std::pair< std::string, std::string > >& context,
+  const std::vector< Result >& results )
+{
+  out << "{\n  \"context\": {";
+  for ( size_t i = 0; i < context.size(); ++i )
+  {
+    out << ( i == 0 ? "\n" : ",\n" ) << "    "
+        << json_string( context[ i ].first ) << ": " << context[ i ].second;
+  }
+  out << "\n  },\n  \"benchmarks\": [";
+
+  for ( size_t i = 0; i < results.size(); ++i )
+  {
+    const Result& r = results[ i ];
+    std::vector< double > times = r.times;
+    std::sort( times.begin(), times.end() );
+    const double median = times.size() % 2 == 1
+      ? times[ times.size() / 2 ]
+      : 0.5 * ( times[ times.size() / 2 - 1 ] + times[ times.size() / 2 ] );
+
+    std::ostringstream entry;
+    entry.precision( 6 );
+    entry << "\n    {\n"
+          << "      \"name\": " << json_string( r.name ) << ",\n"
+          << "      \"iterations\": " << r.iterations << ",\n"
+          << "      \"repetitions\": " << times.size() << ",\n"
+          << "      \"time_per_iteration_ns\": " << median * 1e9 << ",\n"
+          << "      \"min_time_per_iteration_ns\": " << times.front() * 1e9
+          << ",\n"
+          << "      \"max_time_per_iteration_ns\": " << times.back() * 1e9;
+    if ( r.items_per_iteration > 0 and median > 0 )
+    {
+      entry << ",\n      \"items_per_iteration\": " << r.items_per_iteration
+            << ",\n      \"items_per_second\": "
+            << r.items_per_iteration / median;
+    }
+    entry << "\n    }";
+    out << ( i == 0 ? "" : "," ) << entry.str();
+  }
+  out << "\n  ]\n}\n";
+}
+
+void
+nest::benchmark::consume( double value )
+{
+  sink = value;
+}
@@ -0,0 +1,176 @@
+/*
+ *  benchmark.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+// C++ includes:
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Includes from libnestutil:
+#include "stopwatch.h"
+
+namespace nest
+{
+namespace benchmark
+{
+
+/**
+ * Measurement state passed to each benchmark.
+ *
+ * A benchmark sets up its data, then runs the code to be measured in a
+ * loop of the form
+ *
+ *   while ( state.keep_running() )
+ *   {
+ *     ...
+ *   }
+ *
+ * The loop body is executed get_iterations() times, and only the loop is
+ * timed. Work inside the loop that should not be measured is enclosed in
+ * pause_timing() and resume_timing().
+ */
+class State
+{
+public:
+  State( size_t iterations, long arg );
+
+  bool keep_running();
+
+  void pause_timing();
+  void resume_timing();
+
+  //! Parameter of the benchmark, e.g., the fan-out, -1 if none
+  long
+  get_arg() const
+  {
+    return arg_;
+  }
+
+  size_t
+  get_iterations() const
+  {
+    return iterations_;
+  }
+
+  /**
+   * Set number of items processed per iteration, e.g., the number of
+   * connections a spike is delivered to, to report items per second.
+   */
+  void
+  set_items_per_iteration( double n )
+  {
+    items_per_iteration_ = n;
+  }
+
+  double
+  get_items_per_iteration() const
+  {
+    return items_per_iteration_;
+  }
+
+  //! Time spent in the loop in seconds
+  double get_elapsed() const;
+
+private:
+  size_t iterations_;
+  size_t remaining_;
+  bool started_;
+  long arg_;
+  double items_per_iteration_;
+  Stopwatch timer_;
+};
+
+typedef void ( *Function )( State& );
+
+struct Benchmark
+{
+  std::string name;
+  Function function;
+  long arg;
+};
+
+/**
+ * List of all benchmarks, filled by the register_*_benchmarks() functions
+ * below.
+ */
+class Registry
+{
+public:
+  /**
+   * Add benchmark. If arg is not negative, it is passed to the benchmark
+   * and appended to the name, e.g., send/static_synapse/100.
+   */
+  void add( const std::string& name, Function, long arg = -1 );
+
+  const std::vector< Benchmark >&
+  get_benchmarks() const
+  {
+    return benchmarks_;
+  }
+
+private:
+  std::vector< Benchmark > benchmarks_;
+};
+
+struct Result
+{
+  std::string name;
+  size_t iterations;
+  std::vector< double > times; //!< seconds per iteration, per repetition
+  double items_per_iteration;
+};
+
+/**
+ * Run benchmark with increasing numbers of iterations until a run takes at
+ * least min_time seconds, then repeat the last run repetitions times.
+ */
+Result run( const Benchmark&, double min_time, size_t repetitions );
+
+/**
+ * Write results as JSON object with members context, holding the given
+ * pairs of keys and JSON values, and benchmarks, with one entry per result.
+ */
+void write_json( std::ostream&,
+  const std::vector< std::pair< std::string, std::string > >& context,
+  const std::vector< Result >& );
+
+//! Quote and escape string for JSON output
+std::string json_string( const std::string& );
+
+/**
+ * Pass value to a function the compiler cannot see into, so that the
+ * computation of the value is not optimized away.
+ */
+void consume( double );
+
+void register_kernel_benchmarks( Registry& );
+void register_random_benchmarks( Registry& );
+void register_topology_benchmarks( Registry& );
+
+} // namespace benchmark
+} // namespace nest
+
+#endif /* BENCHMARK_H */
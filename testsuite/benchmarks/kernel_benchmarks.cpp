@@ -0,0 +1,545 @@
+/*
+ *  kernel_benchmarks.cpp
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "benchmark.h"
+
+// C++ includes:
+#include <cassert>
+#include <deque>
+#include <string>
+#include <vector>
+
+// Includes from nestkernel:
+#include "archiving_node.h"
+#include "event.h"
+#include "gid_collection.h"
+#include "histentry.h"
+#include "kernel_manager.h"
+#include "nest.h"
+#include "nest_names.h"
+#include "node.h"
+#include "ring_buffer.h"
+
+// Includes from librandom:
+#include "knuthlfg.h"
+
+// Includes from precise:
+#include "slice_ring_buffer.h"
+
+// Includes from sli:
+#include "dictdatum.h"
+#include "doubledatum.h"
+#include "integerdatum.h"
+#include "namedatum.h"
+
+using nest::benchmark::State;
+using nest::kernel;
+
+namespace
+{
+
+// number of targets of the spikes in the event delivery benchmarks
+const long delivery_targets = 1000;
+const long delivery_outdegree = 100;
+
+// number of neurons in the update benchmarks
+const long update_neurons = 1000;
+
+DictionaryDatum
+rule_spec_( const std::string& rule )
+{
+  DictionaryDatum d( new Dictionary );
+  ( *d )[ nest::names::rule ] = LiteralDatum( rule );
+  return d;
+}
+
+DictionaryDatum
+synapse_spec_( const std::string& model )
+{
+  DictionaryDatum d( new Dictionary );
+  ( *d )[ nest::names::model ] = LiteralDatum( model );
+  return d;
+}
+
+void
+ring_buffer_add_value( State& state )
+{
+  nest::reset_kernel();
+  nest::prepare();
+
+  nest::RingBuffer buffer;
+  const long size = kernel().connection_manager.get_min_delay()
+    + kernel().connection_manager.get_max_delay();
+  long offs = 0;
+  while ( state.keep_running() )
+  {
+    buffer.add_value( offs, 1.0 );
+    offs = offs + 1 == size ? 0 : offs + 1;
+  }
+  nest::benchmark::consume( buffer.get_value( 0 ) );
+
+  nest::cleanup();
+  state.set_items_per_iteration( 1 );
+}
+
+void
+ring_buffer_get_value( State& state )
+{
+  nest::reset_kernel();
+  nest::prepare();
+
+  nest::RingBuffer buffer;
+  const long min_delay = kernel().connection_manager.get_min_delay();
+  long offs = 0;
+  double sum = 0;
+  while ( state.keep_running() )
+  {
+    sum += buffer.get_value( offs );
+    offs = offs + 1 == min_delay ? 0 : offs + 1;
+  }
+  nest::benchmark::consume( sum );
+
+  nest::cleanup();
+  state.set_items_per_iteration( 1 );
+}
+
+/**
+ * Queue as many precise spikes due in the current slice as given by the
+ * argument, in random order as from many sources, and retrieve them in
+ * temporal order, as a precise neuron does during one slice.
+ */
+void
+slice_ring_buffer_deliver( State& state )
+{
+  nest::reset_kernel();
+  DictionaryDatum delays( new Dictionary );
+  ( *delays )[ nest::names::min_delay ] = 1.;
+  ( *delays )[ nest::names::max_delay ] = 2.;
+  nest::set_kernel_status( delays );
+  nest::prepare();
+
+  const long n_spikes = state.get_arg();
+  const long min_delay = kernel().connection_manager.get_min_delay();
+  const long origin =
+    kernel().simulation_manager.get_slice_origin().get_steps();
+  librandom::KnuthLFG rng( 12345 );
+  std::vector< long > lags( n_spikes );
+  std::vector< double > offsets( n_spikes );
+  for ( long i = 0; i < n_spikes; ++i )
+  {
+    lags[ i ] = rng.ulrand( min_delay );
+    offsets[ i ] = rng.drand() * nest::Time::get_resolution().get_ms();
+  }
+
+  nest::SliceRingBuffer buffer;
+  buffer.resize();
+  double sum = 0;
+  while ( state.keep_running() )
+  {
+    for ( long i = 0; i < n_spikes; ++i )
+    {
+      buffer.add_spike( lags[ i ], origin + lags[ i ], offsets[ i ], 1. );
+    }
+    buffer.prepare_delivery();
+
+    double offset;
+    double weight;
+    bool end_of_refract;
+    for ( long lag = 0; lag < min_delay; ++lag )
+    {
+      while ( buffer.get_next_spike(
+        origin + lag, false, offset, weight, end_of_refract ) )
+      {
+        sum += weight;
+      }
+    }
+  }
+  nest::benchmark::consume( sum );
+
+  nest::cleanup();
+  state.set_items_per_iteration( n_spikes );
+}
+
+/**
+ * Deliver a spike to all targets of a source with ConnectionManager::send(),
+ * with the fan-out given as argument.
+ */
+void
+send_( State& state, const std::string& synapse_model )
+{
+  nest::reset_kernel();
+  const long fan_out = state.get_arg();
+  const nest::index source = nest::create( "parrot_neuron", 1 );
+  const nest::index last = nest::create( "iaf_psc_alpha", fan_out );
+  nest::connect( nest::GIDCollection( source, source ),
+    nest::GIDCollection( last - fan_out + 1, last ),
+    rule_spec_( "all_to_all" ),
+    synapse_spec_( synapse_model ) );
+  nest::prepare();
+
+  nest::SpikeEvent e;
+  e.set_stamp( kernel().simulation_manager.get_clock() );
+  e.set_sender_gid( source );
+  while ( state.keep_running() )
+  {
+    kernel().connection_manager.send( 0, source, e );
+  }
+
+  nest::cleanup();
+  state.set_items_per_iteration( fan_out );
+}
+
+void
+send_static_synapse( State& state )
+{
+  send_( state, "static_synapse" );
+}
+
+void
+send_tsodyks_synapse( State& state )
+{
+  send_( state, "tsodyks_synapse" );
+}
+
+void
+send_stdp_synapse( State& state )
+{
+  send_( state, "stdp_synapse" );
+}
+
+/**
+ * Create as many parrot neurons as given by the argument, each connected
+ * to delivery_outdegree out of delivery_targets neurons.
+ */
+void
+prepare_delivery_( State& state )
+{
+  nest::reset_kernel();
+  const long n_sources = state.get_arg();
+  nest::create( "parrot_neuron", n_sources );
+  nest::create( "iaf_psc_alpha", delivery_targets );
+
+  DictionaryDatum conn_spec = rule_spec_( "fixed_outdegree" );
+  ( *conn_spec )[ nest::names::outdegree ] = delivery_outdegree;
+  nest::connect( nest::GIDCollection( 1, n_sources ),
+    nest::GIDCollection( n_sources + 1, n_sources + delivery_targets ),
+    conn_spec,
+    synapse_spec_( "static_synapse" ) );
+  nest::prepare();
+}
+
+//! Let each source spike once, spread over the time slice
+void
+fill_spike_register_( State& state )
+{
+  const long min_delay = kernel().connection_manager.get_min_delay();
+  for ( long gid = 1; gid <= state.get_arg(); ++gid )
+  {
+    kernel().event_delivery_manager.send_remote_as(
+      0, gid, gid % min_delay, 0. );
+  }
+}
+
+void
+event_delivery_gather_events( State& state )
+{
+  prepare_delivery_( state );
+  while ( state.keep_running() )
+  {
+    state.pause_timing();
+    fill_spike_register_( state );
+    state.resume_timing();
+
+    kernel().event_delivery_manager.gather_events( true );
+  }
+
+  nest::cleanup();
+  state.set_items_per_iteration( state.get_arg() );
+}
+
+void
+event_delivery_deliver_events( State& state )
+{
+  prepare_delivery_( state );
+  while ( state.keep_running() )
+  {
+    state.pause_timing();
+    fill_spike_register_( state );
+    kernel().event_delivery_manager.gather_events( true );
+    state.resume_timing();
+
+    kernel().event_delivery_manager.deliver_events( 0 );
+  }
+
+  nest::cleanup();
+  state.set_items_per_iteration( state.get_arg() * delivery_outdegree );
+}
+
+/**
+ * Connect two populations with the number of neurons given as argument
+ * and the given connection rule.
+ */
+void
+connect_( State& state, const DictionaryDatum& conn_spec )
+{
+  const long n = state.get_arg();
+  const DictionaryDatum syn_spec = synapse_spec_( "static_synapse" );
+  while ( state.keep_running() )
+  {
+    state.pause_timing();
+    nest::reset_kernel();
+    nest::create( "iaf_psc_alpha", 2 * n );
+    state.resume_timing();
+
+    nest::connect( nest::GIDCollection( 1, n ),
+      nest::GIDCollection( n + 1, 2 * n ),
+      conn_spec,
+      syn_spec );
+  }
+  state.set_items_per_iteration(
+    kernel().connection_manager.get_num_connections() );
+}
+
+void
+connect_one_to_one( State& state )
+{
+  connect_( state, rule_spec_( "one_to_one" ) );
+}
+
+void
+connect_all_to_all( State& state )
+{
+  connect_( state, rule_spec_( "all_to_all" ) );
+}
+
+void
+connect_fixed_indegree( State& state )
+{
+  DictionaryDatum conn_spec = rule_spec_( "fixed_indegree" );
+  ( *conn_spec )[ nest::names::indegree ] = 100;
+  connect_( state, conn_spec );
+}
+
+void
+connect_fixed_outdegree( State& state )
+{
+  DictionaryDatum conn_spec = rule_spec_( "fixed_outdegree" );
+  ( *conn_spec )[ nest::names::outdegree ] = 100;
+  connect_( state, conn_spec );
+}
+
+void
+connect_fixed_total_number( State& state )
+{
+  DictionaryDatum conn_spec = rule_spec_( "fixed_total_number" );
+  // the rule scales superlinearly with N, keep the run time short
+  ( *conn_spec )[ nest::names::N ] = 10 * state.get_arg();
+  connect_( state, conn_spec );
+}
+
+void
+connect_pairwise_bernoulli( State& state )
+{
+  DictionaryDatum conn_spec = rule_spec_( "pairwise_bernoulli" );
+  ( *conn_spec )[ nest::names::p ] = 0.1;
+  connect_( state, conn_spec );
+}
+
+/**
+ * Read the spike history of a neuron in windows of 20 ms, as an STDP
+ * synapse with a presynaptic rate of 50 Hz does.
+ */
+void
+archiving_node_get_history( State& state )
+{
+  nest::reset_kernel();
+
+  // an incoming STDP connection makes the neuron keep its spike history
+  const nest::index source = nest::create( "parrot_neuron", 1 );
+  const nest::index neuron = nest::create( "iaf_psc_alpha", 1 );
+  DictionaryDatum params( new Dictionary );
+  ( *params )[ nest::names::I_e ] = 1000.;
+  nest::set_node_status( neuron, params );
+  nest::connect( nest::GIDCollection( source, source ),
+    nest::GIDCollection( neuron, neuron ),
+    rule_spec_( "all_to_all" ),
+    synapse_spec_( "stdp_synapse" ) );
+  nest::simulate( 10000. );
+
+  nest::Archiving_Node* node = dynamic_cast< nest::Archiving_Node* >(
+    kernel().node_manager.get_node( neuron ) );
+  assert( node != 0 );
+  const double t_max = kernel().simulation_manager.get_time().get_ms();
+
+  std::deque< nest::histentry >::iterator start;
+  std::deque< nest::histentry >::iterator finish;
+  double t = 0;
+  long n_entries = 0;
+  while ( state.keep_running() )
+  {
+    node->get_history( t, t + 20., &start, &finish );
+    n_entries += finish - start;
+    t = t + 20. < t_max ? t + 20. : 0;
+  }
+  nest::benchmark::consume( n_entries );
+  state.set_items_per_iteration( 1 );
+}
+
+/**
+ * Update neurons at rest for one time slice each.
+ */
+void
+update_( State& state, const std::string& model )
+{
+  nest::reset_kernel();
+  const nest::index last = nest::create( model, update_neurons );
+  nest::prepare();
+
+  std::vector< nest::Node* > nodes;
+  for ( nest::index gid = last - update_neurons + 1; gid <= last; ++gid )
+  {
+    nodes.push_back( kernel().node_manager.get_node( gid ) );
+  }
+  const nest::Time origin = kernel().simulation_manager.get_slice_origin();
+  const long steps = kernel().connection_manager.get_min_delay();
+  while ( state.keep_running() )
+  {
+    for ( std::vector< nest::Node* >::iterator n = nodes.begin();
+          n != nodes.end();
+          ++n )
+    {
+      ( *n )->update( origin, 0, steps );
+    }
+  }
+
+  nest::cleanup();
+  state.set_items_per_iteration( update_neurons * steps );
+}
+
+void
+update_iaf_psc_alpha( State& state )
+{
+  update_( state, "iaf_psc_alpha" );
+}
+
+void
+update_iaf_psc_exp( State& state )
+{
+  update_( state, "iaf_psc_exp" );
+}
+
+void
+update_iaf_psc_delta( State& state )
+{
+  update_( state, "iaf_psc_delta" );
+}
+
+void
+update_iaf_cond_exp( State& state )
+{
+  update_( state, "iaf_cond_exp" );
+}
+
+void
+update_aeif_cond_alpha( State& state )
+{
+  update_( state, "aeif_cond_alpha" );
+}
+
+void
+update_hh_psc_alpha( State& state )
+{
+  update_( state, "hh_psc_alpha" );
+}
+
+bool
+have_model_( const std::string& model )
+{
+  return kernel().model_manager.get_modeldict()->known( model );
+}
+
+} // namespace
+
+void
+nest::benchmark::register_kernel_benchmarks( Registry& registry )
+{
+  registry.add( "ring_buffer/add_value", ring_buffer_add_value );
+  registry.add( "ring_buffer/get_value", ring_buffer_get_value );
+
+  // spikes per slice of 10 steps, below and above the threshold of
+  // SliceRingBuffer for sorting by step
+  const long queued_spikes[] = { 2, 20, 200, 1000 };
+  for ( size_t i = 0; i < sizeof( queued_spikes ) / sizeof( long ); ++i )
+  {
+    registry.add( "slice_ring_buffer/deliver",
+      slice_ring_buffer_deliver,
+      queued_spikes[ i ] );
+  }
+
+  const long fan_outs[] = { 1, 10, 100, 1000 };
+  for ( size_t i = 0; i < sizeof( fan_outs ) / sizeof( long ); ++i )
+  {
+    registry.add( "send/static_synapse", send_static_synapse, fan_outs[ i ] );
+    registry.add(
+      "send/tsodyks_synapse", send_tsodyks_synapse, fan_outs[ i ] );
+    registry.add( "send/stdp_synapse", send_stdp_synapse, fan_outs[ i ] );
+  }
+
+  const long n_spikes[] = { 100, 1000, 10000 };
+  for ( size_t i = 0; i < sizeof( n_spikes ) / sizeof( long ); ++i )
+  {
+    registry.add( "event_delivery/gather_events",
+      event_delivery_gather_events,
+      n_spikes[ i ] );
+    registry.add( "event_delivery/deliver_events",
+      event_delivery_deliver_events,
+      n_spikes[ i ] );
+  }
+
+  registry.add( "connect/one_to_one", connect_one_to_one, 1000 );
+  registry.add( "connect/all_to_all", connect_all_to_all, 1000 );
+  registry.add( "connect/fixed_indegree", connect_fixed_indegree, 1000 );
+  registry.add( "connect/fixed_outdegree", connect_fixed_outdegree, 1000 );
+  registry.add(
+    "connect/fixed_total_number", connect_fixed_total_number, 1000 );
+  registry.add(
+    "connect/pairwise_bernoulli", connect_pairwise_bernoulli, 1000 );
+
+  registry.add( "archiving_node/get_history", archiving_node_get_history );
+
+  registry.add( "update/iaf_psc_alpha", update_iaf_psc_alpha );
+  registry.add( "update/iaf_psc_exp", update_iaf_psc_exp );
+  registry.add( "update/iaf_psc_delta", update_iaf_psc_delta );
+  // models that depend on the GSL
+  if ( have_model_( "iaf_cond_exp" ) )
+  {
+    registry.add( "update/iaf_cond_exp", update_iaf_cond_exp );
+  }
+  if ( have_model_( "aeif_cond_alpha" ) )
+  {
+    registry.add( "update/aeif_cond_alpha", update_aeif_cond_alpha );
+  }
+  if ( have_model_( "hh_psc_alpha" ) )
+  {
+    registry.add( "update/hh_psc_alpha", update_hh_psc_alpha );
+  }
+}
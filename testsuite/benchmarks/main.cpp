@@ -0,0 +1,292 @@
+/*
+ *  main.cpp
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/*
+ * nest_benchmarks - microbenchmarks of the NEST kernel
+ *
+ * Usage: nest_benchmarks [--filter=text] [--min-time=seconds]
+ *                        [--repetitions=n] [--out=file] [--list]
+ *
+ * Runs all benchmarks whose name contains the filter text and writes the
+ * results as JSON to the given file or to stdout. Each benchmark is run
+ * until it takes at least min-time seconds (default 0.5), then repeated
+ * repetitions times in all (default 3). The JSON output holds the build and
+ * host of the run in "context" and, for each benchmark, the median, minimum
+ * and maximum time per iteration in "benchmarks".
+ *
+ * All benchmarks run on a single thread.
+ */
+
+// C includes:
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+
+// C++ includes:
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Generated includes:
+#include "config.h"
+#include "static_modules.h"
+
+// Includes from libnestutil:
+#include "logging.h"
+
+// Includes from nestkernel:
+#include "kernel_manager.h"
+#include "nest.h"
+#include "nestmodule.h"
+
+// Includes from sli:
+#include "dictdatum.h"
+#include "interpret.h"
+#include "sliexceptions.h"
+
+#include "benchmark.h"
+
+namespace
+{
+
+typedef std::vector< std::pair< std::string, std::string > > Context;
+
+template < typename T >
+std::string
+to_json_( const T& value )
+{
+  std::ostringstream s;
+  s << value;
+  return s.str();
+}
+
+std::string
+to_json_( bool value )
+{
+  return value ? "true" : "false";
+}
+
+std::string
+cpu_model_()
+{
+  std::ifstream cpuinfo( "/proc/cpuinfo" );
+  std::string line;
+  while ( std::getline( cpuinfo, line ) )
+  {
+    if ( line.compare( 0, 10, "model name" ) == 0 )
+    {
+      const size_t colon = line.find( ':' );
+      return colon == std::string::npos ? "" : line.substr( colon + 2 );
+    }
+  }
+  return "";
+}
+
+Context
+context_( const char* executable, double min_time, size_t repetitions )
+{
+  using nest::benchmark::json_string;
+
+  char date[ 32 ];
+  const time_t now = time( 0 );
+  strftime( date, sizeof( date ), "%Y-%m-%dT%H:%M:%S%z", localtime( &now ) );
+
+  char host_name[ 256 ] = "";
+  gethostname( host_name, sizeof( host_name ) - 1 );
+
+#ifdef HAVE_GSL
+  const bool have_gsl = true;
+#else
+  const bool have_gsl = false;
+#endif
+#ifdef HAVE_MPI
+  const bool have_mpi = true;
+#else
+  const bool have_mpi = false;
+#endif
+#ifdef _OPENMP
+  const bool have_openmp = true;
+#else
+  const bool have_openmp = false;
+#endif
+#ifdef NDEBUG
+  const bool assertions = false;
+#else
+  const bool assertions = true;
+#endif
+
+  Context context;
+  context.push_back( std::make_pair( "date", json_string( date ) ) );
+  context.push_back( std::make_pair( "host_name", json_string( host_name ) ) );
+  context.push_back(
+    std::make_pair( "executable", json_string( executable ) ) );
+  context.push_back(
+    std::make_pair( "nest_version", json_string( NEST_VERSION_PRGNAME ) ) );
+  context.push_back( std::make_pair( "host", json_string( NEST_HOST ) ) );
+  context.push_back(
+    std::make_pair( "cpu_model", json_string( cpu_model_() ) ) );
+  context.push_back( std::make_pair(
+    "num_cpus", to_json_( sysconf( _SC_NPROCESSORS_ONLN ) ) ) );
+#ifdef __VERSION__
+  context.push_back( std::make_pair( "compiler", json_string( __VERSION__ ) ) );
+#endif
+  context.push_back(
+    std::make_pair( "build_type", json_string( NEST_BENCHMARKS_BUILD_TYPE ) ) );
+  context.push_back(
+    std::make_pair( "cxx_flags", json_string( NEST_BENCHMARKS_CXX_FLAGS ) ) );
+  context.push_back( std::make_pair( "assertions", to_json_( assertions ) ) );
+  context.push_back( std::make_pair( "openmp", to_json_( have_openmp ) ) );
+  context.push_back( std::make_pair( "mpi", to_json_( have_mpi ) ) );
+  context.push_back( std::make_pair( "gsl", to_json_( have_gsl ) ) );
+  context.push_back( std::make_pair( "num_threads", to_json_( 1 ) ) );
+  context.push_back( std::make_pair( "min_time", to_json_( min_time ) ) );
+  context.push_back(
+    std::make_pair( "repetitions", to_json_( repetitions ) ) );
+  return context;
+}
+
+void
+usage_( const char* executable )
+{
+  std::cerr << "Usage: " << executable
+            << " [--filter=text] [--min-time=seconds] [--repetitions=n]"
+               " [--out=file] [--list]"
+            << std::endl;
+}
+
+} // namespace
+
+int
+main( int argc, char* argv[] )
+{
+  std::string filter;
+  double min_time = 0.5;
+  long repetitions = 3;
+  std::string out_file;
+  bool list = false;
+  for ( int i = 1; i < argc; ++i )
+  {
+    const std::string arg = argv[ i ];
+    if ( arg.compare( 0, 9, "--filter=" ) == 0 )
+    {
+      filter = arg.substr( 9 );
+    }
+    else if ( arg.compare( 0, 11, "--min-time=" ) == 0 )
+    {
+      min_time = atof( arg.substr( 11 ).c_str() );
+    }
+    else if ( arg.compare( 0, 14, "--repetitions=" ) == 0 )
+    {
+      repetitions = atol( arg.substr( 14 ).c_str() );
+    }
+    else if ( arg.compare( 0, 6, "--out=" ) == 0 )
+    {
+      out_file = arg.substr( 6 );
+    }
+    else if ( arg == "--list" )
+    {
+      list = true;
+    }
+    else
+    {
+      usage_( argv[ 0 ] );
+      return 1;
+    }
+  }
+  if ( min_time <= 0 or repetitions < 1 )
+  {
+    usage_( argv[ 0 ] );
+    return 1;
+  }
+
+  // The kernel and the built-in modules are set up as by the nest
+  // executable, but no SLI code is run. NestModule registers the
+  // connection rules and expects the statusdict of the SLI startup. The
+  // interpreter must not be global, see nest/main.cpp.
+  SLIInterpreter engine;
+  int kernel_argc = 1;
+  char** kernel_argv = argv;
+  nest::init_nest( &kernel_argc, &kernel_argv );
+  engine.def( "statusdict", DictionaryDatum( new Dictionary ) );
+  addmodule< nest::NestModule >( engine );
+  add_static_modules( engine );
+  nest::kernel().logging_manager.set_logging_level( nest::M_ERROR );
+
+  nest::benchmark::Registry registry;
+  nest::benchmark::register_kernel_benchmarks( registry );
+  nest::benchmark::register_random_benchmarks( registry );
+  nest::benchmark::register_topology_benchmarks( registry );
+
+  std::vector< nest::benchmark::Result > results;
+  const std::vector< nest::benchmark::Benchmark >& benchmarks =
+    registry.get_benchmarks();
+  for ( size_t i = 0; i < benchmarks.size(); ++i )
+  {
+    if ( benchmarks[ i ].name.find( filter ) == std::string::npos )
+    {
+      continue;
+    }
+    if ( list )
+    {
+      std::cout << benchmarks[ i ].name << std::endl;
+      continue;
+    }
+    std::cerr << benchmarks[ i ].name << std::endl;
+    try
+    {
+      results.push_back(
+        nest::benchmark::run( benchmarks[ i ], min_time, repetitions ) );
+    }
+    catch ( SLIException& e )
+    {
+      std::cerr << benchmarks[ i ].name << " failed: " << e.what() << ": "
+                << e.message() << std::endl;
+      return 1;
+    }
+  }
+
+  if ( not list )
+  {
+    const Context context = context_( argv[ 0 ], min_time, repetitions );
+    if ( out_file.empty() )
+    {
+      nest::benchmark::write_json( std::cout, context, results );
+    }
+    else
+    {
+      std::ofstream out( out_file.c_str() );
+      nest::benchmark::write_json( out, context, results );
+      if ( not out )
+      {
+        std::cerr << "Cannot write " << out_file << std::endl;
+        return 1;
+      }
+    }
+  }
+
+  nest::kernel().mpi_manager.mpi_finalize( 0 );
+  nest::KernelManager::destroy_kernel_manager();
+  return 0;
+}
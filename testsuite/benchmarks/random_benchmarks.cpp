@@ -0,0 +1,131 @@
+/*
+ *  random_benchmarks.cpp
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "benchmark.h"
+
+// Includes from librandom:
+#include "binomial_randomdev.h"
+#include "exp_randomdev.h"
+#include "gamma_randomdev.h"
+#include "knuthlfg.h"
+#include "mt19937.h"
+#include "normal_randomdev.h"
+#include "poisson_randomdev.h"
+#include "randomgen.h"
+
+using nest::benchmark::State;
+
+namespace
+{
+
+const unsigned long seed = 12345;
+
+/**
+ * Draw numbers from a random deviate, with the Knuth lagged Fibonacci
+ * generator that NEST uses by default.
+ */
+void
+draw_( State& state, const librandom::RandomDev& dev )
+{
+  librandom::RngPtr rng( new librandom::KnuthLFG( seed ) );
+  double sum = 0;
+  while ( state.keep_running() )
+  {
+    sum += dev( rng );
+  }
+  nest::benchmark::consume( sum );
+  state.set_items_per_iteration( 1 );
+}
+
+void
+random_gen_knuthlfg( State& state )
+{
+  librandom::KnuthLFG rng( seed );
+  double sum = 0;
+  while ( state.keep_running() )
+  {
+    sum += rng.drand();
+  }
+  nest::benchmark::consume( sum );
+  state.set_items_per_iteration( 1 );
+}
+
+void
+random_gen_mt19937( State& state )
+{
+  librandom::MT19937 rng( seed );
+  double sum = 0;
+  while ( state.keep_running() )
+  {
+    sum += rng.drand();
+  }
+  nest::benchmark::consume( sum );
+  state.set_items_per_iteration( 1 );
+}
+
+void
+random_dev_normal( State& state )
+{
+  draw_( state, librandom::NormalRandomDev() );
+}
+
+void
+random_dev_exponential( State& state )
+{
+  draw_( state, librandom::ExpRandomDev() );
+}
+
+void
+random_dev_gamma( State& state )
+{
+  draw_( state, librandom::GammaRandomDev( 2.5 ) );
+}
+
+//! Poisson deviate with the mean given as argument
+void
+random_dev_poisson( State& state )
+{
+  draw_( state, librandom::PoissonRandomDev( state.get_arg() ) );
+}
+
+//! Binomial deviate with p = 0.1 and the number of trials given as argument
+void
+random_dev_binomial( State& state )
+{
+  draw_( state, librandom::BinomialRandomDev( 0.1, state.get_arg() ) );
+}
+
+} // namespace
+
+void
+nest::benchmark::register_random_benchmarks( Registry& registry )
+{
+  registry.add( "random_gen/knuthlfg", random_gen_knuthlfg );
+  registry.add( "random_gen/mt19937", random_gen_mt19937 );
+  registry.add( "random_dev/normal", random_dev_normal );
+  registry.add( "random_dev/exponential", random_dev_exponential );
+  registry.add( "random_dev/gamma", random_dev_gamma );
+  registry.add( "random_dev/poisson", random_dev_poisson, 1 );
+  registry.add( "random_dev/poisson", random_dev_poisson, 100 );
+  registry.add( "random_dev/binomial", random_dev_binomial, 10 );
+  registry.add( "random_dev/binomial", random_dev_binomial, 1000 );
+}
@@ -0,0 +1,134 @@
+/*
+ *  topology_benchmarks.cpp
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "benchmark.h"
+
+// C++ includes:
+#include <vector>
+
+// Includes from librandom:
+#include "knuthlfg.h"
+
+// Includes from topology:
+#include "mask.h"
+#include "mask_impl.h"
+#include "ntree.h"
+#include "ntree_impl.h"
+#include "position.h"
+
+using nest::benchmark::State;
+
+namespace
+{
+
+// number of points tested against masks, a power of two
+const size_t n_points = 4096;
+
+//! Points uniformly distributed in the unit square
+std::vector< nest::Position< 2 > >
+random_points_( size_t n )
+{
+  librandom::KnuthLFG rng( 12345 );
+  std::vector< nest::Position< 2 > > points;
+  for ( size_t i = 0; i < n; ++i )
+  {
+    const double x = rng.drand();
+    points.push_back( nest::Position< 2 >( x, rng.drand() ) );
+  }
+  return points;
+}
+
+void
+inside_( State& state, const nest::Mask< 2 >& mask )
+{
+  const std::vector< nest::Position< 2 > > points = random_points_( n_points );
+  size_t i = 0;
+  long n_inside = 0;
+  while ( state.keep_running() )
+  {
+    n_inside += mask.inside( points[ i ] );
+    i = ( i + 1 ) & ( n_points - 1 );
+  }
+  nest::benchmark::consume( n_inside );
+  state.set_items_per_iteration( 1 );
+}
+
+void
+mask_inside_ball( State& state )
+{
+  inside_(
+    state, nest::BallMask< 2 >( nest::Position< 2 >( 0.5, 0.5 ), 0.2 ) );
+}
+
+void
+mask_inside_box( State& state )
+{
+  const nest::Position< 2 > lower_left( 0.3, 0.3 );
+  const nest::Position< 2 > upper_right( 0.7, 0.7 );
+  inside_( state, nest::BoxMask< 2 >( lower_left, upper_right ) );
+}
+
+/**
+ * Find all nodes within a circular mask around a random anchor, among as
+ * many nodes as given by the argument, as when connecting layers.
+ */
+void
+ntree_masked_query( State& state )
+{
+  const std::vector< nest::Position< 2 > > points =
+    random_points_( state.get_arg() );
+  nest::Ntree< 2, nest::index > tree(
+    nest::Position< 2 >( 0., 0. ), nest::Position< 2 >( 1., 1. ) );
+  for ( size_t i = 0; i < points.size(); ++i )
+  {
+    tree.insert( points[ i ], i );
+  }
+
+  const std::vector< nest::Position< 2 > > anchors = random_points_( n_points );
+  const nest::BallMask< 2 > mask( nest::Position< 2 >( 0., 0. ), 0.1 );
+  size_t i = 0;
+  long n_found = 0;
+  while ( state.keep_running() )
+  {
+    for ( nest::Ntree< 2, nest::index >::masked_iterator it =
+            tree.masked_begin( mask, anchors[ i ] );
+          it != tree.masked_end();
+          ++it )
+    {
+      ++n_found;
+    }
+    i = ( i + 1 ) & ( n_points - 1 );
+  }
+  nest::benchmark::consume( n_found );
+  state.set_items_per_iteration( 1 );
+}
+
+} // namespace
+
+void
+nest::benchmark::register_topology_benchmarks( Registry& registry )
+{
+  registry.add( "topology/mask_inside/ball", mask_inside_ball );
+  registry.add( "topology/mask_inside/box", mask_inside_box );
+  registry.add( "topology/ntree_masked_query", ntree_masked_query, 1000 );
+  registry.add( "topology/ntree_masked_query", ntree_masked_query, 100000 );
+}
@@ -0,0 +1,250 @@
+/*
+ *  test_spike_stream.cpp
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/*
+ * test_spike_stream - compare the spike stream with a spike_detector
+ *
+ * Registers a SpikeStreamSubscriber that records the sender and precise
+ * time of each spike it is passed, simulates a network driven by a Poisson
+ * generator with on-grid, off-grid and compact off-grid spiking, each with
+ * a min_delay of one and of several steps, and checks that the subscriber
+ * receives exactly the spikes recorded by a spike_detector. As the
+ * spike_detector receives the spikes of a time slice only in the next
+ * slice, it is read after another min_delay.
+ *
+ * Exits with code 1 if the test fails.
+ */
+
+// C includes:
+#include <math.h>
+
+// C++ includes:
+#include <algorithm>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Generated includes:
+#include "config.h"
+#include "static_modules.h"
+
+// Includes from libnestutil:
+#include "logging.h"
+
+// Includes from nestkernel:
+#include "gid_collection.h"
+#include "kernel_manager.h"
+#include "nest.h"
+#include "nest_names.h"
+#include "nestmodule.h"
+#include "spike_stream.h"
+
+// Includes from sli:
+#include "booldatum.h"
+#include "dictdatum.h"
+#include "dictutils.h"
+#include "doubledatum.h"
+#include "integerdatum.h"
+#include "interpret.h"
+#include "namedatum.h"
+#include "sliexceptions.h"
+
+using nest::kernel;
+
+namespace
+{
+
+//! Sender and precise time in ms of a spike
+typedef std::pair< long, double > Spike;
+
+class SpikeStreamRecorder : public nest::SpikeStreamSubscriber
+{
+public:
+  std::string
+  get_name() const
+  {
+    return "test_spike_stream";
+  }
+
+  void
+  handle_spikes( const nest::SpikeBatch& batch )
+  {
+    for ( size_t i = 0; i < batch.size; ++i )
+    {
+      spikes.push_back( Spike(
+        batch.gids[ i ], batch.get_stamp( i ).get_ms() - batch.offsets[ i ] ) );
+    }
+  }
+
+  std::vector< Spike > spikes;
+};
+
+DictionaryDatum
+dict_( const Name& key, const Token& value )
+{
+  DictionaryDatum d( new Dictionary );
+  ( *d )[ key ] = value;
+  return d;
+}
+
+/**
+ * Simulate the network and store the spikes passed to the recorder and the
+ * spikes recorded by a spike_detector, both sorted.
+ */
+void
+run_network_( bool off_grid,
+  bool compact,
+  double min_delay,
+  SpikeStreamRecorder& recorder,
+  std::vector< Spike >& streamed,
+  std::vector< Spike >& detected )
+{
+  const long n = 20;
+
+  nest::reset_kernel();
+  DictionaryDatum kernel_status( new Dictionary );
+#ifdef _OPENMP
+  ( *kernel_status )[ nest::names::local_num_threads ] = 2;
+#endif
+  ( *kernel_status )[ nest::names::resolution ] = 0.1;
+  ( *kernel_status )[ nest::names::off_grid_spiking ] = off_grid;
+  ( *kernel_status )[ nest::names::compact_off_grid_spiking ] = compact;
+  nest::set_kernel_status( kernel_status );
+
+  nest::create( off_grid ? "iaf_psc_alpha_canon" : "iaf_psc_alpha", n );
+  const nest::GIDCollection neurons( 1, n );
+  const nest::index pg = nest::create( "poisson_generator", 1 );
+  nest::set_node_status( pg, dict_( nest::names::rate, 20000. ) );
+  const nest::index sd = nest::create( "spike_detector", 1 );
+  nest::set_node_status( sd, dict_( nest::names::precise_times, off_grid ) );
+
+  DictionaryDatum syn_spec =
+    dict_( nest::names::model, LiteralDatum( "static_synapse" ) );
+  ( *syn_spec )[ nest::names::weight ] = 20.;
+  ( *syn_spec )[ nest::names::delay ] = min_delay;
+  nest::connect( nest::GIDCollection( pg, pg ),
+    neurons,
+    dict_( nest::names::rule, LiteralDatum( "all_to_all" ) ),
+    syn_spec );
+
+  DictionaryDatum conn_spec =
+    dict_( nest::names::rule, LiteralDatum( "fixed_indegree" ) );
+  ( *conn_spec )[ nest::names::indegree ] = 5;
+  ( *syn_spec )[ nest::names::weight ] = 10.;
+  ( *syn_spec )[ nest::names::delay ] = 1.5;
+  nest::connect( neurons, neurons, conn_spec, syn_spec );
+
+  nest::connect( neurons,
+    nest::GIDCollection( sd, sd ),
+    dict_( nest::names::rule, LiteralDatum( "all_to_all" ) ),
+    dict_( nest::names::model, LiteralDatum( "static_synapse" ) ) );
+
+  recorder.spikes.clear();
+  nest::simulate( 50. );
+  streamed = recorder.spikes;
+  nest::simulate( min_delay );
+
+  DictionaryDatum events = getValue< DictionaryDatum >(
+    nest::get_node_status( sd ), nest::names::events );
+  const std::vector< long > senders =
+    getValue< std::vector< long > >( events, nest::names::senders );
+  const std::vector< double > times =
+    getValue< std::vector< double > >( events, nest::names::times );
+  detected.clear();
+  for ( size_t i = 0; i < senders.size(); ++i )
+  {
+    detected.push_back( Spike( senders[ i ], times[ i ] ) );
+  }
+
+  std::sort( streamed.begin(), streamed.end() );
+  std::sort( detected.begin(), detected.end() );
+}
+
+//! Same spikes in both lists, to round-off of the times
+bool
+check_network_( bool off_grid,
+  bool compact,
+  double min_delay,
+  SpikeStreamRecorder& recorder )
+{
+  std::vector< Spike > streamed;
+  std::vector< Spike > detected;
+  run_network_( off_grid, compact, min_delay, recorder, streamed, detected );
+
+  bool passed = not streamed.empty() and streamed.size() == detected.size();
+  for ( size_t i = 0; passed and i < streamed.size(); ++i )
+  {
+    passed = streamed[ i ].first == detected[ i ].first
+      and fabs( streamed[ i ].second - detected[ i ].second ) < 1e-6;
+  }
+
+  std::cerr << ( passed ? "passed" : "FAILED" )
+            << ": off_grid_spiking=" << off_grid
+            << " compact_off_grid_spiking=" << compact
+            << " min_delay=" << min_delay << ", " << streamed.size()
+            << " spikes streamed, " << detected.size() << " detected"
+            << std::endl;
+  return passed;
+}
+
+} // namespace
+
+int
+main( int argc, char* argv[] )
+{
+  // The kernel and the built-in modules are set up as by the nest
+  // executable, but no SLI code is run, see testsuite/benchmarks/main.cpp.
+  SLIInterpreter engine;
+  nest::init_nest( &argc, &argv );
+  engine.def( "statusdict", DictionaryDatum( new Dictionary ) );
+  addmodule< nest::NestModule >( engine );
+  add_static_modules( engine );
+  nest::kernel().logging_manager.set_logging_level( nest::M_ERROR );
+
+  SpikeStreamRecorder recorder;
+  kernel().event_delivery_manager.register_spike_stream_subscriber(
+    recorder );
+
+  bool passed = true;
+  try
+  {
+    // compact off-grid spiking only differs from off-grid spiking
+    passed = check_network_( false, false, 0.1, recorder ) and passed;
+    passed = check_network_( false, false, 1.0, recorder ) and passed;
+    passed = check_network_( true, false, 0.1, recorder ) and passed;
+    passed = check_network_( true, false, 1.0, recorder ) and passed;
+    passed = check_network_( true, true, 0.1, recorder ) and passed;
+    passed = check_network_( true, true, 1.0, recorder ) and passed;
+  }
+  catch ( SLIException& e )
+  {
+    std::cerr << "FAILED: " << e.what() << ": " << e.message() << std::endl;
+    passed = false;
+  }
+
+  kernel().event_delivery_manager.unregister_spike_stream_subscriber(
+    recorder );
+  nest::kernel().mpi_manager.mpi_finalize( 0 );
+  nest::KernelManager::destroy_kernel_manager();
+  return passed ? 0 : 1;
+}
@@ -121,6 +121,10 @@ ConnectionCreator::ConnectionCreator( DictionaryDatum dict )
     }
   }
 
+  // Create the per-thread prototypes of the synapse type here, since
+  // connect() uses them from within parallel regions
+  kernel().model_manager.get_synapse_prototype( synapse_model_ );
+
   // Set default weight and delay if not given explicitly
   DictionaryDatum syn_defaults =
     kernel().model_manager.get_connector_defaults( synapse_model_ );
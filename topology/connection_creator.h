@@ -24,6 +24,7 @@
 #define CONNECTION_CREATOR_H
 
 // C++ includes:
+#include <bitset>
 #include <vector>
 
 // Includes from nestkernel:
@@ -46,6 +47,9 @@ class Layer;
 template < int D >
 class MaskedLayer;
 
+template < int D >
+class GridLayer;
+
 /**
  * This class is a representation of the dictionary of connection
  * properties given as an argument to the ConnectLayers function. The
@@ -138,6 +142,143 @@ private:
     std::vector< std::pair< Position< D >, index > >* positions_;
   };
 
+  /**
+   * Table of grid offsets inside the mask for connections between two
+   * grid layers with identical grid spacing.
+   *
+   * On a grid, the displacement between a source and a target node
+   * depends only on the difference of their grid positions. The mask is
+   * therefore evaluated once for each offset between source and target
+   * grid position, and the offsets inside the mask are stored as runs
+   * of consecutive offsets along the last grid dimension, i.e., as
+   * ranges of consecutive local indices in the source layer. For each
+   * offset, the displacement and, for deterministic kernels, the
+   * connection probability are precomputed.
+   *
+   * Offsets for which the mask boundary passes within rounding distance
+   * of the displacement are marked, and the mask is evaluated for the
+   * actual node positions of each pair for them, as done when searching
+   * the source layer.
+   */
+  template < int D >
+  class GridOffsets_
+  {
+  public:
+    /**
+     * Consecutive offsets along the last grid dimension.
+     */
+    struct Run
+    {
+      Position< D, int > first; //!< offset of first element of run
+      int length;               //!< number of offsets in run
+      size_t entry;             //!< index of first offset in tables
+    };
+
+    /**
+     * Evaluate mask and kernel for all offsets.
+     * @param mask mask in spatial coordinates, i.e., no grid mask
+     * @param source source layer
+     * @param target target layer
+     * @param source_driven if true, the mask is defined in target layer
+     *                      coordinates and applied to the source layer
+     * @param kernel kernel, may be invalid
+     * @returns false if the offset table can not represent the mask,
+     *          e.g., for unbounded or oversized masks or if the grid
+     *          spacings of the layers differ.
+     */
+    bool define( const Mask< D >& mask,
+      const GridLayer< D >& source,
+      const GridLayer< D >& target,
+      bool source_driven,
+      const lockPTR< TopologyParameter >& kernel );
+
+    const std::vector< Run >&
+    get_runs() const
+    {
+      return runs_;
+    }
+
+    const Position< D >&
+    get_displacement( size_t entry ) const
+    {
+      return displacements_[ entry ];
+    }
+
+    /**
+     * @returns true if the mask must be evaluated for each pair
+     */
+    bool
+    on_boundary( size_t entry ) const
+    {
+      return on_boundary_[ entry ];
+    }
+
+    /**
+     * Evaluate the mask for the actual positions of a pair of nodes.
+     * @param tgt_gridpos grid position of target
+     * @param offset grid offset of source, may point outside of layer
+     * @returns true if source is inside the mask of target
+     */
+    bool inside( const Position< D, int >& tgt_gridpos,
+      const Position< D, int >& offset ) const;
+
+    double
+    get_probability( size_t entry ) const
+    {
+      return probabilities_[ entry ];
+    }
+
+    /**
+     * @returns true if probabilities have been precomputed
+     */
+    bool
+    has_probabilities() const
+    {
+      return not probabilities_.empty();
+    }
+
+    /**
+     * @returns periodic boundary conditions applying to the mask
+     */
+    const std::bitset< D >&
+    get_periodic() const
+    {
+      return periodic_;
+    }
+
+  private:
+    const Mask< D >* mask_;
+    const GridLayer< D >* source_;
+    const GridLayer< D >* target_;
+    bool source_driven_;
+
+    std::vector< Run > runs_;
+    std::vector< Position< D > > displacements_;
+    std::vector< double > probabilities_;
+    std::vector< bool > on_boundary_;
+    std::bitset< D > periodic_;
+  };
+
+  /**
+   * Create pairwise connections between grid layers by means of a
+   * GridOffsets_ table instead of searching the source layer with a
+   * MaskedLayer. Used for target and source driven connections.
+   * @returns false if the layers or the mask are not suitable, in which
+   *          case no connections have been created.
+   */
+  template < int D >
+  bool grid_connect_( Layer< D >& source,
+    Layer< D >& target,
+    std::vector< Node* >::const_iterator target_begin,
+    std::vector< Node* >::const_iterator target_end );
+
+  template < int D >
+  void connect_grid_target_( const GridOffsets_< D >& offsets,
+    const GridLayer< D >& source,
+    Node* tgt_ptr,
+    const Position< D, int >& tgt_gridpos,
+    thread tgt_thread );
+
   template < typename Iterator, int D >
   void connect_to_target_( Iterator from,
     Iterator to,
@@ -26,6 +26,8 @@
 #include "connection_creator.h"
 
 // C++ includes:
+#include <algorithm>
+#include <cmath>
 #include <vector>
 
 // Includes from librandom:
@@ -35,6 +37,11 @@
 #include "kernel_manager.h"
 #include "nest.h"
 
+// Includes from topology:
+#include "grid_layer.h"
+#include "layer_impl.h"
+#include "ntree_impl.h"
+
 namespace nest
 {
 template < int D >
@@ -92,6 +99,41 @@ ConnectionCreator::connect_to_target_( Iterator from,
 {
   librandom::RngPtr rng = get_vp_rng( tgt_thread );
 
+  // A kernel which does not draw random numbers is evaluated for all
+  // sources at once, which leaves the sequence of random numbers unchanged.
+  if ( kernel_.valid() and kernel_->is_deterministic() )
+  {
+    std::vector< index > sources;
+    std::vector< Position< D > > displacements;
+    for ( Iterator iter = from; iter != to; ++iter )
+    {
+      if ( ( not allow_autapses_ ) and ( iter->second == tgt_ptr->get_gid() ) )
+      {
+        continue;
+      }
+      sources.push_back( iter->second );
+      displacements.push_back( iter->first );
+    }
+
+    std::vector< double > probabilities;
+    source.compute_displacement( tgt_pos, displacements );
+    kernel_->values( displacements, rng, probabilities );
+
+    for ( size_t i = 0; i < sources.size(); ++i )
+    {
+      if ( rng->drand() < probabilities[ i ] )
+      {
+        connect_( sources[ i ],
+          tgt_ptr,
+          tgt_thread,
+          weight_->value( displacements[ i ], rng ),
+          delay_->value( displacements[ i ], rng ),
+          synapse_model_ );
+      }
+    }
+    return;
+  }
+
   const bool without_kernel = not kernel_.valid();
   for ( Iterator iter = from; iter != to; ++iter )
   {
@@ -183,6 +225,475 @@ ConnectionCreator::PoolWrapper_< D >::end() const
   return positions_->end();
 }
 
+template < int D >
+bool
+ConnectionCreator::GridOffsets_< D >::define( const Mask< D >& mask,
+  const GridLayer< D >& source,
+  const GridLayer< D >& target,
+  bool source_driven,
+  const lockPTR< TopologyParameter >& kernel )
+{
+  mask_ = &mask;
+  source_ = &source;
+  target_ = &target;
+  source_driven_ = source_driven;
+
+  const Position< D, index > src_dims = source.get_dims();
+  const Position< D, index > tgt_dims = target.get_dims();
+
+  // Displacements only depend on grid offsets if the spacing is the same
+  if ( not( source.get_extent() / src_dims == target.get_extent() / tgt_dims ) )
+  {
+    return false;
+  }
+
+  // The mask is applied with the periodic boundary conditions of the layer
+  // it is defined for. With source driven connections, the source positions
+  // are mapped into the target layer, which is only compatible with the
+  // source grid if both layers coincide in periodic dimensions.
+  const Layer< D >& mask_layer = source_driven ? target : source;
+  periodic_ = mask_layer.get_periodic_mask();
+  if ( source_driven )
+  {
+    for ( int i = 0; i < D; ++i )
+    {
+      if ( periodic_[ i ]
+        and ( src_dims[ i ] != tgt_dims[ i ]
+              or source.get_lower_left()[ i ] != target.get_lower_left()[ i ]
+              or source.get_extent()[ i ] != target.get_extent()[ i ] ) )
+      {
+        return false;
+      }
+    }
+  }
+
+  // Bounding box of the mask for displacements from target to source
+  const Box< D > bbox = mask.get_bbox();
+  const Position< D > lower_left =
+    source_driven ? -bbox.upper_right : bbox.lower_left;
+  const Position< D > upper_right =
+    source_driven ? -bbox.lower_left : bbox.upper_right;
+
+  const Position< D > target_origin =
+    target.gridpos_to_position( Position< D, int >() );
+  const Position< D > source_origin =
+    source.gridpos_to_position( Position< D, int >() );
+  const Position< D > origin_displ = source_origin - target_origin;
+
+  Position< D, int > min_offset;
+  Position< D, int > max_offset;
+  Position< D > tolerance;
+  for ( int i = 0; i < D; ++i )
+  {
+    // Bound for rounding errors of displacements between node positions
+    tolerance[ i ] = 1e-12
+      * ( std::max( std::abs( source.get_lower_left()[ i ] ),
+            std::abs( target.get_lower_left()[ i ] ) )
+                       + std::max( source.get_extent()[ i ],
+                           target.get_extent()[ i ] ) );
+
+    if ( not std::isfinite( lower_left[ i ] )
+      or not std::isfinite( upper_right[ i ] ) )
+    {
+      return false;
+    }
+
+    // Masks as wide as the layer may contain a node more than once
+    if ( periodic_[ i ] and upper_right[ i ] - lower_left[ i ]
+        >= mask_layer.get_extent()[ i ] )
+    {
+      return false;
+    }
+
+    // grid layers use "matrix convention", i.e. reversed y axis
+    const double step = ( i == 1 ? -1.0 : 1.0 ) * source.get_extent()[ i ]
+      / src_dims[ i ];
+    double first = ( lower_left[ i ] - origin_displ[ i ] ) / step;
+    double last = ( upper_right[ i ] - origin_displ[ i ] ) / step;
+    if ( first > last )
+    {
+      std::swap( first, last );
+    }
+
+    // Widen by one to be robust against rounding, the mask decides
+    first = std::floor( first ) - 1;
+    last = std::ceil( last ) + 1;
+
+    if ( not periodic_[ i ] )
+    {
+      // Offsets leading outside of the layer for all targets
+      first = std::max( first, -( double( tgt_dims[ i ] ) - 1 ) );
+      last = std::min( last, double( src_dims[ i ] ) - 1 );
+    }
+
+    if ( first > last )
+    {
+      // No offsets inside mask
+      return true;
+    }
+
+    min_offset[ i ] = ( int ) first;
+    max_offset[ i ] = ( int ) last + 1;
+  }
+
+  librandom::RngPtr rng = get_global_rng();
+  const bool with_probabilities =
+    kernel.valid() and kernel->is_deterministic();
+
+  // Iterate over all but the last dimension, runs are along the last one
+  Position< D, int > row_upper_right = max_offset;
+  row_upper_right[ D - 1 ] = min_offset[ D - 1 ] + 1;
+
+  for ( MultiIndex< D > row( min_offset, row_upper_right );
+        row != row_upper_right;
+        ++row )
+  {
+    Position< D, int > offset = row;
+    Run run;
+    run.length = 0;
+
+    for ( ; offset[ D - 1 ] < max_offset[ D - 1 ]; ++offset[ D - 1 ] )
+    {
+      const Position< D > source_pos = source.gridpos_to_position( offset );
+      const Position< D > mask_pos = source_driven
+        ? target_origin - source_pos
+        : source_pos - target_origin;
+      const Position< D > displ = source_driven
+        ? target.compute_displacement( source_pos, target_origin )
+        : source.compute_displacement( target_origin, source_pos );
+
+      // Test the corners of the box of positions within rounding distance
+      const bool inside = mask.inside( mask_pos );
+      bool on_boundary = false;
+      for ( int corner = 0; corner < ( 1 << D ) and not on_boundary; ++corner )
+      {
+        Position< D > p = mask_pos;
+        for ( int i = 0; i < D; ++i )
+        {
+          p[ i ] += ( corner & ( 1 << i ) ) ? tolerance[ i ] : -tolerance[ i ];
+        }
+        on_boundary = ( mask.inside( p ) != inside );
+      }
+
+      if ( not inside and not on_boundary )
+      {
+        if ( run.length > 0 )
+        {
+          runs_.push_back( run );
+          run.length = 0;
+        }
+        continue;
+      }
+
+      if ( run.length == 0 )
+      {
+        run.first = offset;
+        run.entry = displacements_.size();
+      }
+      ++run.length;
+
+      displacements_.push_back( displ );
+      on_boundary_.push_back( on_boundary );
+      if ( with_probabilities )
+      {
+        probabilities_.push_back( kernel->value( displ, rng ) );
+      }
+    }
+
+    if ( run.length > 0 )
+    {
+      runs_.push_back( run );
+    }
+  }
+
+  return true;
+}
+
+template < int D >
+bool
+ConnectionCreator::GridOffsets_< D >::inside(
+  const Position< D, int >& tgt_gridpos,
+  const Position< D, int >& offset ) const
+{
+  const Position< D > target_pos = target_->gridpos_to_position( tgt_gridpos );
+
+  if ( periodic_.none() )
+  {
+    const Position< D > source_pos =
+      source_->gridpos_to_position( tgt_gridpos + offset );
+    return source_driven_ ? mask_->inside( target_pos - source_pos )
+                          : mask_->inside( source_pos - target_pos );
+  }
+
+  // With periodic boundary conditions, evaluate the mask exactly as
+  // Ntree::masked_iterator does for the positions stored in the Ntree.
+  const Position< D, index > dims = source_->get_dims();
+  const Position< D > lower_left = source_->get_lower_left();
+  const Position< D > extent =
+    source_driven_ ? target_->get_extent() : source_->get_extent();
+
+  Position< D, int > gridpos = tgt_gridpos + offset;
+  for ( int i = 0; i < D; ++i )
+  {
+    if ( periodic_[ i ] )
+    {
+      gridpos[ i ] %= int( dims[ i ] );
+      if ( gridpos[ i ] < 0 )
+      {
+        gridpos[ i ] += dims[ i ];
+      }
+    }
+  }
+
+  Position< D > source_pos = source_->gridpos_to_position( gridpos );
+  Box< D > bbox = mask_->get_bbox();
+  if ( source_driven_ )
+  {
+    bbox = Box< D >( -bbox.upper_right, -bbox.lower_left );
+  }
+
+  std::vector< Position< D > > anchors( 1, target_pos );
+  for ( int i = 0; i < D; ++i )
+  {
+    if ( periodic_[ i ] )
+    {
+      source_pos[ i ] = lower_left[ i ]
+        + std::fmod( source_pos[ i ] - lower_left[ i ], extent[ i ] );
+      if ( source_pos[ i ] < lower_left[ i ] )
+      {
+        source_pos[ i ] += extent[ i ];
+      }
+
+      anchors[ 0 ][ i ] = nest::mod( anchors[ 0 ][ i ] + bbox.lower_left[ i ]
+                                - lower_left[ i ],
+                              extent[ i ] ) - bbox.lower_left[ i ]
+        + lower_left[ i ];
+    }
+  }
+
+  for ( int i = 0; i < D; ++i )
+  {
+    if ( periodic_[ i ] and ( anchors[ 0 ][ i ] + bbox.upper_right[ i ]
+                              - lower_left[ i ] ) > extent[ i ] )
+    {
+      const size_t n = anchors.size();
+      for ( size_t j = 0; j < n; ++j )
+      {
+        Position< D > p = anchors[ j ];
+        p[ i ] -= extent[ i ];
+        anchors.push_back( p );
+      }
+    }
+  }
+
+  for ( size_t j = 0; j < anchors.size(); ++j )
+  {
+    if ( source_driven_ ? mask_->inside( -( source_pos - anchors[ j ] ) )
+                        : mask_->inside( source_pos - anchors[ j ] ) )
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+template < int D >
+bool
+ConnectionCreator::grid_connect_( Layer< D >& source,
+  Layer< D >& target,
+  std::vector< Node* >::const_iterator target_begin,
+  std::vector< Node* >::const_iterator target_end )
+{
+  GridLayer< D >* grid_source = dynamic_cast< GridLayer< D >* >( &source );
+  GridLayer< D >* grid_target = dynamic_cast< GridLayer< D >* >( &target );
+  if ( not mask_.valid() or grid_source == 0 or grid_target == 0 )
+  {
+    return false;
+  }
+
+  if ( source_filter_.select_depth()
+    and source_filter_.depth >= grid_source->get_depth() )
+  {
+    return false; // leave error handling to the general case
+  }
+
+  const bool source_driven = ( type_ == Source_driven );
+
+  // Check and convert the mask as done by MaskedLayer
+  const MaskDatum mask = MaskedLayer< D >::check_mask(
+    source_driven ? target : source, mask_, allow_oversized_ );
+
+  GridOffsets_< D > offsets;
+  if ( not offsets.define( dynamic_cast< const Mask< D >& >( *mask ),
+         *grid_source,
+         *grid_target,
+         source_driven,
+         kernel_ ) )
+  {
+    return false;
+  }
+
+// sharing specs on next line commented out because gcc 4.2 cannot handle them
+#pragma omp parallel // default(none) shared(grid_source, grid_target, offsets,
+                     // target_begin, target_end)
+  {
+    const int thread_id = kernel().vp_manager.get_thread_id();
+
+    for ( std::vector< Node* >::const_iterator tgt_it = target_begin;
+          tgt_it != target_end;
+          ++tgt_it )
+    {
+      Node* const tgt =
+        kernel().node_manager.get_node( ( *tgt_it )->get_gid(), thread_id );
+      const thread target_thread = tgt->get_thread();
+
+      // check whether the target is on our thread
+      if ( thread_id != target_thread )
+      {
+        continue;
+      }
+
+      if ( target_filter_.select_model()
+        && ( tgt->get_model_id() != target_filter_.model ) )
+      {
+        continue;
+      }
+
+      connect_grid_target_( offsets,
+        *grid_source,
+        tgt,
+        grid_target->lid_to_gridpos( tgt->get_lid() ),
+        thread_id );
+    } // for target_begin
+  }   // omp parallel
+
+  return true;
+}
+
+template < int D >
+void
+ConnectionCreator::connect_grid_target_( const GridOffsets_< D >& offsets,
+  const GridLayer< D >& source,
+  Node* tgt_ptr,
+  const Position< D, int >& tgt_gridpos,
+  thread tgt_thread )
+{
+  librandom::RngPtr rng = get_vp_rng( tgt_thread );
+
+  const Position< D, index > dims = source.get_dims();
+  const std::bitset< D >& periodic = offsets.get_periodic();
+  const index layer_size = source.global_size() / source.get_depth();
+
+  int depth_begin = 0;
+  int depth_end = source.get_depth();
+  if ( source_filter_.select_depth() )
+  {
+    depth_begin = source_filter_.depth;
+    depth_end = source_filter_.depth + 1;
+  }
+
+  const bool without_kernel = not kernel_.valid();
+  const bool with_probabilities = offsets.has_probabilities();
+  const index tgt_gid = tgt_ptr->get_gid();
+  const int last_dim = dims[ D - 1 ];
+
+  typedef typename std::vector< typename GridOffsets_< D >::Run >::const_iterator
+    RunIterator;
+  for ( RunIterator run = offsets.get_runs().begin();
+        run != offsets.get_runs().end();
+        ++run )
+  {
+    // Local index of the first node in the row of the run
+    const Position< D, int > first = tgt_gridpos + run->first;
+    index row_lid = 0;
+    bool row_in_layer = true;
+    for ( int i = 0; i < D - 1; ++i )
+    {
+      int pos = first[ i ];
+      if ( periodic[ i ] )
+      {
+        pos %= int( dims[ i ] );
+        if ( pos < 0 )
+        {
+          pos += dims[ i ];
+        }
+      }
+      else if ( pos < 0 or pos >= int( dims[ i ] ) )
+      {
+        row_in_layer = false;
+        break;
+      }
+      row_lid = ( row_lid + pos ) * dims[ i + 1 ];
+    }
+
+    if ( not row_in_layer )
+    {
+      continue;
+    }
+
+    for ( int k = 0; k < run->length; ++k )
+    {
+      int pos = first[ D - 1 ] + k;
+      if ( periodic[ D - 1 ] )
+      {
+        pos %= last_dim;
+        if ( pos < 0 )
+        {
+          pos += last_dim;
+        }
+      }
+      else if ( pos < 0 or pos >= last_dim )
+      {
+        continue;
+      }
+
+      const size_t entry = run->entry + k;
+      const Position< D >& displ = offsets.get_displacement( entry );
+
+      if ( offsets.on_boundary( entry ) )
+      {
+        Position< D, int > offset = run->first;
+        offset[ D - 1 ] += k;
+        if ( not offsets.inside( tgt_gridpos, offset ) )
+        {
+          continue;
+        }
+      }
+
+      for ( int depth = depth_begin; depth < depth_end; ++depth )
+      {
+        const index src_gid =
+          source.lid_to_gid( row_lid + pos + depth * layer_size );
+
+        if ( source_filter_.select_model()
+          && ( ( int ) kernel().modelrange_manager.get_model_id( src_gid )
+               != source_filter_.model ) )
+        {
+          continue;
+        }
+
+        if ( ( not allow_autapses_ ) and ( src_gid == tgt_gid ) )
+        {
+          continue;
+        }
+
+        if ( without_kernel
+          or rng->drand() < ( with_probabilities
+                                ? offsets.get_probability( entry )
+                                : kernel_->value( displ, rng ) ) )
+        {
+          connect_( src_gid,
+            tgt_ptr,
+            tgt_thread,
+            weight_->value( displ, rng ),
+            delay_->value( displ, rng ),
+            synapse_model_ );
+        }
+      }
+    }
+  }
+}
+
 
 template < int D >
 void
@@ -210,6 +721,12 @@ ConnectionCreator::target_driven_connect_( Layer< D >& source,
     target_end = target.local_end();
   }
 
+  // connections between grid layers do not need to search the source layer
+  if ( grid_connect_( source, target, target_begin, target_end ) )
+  {
+    return;
+  }
+
   // retrieve global positions, either for masked or unmasked pool
   PoolWrapper_< D > pool;
   if ( mask_.valid() ) // MaskedLayer will be freed by PoolWrapper d'tor
@@ -313,6 +830,12 @@ ConnectionCreator::source_driven_connect_( Layer< D >& source,
     }
   }
 
+  // connections between grid layers do not need to search the source layer
+  if ( grid_connect_( source, target, target_begin, target_end ) )
+  {
+    return;
+  }
+
   if ( mask_.valid() )
   {
 
@@ -132,8 +132,35 @@ public:
    */
   Position< D > lid_to_position( index lid ) const;
 
+  /**
+   * Get grid position of node. Also allowed for non-local nodes.
+   * @param lid local index of node
+   * @returns discrete position in layerspace of node with given index.
+   */
+  Position< D, int > lid_to_gridpos( index lid ) const;
+
   index gridpos_to_lid( Position< D, int > pos ) const;
 
+  /**
+   * Get GID of node. Also allowed for non-local nodes.
+   * @param lid local index of node, including depth offset
+   * @returns GID of node with given index.
+   */
+  index
+  lid_to_gid( index lid ) const
+  {
+    return this->gids_[ lid ];
+  }
+
+  /**
+   * @returns number of nodes at each grid position.
+   */
+  int
+  get_depth() const
+  {
+    return this->depth_;
+  }
+
   Position< D > gridpos_to_position( Position< D, int > gridpos ) const;
 
   /**
@@ -237,6 +264,13 @@ GridLayer< D >::get_status( DictionaryDatum& d ) const
 template < int D >
 Position< D >
 GridLayer< D >::lid_to_position( index lid ) const
+{
+  return gridpos_to_position( lid_to_gridpos( lid ) );
+}
+
+template < int D >
+Position< D, int >
+GridLayer< D >::lid_to_gridpos( index lid ) const
 {
   lid %= this->global_size() / this->depth_;
   Position< D, int > gridpos;
@@ -247,7 +281,7 @@ GridLayer< D >::lid_to_position( index lid ) const
   }
   assert( lid < dims_[ 0 ] );
   gridpos[ 0 ] = lid;
-  return gridpos_to_position( gridpos );
+  return gridpos;
 }
 
 template < int D >
@@ -30,6 +30,7 @@
 
 // Includes from nestkernel:
 #include "kernel_manager.h"
+#include "memory_accounting.h"
 #include "nest_types.h"
 #include "subnet.h"
 
@@ -312,6 +313,17 @@ public:
     const std::vector< double >& from_pos,
     const index to ) const;
 
+  /**
+   * Replace a batch of positions by their displacements from a given
+   * position. When using periodic boundary conditions, minimum
+   * displacements are computed.
+   * @param from_pos  position vector in layer
+   * @param positions positions in layer, on return displacements from
+   *                  from_pos
+   */
+  void compute_displacement( const Position< D >& from_pos,
+    std::vector< Position< D > >& positions ) const;
+
   /**
    * Returns distance to node from given position. When using periodic
    * boundary conditions, will return minimum distance.
@@ -452,6 +464,9 @@ protected:
   static std::vector< std::pair< Position< D >, index > >* cached_vector_;
   static Selector cached_selector_;
 
+  //! Bytes of cached_ntree_ counted by MemoryAccounting
+  static long cached_ntree_bytes_;
+
   friend class MaskedLayer< D >;
 };
 
@@ -517,6 +532,18 @@ public:
    */
   typename Ntree< D, index >::masked_iterator end();
 
+  /**
+   * Check that the mask can be applied to the layer, see check_mask_().
+   * @param layer The layer to check for
+   * @param mask The mask to check, may be invalid (i.e. no mask)
+   * @param allow_oversized If true, oversized masks are allowed
+   * @returns the mask in spatial coordinates, i.e. grid masks are converted
+   *          to box masks and an invalid mask is replaced by an AllMask.
+   */
+  static MaskDatum check_mask( Layer< D >& layer,
+    const MaskDatum& mask,
+    bool allow_oversized );
+
 protected:
   /**
    * Will check that the mask can be applied to the layer. The mask must
@@ -686,6 +713,8 @@ Layer< D >::clear_ntree_cache_() const
 {
   cached_ntree_ = lockPTR< Ntree< D, index > >();
   cached_ntree_layer_ = -1;
+  MemoryAccounting::add( MEM_TOPOLOGY, -cached_ntree_bytes_ );
+  cached_ntree_bytes_ = 0;
 }
 
 template < int D >
@@ -694,6 +723,9 @@ Layer< D >::clear_vector_cache_() const
 {
   if ( cached_vector_ != 0 )
   {
+    MemoryAccounting::add( MEM_TOPOLOGY,
+      -static_cast< long >( cached_vector_->capacity()
+        * sizeof( std::pair< Position< D >, index > ) ) );
     delete cached_vector_;
   }
   cached_vector_ = 0;
@@ -45,6 +45,9 @@ std::vector< std::pair< Position< D >, index > >* Layer< D >::cached_vector_ =
 template < int D >
 Selector Layer< D >::cached_selector_;
 
+template < int D >
+long Layer< D >::cached_ntree_bytes_ = 0;
+
 template < int D >
 Position< D >
 Layer< D >::compute_displacement( const Position< D >& from_pos,
@@ -66,6 +69,45 @@ Layer< D >::compute_displacement( const Position< D >& from_pos,
   return displ;
 }
 
+template < int D >
+void
+Layer< D >::compute_displacement( const Position< D >& from_pos,
+  std::vector< Position< D > >& positions ) const
+{
+  const size_t n = positions.size();
+  for ( int i = 0; i < D; ++i )
+  {
+    for ( size_t j = 0; j < n; ++j )
+    {
+      positions[ j ][ i ] -= from_pos[ i ];
+    }
+    if ( periodic_[ i ] )
+    {
+      for ( size_t j = 0; j < n; ++j )
+      {
+        // Same result as std::fmod in compute_displacement() above. For
+        // positions inside the layer, at most one extent is subtracted,
+        // which is exact, so the costly std::fmod is rarely needed.
+        double& displ = positions[ j ][ i ];
+        double x = displ + 0.5 * extent_[ i ];
+        if ( x >= extent_[ i ] and x < 2 * extent_[ i ] )
+        {
+          x -= extent_[ i ];
+        }
+        else if ( not( x > -extent_[ i ] and x < extent_[ i ] ) )
+        {
+          x = std::fmod( x, extent_[ i ] );
+        }
+        displ = -0.5 * extent_[ i ] + x;
+        if ( displ < -0.5 * extent_[ i ] )
+        {
+          displ += extent_[ i ];
+        }
+      }
+    }
+  }
+}
+
 template < int D >
 void
 Layer< D >::set_status( const DictionaryDatum& d )
@@ -222,6 +264,16 @@ Layer< D >::do_get_global_positions_ntree_( const Selector& filter )
 
   clear_vector_cache_();
 
+  // count the positions stored in the tree
+  assert( cached_ntree_bytes_ == 0 );
+  for ( typename Ntree< D, index >::iterator it = cached_ntree_->begin();
+        it != cached_ntree_->end();
+        ++it )
+  {
+    cached_ntree_bytes_ += sizeof( std::pair< Position< D >, index > );
+  }
+  MemoryAccounting::add( MEM_TOPOLOGY, cached_ntree_bytes_ );
+
   cached_ntree_layer_ = get_gid();
   cached_selector_ = filter;
 
@@ -265,6 +317,9 @@ Layer< D >::get_global_positions_vector( Selector filter )
 
   clear_ntree_cache_();
 
+  MemoryAccounting::add( MEM_TOPOLOGY,
+    cached_vector_->capacity() * sizeof( std::pair< Position< D >, index > ) );
+
   cached_vector_layer_ = get_gid();
   cached_selector_ = filter;
 
@@ -402,15 +457,26 @@ template < int D >
 void
 MaskedLayer< D >::check_mask_( Layer< D >& layer, bool allow_oversized )
 {
-  if ( not mask_.valid() )
+  mask_ = check_mask( layer, mask_, allow_oversized );
+}
+
+template < int D >
+MaskDatum
+MaskedLayer< D >::check_mask( Layer< D >& layer,
+  const MaskDatum& maskd,
+  bool allow_oversized )
+{
+  MaskDatum mask = maskd;
+
+  if ( not mask.valid() )
   {
-    mask_ = new AllMask< D >();
+    mask = new AllMask< D >();
   }
 
   try // Try to cast to GridMask
   {
     const GridMask< D >& grid_mask =
-      dynamic_cast< const GridMask< D >& >( *mask_ );
+      dynamic_cast< const GridMask< D >& >( *mask );
 
     // If the above cast succeeds, then this is a grid mask
 
@@ -449,7 +515,7 @@ MaskedLayer< D >::check_mask_( Layer< D >& layer, bool allow_oversized )
     lower_left[ 1 ] = -upper_right[ 1 ];
     upper_right[ 1 ] = -y;
 
-    mask_ = new BoxMask< D >( lower_left, upper_right );
+    mask = new BoxMask< D >( lower_left, upper_right );
   }
   catch ( std::bad_cast& )
   {
@@ -458,11 +524,12 @@ MaskedLayer< D >::check_mask_( Layer< D >& layer, bool allow_oversized )
 
     try // Try to cast to correct dimension Mask
     {
-      const Mask< D >& mask = dynamic_cast< const Mask< D >& >( *mask_ );
+      const Mask< D >& spatial_mask =
+        dynamic_cast< const Mask< D >& >( *mask );
 
       if ( not allow_oversized )
       {
-        const Box< D > bb = mask.get_bbox();
+        const Box< D > bb = spatial_mask.get_bbox();
         bool oversize = false;
         for ( int i = 0; i < D; ++i )
         {
@@ -483,6 +550,8 @@ MaskedLayer< D >::check_mask_( Layer< D >& layer, bool allow_oversized )
       throw BadProperty( "Mask is incompatible with layer." );
     }
   }
+
+  return mask;
 }
 
 } // namespace nest
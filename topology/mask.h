@@ -116,6 +116,17 @@ public:
    */
   bool inside( const std::vector< double >& pt ) const;
 
+  /**
+   * Test a batch of points. The default implementation tests each point
+   * in turn, while masks of the basic shapes evaluate the whole batch in
+   * a single loop that the compiler can vectorize.
+   * @param points points to test
+   * @param result on return, result[i] is nonzero if points[i] is inside
+   *        the mask
+   */
+  virtual void inside( const std::vector< Position< D > >& points,
+    std::vector< char >& result ) const;
+
   /**
    * @returns true if the whole box is inside the mask.
    * @note a return value of false is not a guarantee that the whole box
@@ -228,6 +239,9 @@ public:
    */
   bool inside( const Position< D >& p ) const;
 
+  void inside( const std::vector< Position< D > >& points,
+    std::vector< char >& result ) const;
+
   /**
    * @returns true if the whole given box is inside this box
    */
@@ -289,6 +303,9 @@ public:
    */
   bool inside( const Position< D >& p ) const;
 
+  void inside( const std::vector< Position< D > >& points,
+    std::vector< char >& result ) const;
+
   /**
    * @returns true if the whole box is inside the circle
    */
@@ -394,6 +411,9 @@ public:
    */
   bool inside( const Position< D >& p ) const;
 
+  void inside( const std::vector< Position< D > >& points,
+    std::vector< char >& result ) const;
+
   /**
    * @returns true if the whole box is inside the ellipse
    */
@@ -472,6 +492,9 @@ public:
 
   bool inside( const Position< D >& p ) const;
 
+  void inside( const std::vector< Position< D > >& points,
+    std::vector< char >& result ) const;
+
   bool inside( const Box< D >& b ) const;
 
   bool outside( const Box< D >& b ) const;
@@ -519,6 +542,9 @@ public:
 
   bool inside( const Position< D >& p ) const;
 
+  void inside( const std::vector< Position< D > >& points,
+    std::vector< char >& result ) const;
+
   bool inside( const Box< D >& b ) const;
 
   bool outside( const Box< D >& b ) const;
@@ -566,6 +592,9 @@ public:
 
   bool inside( const Position< D >& p ) const;
 
+  void inside( const std::vector< Position< D > >& points,
+    std::vector< char >& result ) const;
+
   bool inside( const Box< D >& b ) const;
 
   bool outside( const Box< D >& b ) const;
@@ -611,6 +640,9 @@ public:
 
   bool inside( const Position< D >& p ) const;
 
+  void inside( const std::vector< Position< D > >& points,
+    std::vector< char >& result ) const;
+
   bool inside( const Box< D >& b ) const;
 
   bool outside( const Box< D >& b ) const;
@@ -658,6 +690,9 @@ public:
 
   bool inside( const Position< D >& p ) const;
 
+  void inside( const std::vector< Position< D > >& points,
+    std::vector< char >& result ) const;
+
   bool inside( const Box< D >& b ) const;
 
   bool outside( const Box< D >& b ) const;
@@ -71,6 +71,18 @@ Mask< D >::inside( const std::vector< double >& pt ) const
   return inside( Position< D >( pt ) );
 }
 
+template < int D >
+void
+Mask< D >::inside( const std::vector< Position< D > >& points,
+  std::vector< char >& result ) const
+{
+  result.resize( points.size() );
+  for ( size_t i = 0; i < points.size(); ++i )
+  {
+    result[ i ] = inside( points[ i ] );
+  }
+}
+
 template < int D >
 bool
 Mask< D >::outside( const Box< D >& b ) const
@@ -94,6 +106,25 @@ BoxMask< D >::inside( const Position< D >& p ) const
   return ( p >= lower_left_ ) && ( p <= upper_right_ );
 }
 
+template < int D >
+void
+BoxMask< D >::inside( const std::vector< Position< D > >& points,
+  std::vector< char >& result ) const
+{
+  const size_t n = points.size();
+  result.resize( n );
+  for ( size_t i = 0; i < n; ++i )
+  {
+    char in = 1;
+    for ( int j = 0; j < D; ++j )
+    {
+      in &= ( points[ i ][ j ] >= lower_left_[ j ] )
+        & ( points[ i ][ j ] <= upper_right_[ j ] );
+    }
+    result[ i ] = in;
+  }
+}
+
 template < int D >
 bool
 BoxMask< D >::inside( const Box< D >& b ) const
@@ -149,6 +180,27 @@ BallMask< D >::inside( const Position< D >& p ) const
   return ( p - center_ ).length() <= radius_;
 }
 
+template < int D >
+void
+BallMask< D >::inside( const std::vector< Position< D > >& points,
+  std::vector< char >& result ) const
+{
+  // Same arithmetic as for a single point, so that points on the
+  // boundary are treated identically.
+  const size_t n = points.size();
+  result.resize( n );
+  for ( size_t i = 0; i < n; ++i )
+  {
+    double lensq = 0;
+    for ( int j = 0; j < D; ++j )
+    {
+      const double x = points[ i ][ j ] - center_[ j ];
+      lensq += x * x;
+    }
+    result[ i ] = std::sqrt( lensq ) <= radius_;
+  }
+}
+
 template <>
 bool
 BallMask< 2 >::inside( const Box< 2 >& b ) const
@@ -332,6 +384,48 @@ EllipseMask< 3 >::inside( const Position< 3 >& p ) const
     <= 1;
 }
 
+template <>
+void
+EllipseMask< 2 >::inside( const std::vector< Position< 2 > >& points,
+  std::vector< char >& result ) const
+{
+  const size_t n = points.size();
+  result.resize( n );
+  for ( size_t i = 0; i < n; ++i )
+  {
+    const double x = points[ i ][ 0 ] - center_[ 0 ];
+    const double y = points[ i ][ 1 ] - center_[ 1 ];
+    const double new_x = x * azimuth_cos_ + y * azimuth_sin_;
+    const double new_y = x * azimuth_sin_ - y * azimuth_cos_;
+
+    result[ i ] = new_x * new_x * x_scale_ + new_y * new_y * y_scale_ <= 1;
+  }
+}
+
+template <>
+void
+EllipseMask< 3 >::inside( const std::vector< Position< 3 > >& points,
+  std::vector< char >& result ) const
+{
+  const size_t n = points.size();
+  result.resize( n );
+  for ( size_t i = 0; i < n; ++i )
+  {
+    const double x = points[ i ][ 0 ] - center_[ 0 ];
+    const double y = points[ i ][ 1 ] - center_[ 1 ];
+    const double z = points[ i ][ 2 ] - center_[ 2 ];
+    const double new_x =
+      ( x * azimuth_cos_ + y * azimuth_sin_ ) * polar_cos_ - z * polar_sin_;
+    const double new_y = x * azimuth_sin_ - y * azimuth_cos_;
+    const double new_z =
+      ( x * azimuth_cos_ + y * azimuth_sin_ ) * polar_sin_ + z * polar_cos_;
+
+    result[ i ] = new_x * new_x * x_scale_ + new_y * new_y * y_scale_
+        + new_z * new_z * z_scale_
+      <= 1;
+  }
+}
+
 template <>
 bool
 EllipseMask< 2 >::inside( const Box< 2 >& b ) const
@@ -514,6 +608,20 @@ IntersectionMask< D >::inside( const Position< D >& p ) const
   return mask1_->inside( p ) && mask2_->inside( p );
 }
 
+template < int D >
+void
+IntersectionMask< D >::inside( const std::vector< Position< D > >& points,
+  std::vector< char >& result ) const
+{
+  std::vector< char > result2;
+  mask1_->inside( points, result );
+  mask2_->inside( points, result2 );
+  for ( size_t i = 0; i < points.size(); ++i )
+  {
+    result[ i ] &= result2[ i ];
+  }
+}
+
 template < int D >
 bool
 IntersectionMask< D >::inside( const Box< D >& b ) const
@@ -562,6 +670,20 @@ UnionMask< D >::inside( const Position< D >& p ) const
   return mask1_->inside( p ) || mask2_->inside( p );
 }
 
+template < int D >
+void
+UnionMask< D >::inside( const std::vector< Position< D > >& points,
+  std::vector< char >& result ) const
+{
+  std::vector< char > result2;
+  mask1_->inside( points, result );
+  mask2_->inside( points, result2 );
+  for ( size_t i = 0; i < points.size(); ++i )
+  {
+    result[ i ] |= result2[ i ];
+  }
+}
+
 template < int D >
 bool
 UnionMask< D >::inside( const Box< D >& b ) const
@@ -610,6 +732,20 @@ DifferenceMask< D >::inside( const Position< D >& p ) const
   return mask1_->inside( p ) && not mask2_->inside( p );
 }
 
+template < int D >
+void
+DifferenceMask< D >::inside( const std::vector< Position< D > >& points,
+  std::vector< char >& result ) const
+{
+  std::vector< char > result2;
+  mask1_->inside( points, result );
+  mask2_->inside( points, result2 );
+  for ( size_t i = 0; i < points.size(); ++i )
+  {
+    result[ i ] &= not result2[ i ];
+  }
+}
+
 template < int D >
 bool
 DifferenceMask< D >::inside( const Box< D >& b ) const
@@ -645,6 +781,19 @@ ConverseMask< D >::inside( const Position< D >& p ) const
   return m_->inside( -p );
 }
 
+template < int D >
+void
+ConverseMask< D >::inside( const std::vector< Position< D > >& points,
+  std::vector< char >& result ) const
+{
+  std::vector< Position< D > > converse( points.size() );
+  for ( size_t i = 0; i < points.size(); ++i )
+  {
+    converse[ i ] = -points[ i ];
+  }
+  m_->inside( converse, result );
+}
+
 template < int D >
 bool
 ConverseMask< D >::inside( const Box< D >& b ) const
@@ -681,6 +830,19 @@ AnchoredMask< D >::inside( const Position< D >& p ) const
   return m_->inside( p - anchor_ );
 }
 
+template < int D >
+void
+AnchoredMask< D >::inside( const std::vector< Position< D > >& points,
+  std::vector< char >& result ) const
+{
+  std::vector< Position< D > > shifted( points.size() );
+  for ( size_t i = 0; i < points.size(); ++i )
+  {
+    shifted[ i ] = points[ i ] - anchor_;
+  }
+  m_->inside( shifted, result );
+}
+
 template < int D >
 bool
 AnchoredMask< D >::inside( const Box< D >& b ) const
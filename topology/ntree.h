@@ -232,6 +232,12 @@ public:
      */
     void next_anchor_();
 
+    /**
+     * Evaluate the mask for all nodes of the current leaf, unless the
+     * leaf is completely inside the mask.
+     */
+    void mask_leaf_();
+
     Ntree* ntree_;
     Ntree* top_;
     Ntree* allin_top_;
@@ -240,6 +246,8 @@ public:
     Position< D > anchor_;
     std::vector< Position< D > > anchors_;
     index current_anchor_;
+    std::vector< Position< D > > points_; //!< leaf positions relative anchor
+    std::vector< char > inside_;          //!< mask values for leaf positions
   };
 
   /**
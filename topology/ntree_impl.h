@@ -132,6 +132,8 @@ Ntree< D, T, max_capacity, max_depth >::masked_iterator::masked_iterator(
   , anchor_( anchor )
   , anchors_()
   , current_anchor_( 0 )
+  , points_()
+  , inside_()
 {
   if ( ntree_->periodic_.any() )
   {
@@ -207,6 +209,12 @@ Ntree< D, T, max_capacity, max_depth >::masked_iterator::init_()
       first_leaf_();
     }
 
+    if ( ntree_ == 0 )
+    {
+      return;
+    }
+    mask_leaf_();
+
     if ( ntree_->nodes_.empty()
       || ( not mask_->inside( ntree_->nodes_[ node_ ].first - anchor_ ) ) )
     {
@@ -318,6 +326,24 @@ Ntree< D, T, max_capacity, max_depth >::masked_iterator::next_leaf_()
   return first_leaf_();
 }
 
+template < int D, class T, int max_capacity, int max_depth >
+void
+Ntree< D, T, max_capacity, max_depth >::masked_iterator::mask_leaf_()
+{
+  if ( allin_top_ != 0 )
+  {
+    return;
+  }
+
+  const std::vector< value_type >& nodes = ntree_->nodes_;
+  points_.resize( nodes.size() );
+  for ( size_t i = 0; i < nodes.size(); ++i )
+  {
+    points_[ i ] = nodes[ i ].first - anchor_;
+  }
+  mask_->inside( points_, inside_ );
+}
+
 template < int D, class T, int max_capacity, int max_depth >
 void
 Ntree< D, T, max_capacity, max_depth >::masked_iterator::first_leaf_()
@@ -364,8 +390,7 @@ typename Ntree< D, T, max_capacity, max_depth >::masked_iterator&
 
   if ( allin_top_ == 0 )
   {
-    while ( ( node_ < ntree_->nodes_.size() )
-      && ( not mask_->inside( ntree_->nodes_[ node_ ].first - anchor_ ) ) )
+    while ( ( node_ < ntree_->nodes_.size() ) && ( not inside_[ node_ ] ) )
     {
       node_++;
     }
@@ -382,10 +407,11 @@ typename Ntree< D, T, max_capacity, max_depth >::masked_iterator&
       break;
     }
 
+    mask_leaf_();
+
     if ( allin_top_ == 0 )
     {
-      while ( ( node_ < ntree_->nodes_.size() )
-        && ( not mask_->inside( ntree_->nodes_[ node_ ].first - anchor_ ) ) )
+      while ( ( node_ < ntree_->nodes_.size() ) && ( not inside_[ node_ ] ) )
       {
         node_++;
       }
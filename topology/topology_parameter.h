@@ -25,6 +25,7 @@
 
 // C++ includes:
 #include <limits>
+#include <vector>
 
 // Includes from librandom:
 #include "normal_randomdev.h"
@@ -150,6 +151,79 @@ public:
    */
   double value( const std::vector< double >& pt, librandom::RngPtr& rng ) const;
 
+  /**
+   * Evaluate the parameter for a batch of points.
+   * @param points points at which to evaluate the parameter
+   * @param rng random number generator
+   * @param result on return, result[i] is the value at points[i]
+   */
+  void
+  values( const std::vector< Position< 2 > >& points,
+    librandom::RngPtr& rng,
+    std::vector< double >& result ) const
+  {
+    raw_values( points, rng, result );
+    apply_cutoff_( result );
+  }
+
+  /**
+   * Evaluate the parameter for a batch of points.
+   * @param points points at which to evaluate the parameter
+   * @param rng random number generator
+   * @param result on return, result[i] is the value at points[i]
+   */
+  void
+  values( const std::vector< Position< 3 > >& points,
+    librandom::RngPtr& rng,
+    std::vector< double >& result ) const
+  {
+    raw_values( points, rng, result );
+    apply_cutoff_( result );
+  }
+
+  /**
+   * Raw values disregarding cutoff for a batch of points. The default
+   * implementation calls raw_value() for each point in turn, parameters
+   * with a closed form evaluate the whole batch in a single loop.
+   */
+  virtual void
+  raw_values( const std::vector< Position< 2 > >& points,
+    librandom::RngPtr& rng,
+    std::vector< double >& result ) const
+  {
+    result.resize( points.size() );
+    for ( size_t i = 0; i < points.size(); ++i )
+    {
+      result[ i ] = raw_value( points[ i ], rng );
+    }
+  }
+
+  /**
+   * Raw values disregarding cutoff for a batch of points.
+   */
+  virtual void
+  raw_values( const std::vector< Position< 3 > >& points,
+    librandom::RngPtr& rng,
+    std::vector< double >& result ) const
+  {
+    result.resize( points.size() );
+    for ( size_t i = 0; i < points.size(); ++i )
+    {
+      result[ i ] = raw_value( points[ i ], rng );
+    }
+  }
+
+  /**
+   * A deterministic parameter depends on the position only and does not
+   * draw random numbers, so that its values may be tabulated.
+   * @returns true if the parameter is deterministic.
+   */
+  virtual bool
+  is_deterministic() const
+  {
+    return false;
+  }
+
   /**
    * Clone method.
    * @returns dynamically allocated copy of parameter object
@@ -182,6 +256,15 @@ public:
     const TopologyParameter& other ) const;
 
 private:
+  void
+  apply_cutoff_( std::vector< double >& result ) const
+  {
+    for ( size_t i = 0; i < result.size(); ++i )
+    {
+      result[ i ] = result[ i ] < cutoff_ ? 0.0 : result[ i ];
+    }
+  }
+
   double cutoff_;
 };
 
@@ -225,6 +308,28 @@ public:
     return value_;
   }
 
+  void
+  raw_values( const std::vector< Position< 2 > >& points,
+    librandom::RngPtr&,
+    std::vector< double >& result ) const
+  {
+    result.assign( points.size(), value_ );
+  }
+
+  void
+  raw_values( const std::vector< Position< 3 > >& points,
+    librandom::RngPtr&,
+    std::vector< double >& result ) const
+  {
+    result.assign( points.size(), value_ );
+  }
+
+  bool
+  is_deterministic() const
+  {
+    return true;
+  }
+
   TopologyParameter*
   clone() const
   {
@@ -268,6 +373,55 @@ public:
   {
     return raw_value( p.length() );
   }
+
+  /**
+   * Replace each distance in the batch by the parameter value.
+   */
+  virtual void
+  raw_values( std::vector< double >& x ) const
+  {
+    for ( size_t i = 0; i < x.size(); ++i )
+    {
+      x[ i ] = raw_value( x[ i ] );
+    }
+  }
+
+  void
+  raw_values( const std::vector< Position< 2 > >& points,
+    librandom::RngPtr&,
+    std::vector< double >& result ) const
+  {
+    distances_( points, result );
+    raw_values( result );
+  }
+
+  void
+  raw_values( const std::vector< Position< 3 > >& points,
+    librandom::RngPtr&,
+    std::vector< double >& result ) const
+  {
+    distances_( points, result );
+    raw_values( result );
+  }
+
+  bool
+  is_deterministic() const
+  {
+    return true;
+  }
+
+private:
+  template < int D >
+  void
+  distances_( const std::vector< Position< D > >& points,
+    std::vector< double >& result ) const
+  {
+    result.resize( points.size() );
+    for ( size_t i = 0; i < points.size(); ++i )
+    {
+      result[ i ] = points[ i ].length();
+    }
+  }
 };
 
 /**
@@ -296,6 +450,15 @@ public:
     return a_ * x + c_;
   }
 
+  void
+  raw_values( std::vector< double >& x ) const
+  {
+    for ( size_t i = 0; i < x.size(); ++i )
+    {
+      x[ i ] = a_ * x[ i ] + c_;
+    }
+  }
+
   TopologyParameter*
   clone() const
   {
@@ -342,6 +505,15 @@ public:
     return c_ + a_ * std::exp( -x / tau_ );
   }
 
+  void
+  raw_values( std::vector< double >& x ) const
+  {
+    for ( size_t i = 0; i < x.size(); ++i )
+    {
+      x[ i ] = c_ + a_ * std::exp( -x[ i ] / tau_ );
+    }
+  }
+
   TopologyParameter*
   clone() const
   {
@@ -393,6 +565,17 @@ public:
       * std::exp( -std::pow( x - mean_, 2 ) / ( 2 * std::pow( sigma_, 2 ) ) );
   }
 
+  void
+  raw_values( std::vector< double >& x ) const
+  {
+    const double two_sigma_sq = 2 * std::pow( sigma_, 2 );
+    for ( size_t i = 0; i < x.size(); ++i )
+    {
+      const double d = x[ i ] - mean_;
+      x[ i ] = c_ + p_center_ * std::exp( -( d * d ) / two_sigma_sq );
+    }
+  }
+
   TopologyParameter*
   clone() const
   {
@@ -446,6 +629,37 @@ public:
     return raw_value( Position< 2 >( pos[ 0 ], pos[ 1 ] ), rng );
   }
 
+  void
+  raw_values( const std::vector< Position< 2 > >& points,
+    librandom::RngPtr& rng,
+    std::vector< double >& result ) const
+  {
+    result.resize( points.size() );
+    for ( size_t i = 0; i < points.size(); ++i )
+    {
+      result[ i ] = Gaussian2DParameter::raw_value( points[ i ], rng );
+    }
+  }
+
+  void
+  raw_values( const std::vector< Position< 3 > >& points,
+    librandom::RngPtr& rng,
+    std::vector< double >& result ) const
+  {
+    result.resize( points.size() );
+    for ( size_t i = 0; i < points.size(); ++i )
+    {
+      result[ i ] = Gaussian2DParameter::raw_value(
+        Position< 2 >( points[ i ][ 0 ], points[ i ][ 1 ] ), rng );
+    }
+  }
+
+  bool
+  is_deterministic() const
+  {
+    return true;
+  }
+
   TopologyParameter*
   clone() const
   {
@@ -699,6 +913,12 @@ public:
     return p_->raw_value( p - anchor_, rng );
   }
 
+  bool
+  is_deterministic() const
+  {
+    return p_->is_deterministic();
+  }
+
   TopologyParameter*
   clone() const
   {
@@ -757,6 +977,13 @@ public:
     return parameter1_->value( p, rng ) * parameter2_->value( p, rng );
   }
 
+  bool
+  is_deterministic() const
+  {
+    return parameter1_->is_deterministic()
+      and parameter2_->is_deterministic();
+  }
+
   TopologyParameter*
   clone() const
   {
@@ -814,6 +1041,13 @@ public:
     return parameter1_->value( p, rng ) / parameter2_->value( p, rng );
   }
 
+  bool
+  is_deterministic() const
+  {
+    return parameter1_->is_deterministic()
+      and parameter2_->is_deterministic();
+  }
+
   TopologyParameter*
   clone() const
   {
@@ -871,6 +1105,13 @@ public:
     return parameter1_->value( p, rng ) + parameter2_->value( p, rng );
   }
 
+  bool
+  is_deterministic() const
+  {
+    return parameter1_->is_deterministic()
+      and parameter2_->is_deterministic();
+  }
+
   TopologyParameter*
   clone() const
   {
@@ -929,6 +1170,13 @@ public:
     return parameter1_->value( p, rng ) - parameter2_->value( p, rng );
   }
 
+  bool
+  is_deterministic() const
+  {
+    return parameter1_->is_deterministic()
+      and parameter2_->is_deterministic();
+  }
+
   TopologyParameter*
   clone() const
   {
@@ -983,6 +1231,12 @@ public:
     return p_->raw_value( -p, rng );
   }
 
+  bool
+  is_deterministic() const
+  {
+    return p_->is_deterministic();
+  }
+
   TopologyParameter*
   clone() const
   {